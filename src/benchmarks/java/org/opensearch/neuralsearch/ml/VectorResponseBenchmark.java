@@ -0,0 +1,84 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import org.opensearch.ml.common.output.model.ModelTensor;
+import org.opensearch.ml.common.output.model.ModelTensorOutput;
+import org.opensearch.ml.common.output.model.ModelTensors;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Conversion of text embedding model output into vectors. Vectors of the response share one primitive array, boxed
+ * vectors are the reference of one boxed float per dimension, the gc profiler shows the difference in allocated bytes.
+ */
+@Fork(1)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+public class VectorResponseBenchmark {
+
+    @Param({ "1", "100" })
+    public int vectors;
+    @Param({ "384", "768" })
+    public int dimension;
+
+    private final MLCommonsClientAccessor accessor = new MLCommonsClientAccessor(null);
+    private ModelTensorOutput modelOutput;
+
+    @Setup(Level.Trial)
+    public void setUpModelOutput() {
+        Random random = new Random(42L);
+        List<ModelTensors> tensorsList = new ArrayList<>(vectors);
+        for (int i = 0; i < vectors; i++) {
+            Float[] data = new Float[dimension];
+            for (int j = 0; j < dimension; j++) {
+                data[j] = random.nextFloat();
+            }
+            ModelTensor tensor = new ModelTensor("sentence_embedding", data, new long[] { dimension }, null, null, null, Map.of());
+            tensorsList.add(new ModelTensors(List.of(tensor)));
+        }
+        modelOutput = new ModelTensorOutput(tensorsList);
+    }
+
+    @Benchmark
+    public List<List<Float>> buildVectorFromResponse() {
+        return accessor.buildVectorFromResponse(modelOutput);
+    }
+
+    @Benchmark
+    public List<List<Float>> boxedVectors() {
+        List<List<Float>> result = new ArrayList<>(vectors);
+        for (ModelTensors tensors : modelOutput.getMlModelOutputs()) {
+            for (ModelTensor tensor : tensors.getMlModelTensors()) {
+                Number[] data = tensor.getData();
+                List<Float> vector = new ArrayList<>(data.length);
+                for (Number value : data) {
+                    vector.add(value.floatValue());
+                }
+                result.add(vector);
+            }
+        }
+        return result;
+    }
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+import java.util.function.BiConsumer;
+import java.util.function.Consumer;
+
+import org.opensearch.cluster.ClusterState;
+import org.opensearch.cluster.service.ClusterService;
+import org.opensearch.common.settings.ClusterSettings;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.env.Environment;
+import org.opensearch.index.mapper.IndexFieldMapper;
+import org.opensearch.ingest.IngestDocument;
+import org.opensearch.ingest.IngestDocumentWrapper;
+import org.opensearch.neuralsearch.common.FloatArrayList;
+import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
+import org.opensearch.threadpool.ThreadPool;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+/**
+ * Batch execution of an inference processor without the model: texts of documents are deduplicated, sorted by length,
+ * split into sub-batches and results are distributed back to documents in the original order. Model returns results
+ * right away, so the benchmark shows the overhead the processor adds to every batch.
+ */
+@Fork(1)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+public class InferenceProcessorBatchBenchmark {
+
+    private static final String INDEX_NAME = "benchmark-index";
+    private static final int DIMENSION = 384;
+
+    @Param({ "10", "100", "500" })
+    public int documents;
+    @Param({ "1", "3" })
+    public int fieldsPerDocument;
+    @Param({ "100", "1000" })
+    public int textLength;
+    // percent of texts that repeat a text of another document
+    @Param({ "0", "50" })
+    public int duplicatePercent;
+
+    private InferenceProcessor processor;
+    private List<List<String>> textsByDocument;
+    private List<IngestDocumentWrapper> ingestDocumentWrappers;
+
+    @Setup(Level.Trial)
+    public void setUpProcessor() throws IOException {
+        Settings settings = Settings.builder()
+            .put(Environment.PATH_HOME_SETTING.getKey(), Files.createTempDirectory("neural-search-benchmarks").toString())
+            .build();
+        ClusterService clusterService = new ClusterService(
+            settings,
+            new ClusterSettings(settings, ClusterSettings.BUILT_IN_CLUSTER_SETTINGS),
+            (ThreadPool) null
+        ) {
+            @Override
+            public ClusterState state() {
+                return ClusterState.EMPTY_STATE;
+            }
+        };
+        Map<String, Object> fieldMap = new HashMap<>();
+        for (int i = 0; i < fieldsPerDocument; i++) {
+            fieldMap.put("text_" + i, "text_" + i + "_embedding");
+        }
+        processor = new NoModelInferenceProcessor(
+            fieldMap,
+            documents * fieldsPerDocument,
+            new Environment(settings, null),
+            clusterService
+        );
+
+        Random random = new Random(42L);
+        List<String> distinctTexts = new ArrayList<>();
+        textsByDocument = new ArrayList<>(documents);
+        for (int i = 0; i < documents; i++) {
+            List<String> texts = new ArrayList<>(fieldsPerDocument);
+            for (int j = 0; j < fieldsPerDocument; j++) {
+                if (!distinctTexts.isEmpty() && random.nextInt(100) < duplicatePercent) {
+                    texts.add(distinctTexts.get(random.nextInt(distinctTexts.size())));
+                } else {
+                    // lengths vary, so sorting by length changes the order of texts
+                    String text = createText(random, textLength / 2 + random.nextInt(textLength));
+                    distinctTexts.add(text);
+                    texts.add(text);
+                }
+            }
+            textsByDocument.add(texts);
+        }
+    }
+
+    @Setup(Level.Invocation)
+    public void setUpDocuments() {
+        // processor adds embeddings to documents, every invocation starts with documents without embeddings
+        ingestDocumentWrappers = new ArrayList<>(documents);
+        for (int i = 0; i < documents; i++) {
+            Map<String, Object> sourceAndMetadata = new HashMap<>();
+            sourceAndMetadata.put(IndexFieldMapper.NAME, INDEX_NAME);
+            List<String> texts = textsByDocument.get(i);
+            for (int j = 0; j < texts.size(); j++) {
+                sourceAndMetadata.put("text_" + j, texts.get(j));
+            }
+            ingestDocumentWrappers.add(new IngestDocumentWrapper(i, new IngestDocument(sourceAndMetadata, new HashMap<>()), null));
+        }
+    }
+
+    @Benchmark
+    public void batchExecute(final Blackhole blackhole) {
+        processor.batchExecute(ingestDocumentWrappers, blackhole::consume);
+    }
+
+    private static String createText(final Random random, final int length) {
+        StringBuilder text = new StringBuilder(length);
+        while (text.length() < length) {
+            text.append((char) ('a' + random.nextInt(26)));
+            if (random.nextInt(6) == 0) {
+                text.append(' ');
+            }
+        }
+        return text.toString();
+    }
+
+    /**
+     * Processor that completes every sub-batch on the calling thread with precomputed vectors
+     */
+    private static final class NoModelInferenceProcessor extends InferenceProcessor {
+        private final List<List<Float>> vectors;
+
+        NoModelInferenceProcessor(
+            final Map<String, Object> fieldMap,
+            final int maxTexts,
+            final Environment environment,
+            final ClusterService clusterService
+        ) {
+            super(
+                "benchmark",
+                "benchmark",
+                TextEmbeddingProcessor.TYPE,
+                TextEmbeddingProcessor.LIST_TYPE_NESTED_MAP_KEY,
+                "model_id",
+                fieldMap,
+                new MLCommonsClientAccessor(null),
+                environment,
+                clusterService
+            );
+            Random random = new Random(42L);
+            this.vectors = new ArrayList<>(maxTexts);
+            for (int i = 0; i < maxTexts; i++) {
+                float[] vector = new float[DIMENSION];
+                for (int j = 0; j < DIMENSION; j++) {
+                    vector[j] = random.nextFloat();
+                }
+                vectors.add(new FloatArrayList(vector));
+            }
+        }
+
+        @Override
+        public void doExecute(
+            final IngestDocument ingestDocument,
+            final Map<String, Object> processMap,
+            final List<String> inferenceList,
+            final BiConsumer<IngestDocument, Exception> handler
+        ) {
+            throw new UnsupportedOperationException("benchmark covers batch execution only");
+        }
+
+        @Override
+        void doBatchExecute(final List<String> inferenceList, final Consumer<List<?>> handler, final Consumer<Exception> onException) {
+            handler.accept(vectors.subList(0, inferenceList.size()));
+        }
+    }
+}
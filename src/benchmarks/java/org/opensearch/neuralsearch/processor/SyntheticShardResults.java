@@ -0,0 +1,77 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Random;
+
+import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.TotalHits;
+
+/**
+ * Generates hybrid query results of shards for benchmarks of normalization and combination. Every sub-query returns hits
+ * from a pool of twice as many documents, so sub-queries share part of their hits like lexical and semantic sub-queries
+ * usually do. Results are built from a fixed seed, benchmark runs of different commits work with the same data.
+ */
+public final class SyntheticShardResults {
+
+    private static final long SEED = 42L;
+
+    private SyntheticShardResults() {}
+
+    /**
+     * Creates results of all shards, results are mutated by normalization and combination so every run needs new ones
+     * @param shards number of shards
+     * @param subQueries number of sub-queries of the hybrid query
+     * @param hitsPerSubQuery number of hits every sub-query returns from a shard
+     * @return results of shards
+     */
+    public static List<CompoundTopDocs> create(final int shards, final int subQueries, final int hitsPerSubQuery) {
+        Random random = new Random(SEED);
+        int[] docIdPool = new int[hitsPerSubQuery * 2];
+        for (int i = 0; i < docIdPool.length; i++) {
+            docIdPool[i] = i;
+        }
+        List<CompoundTopDocs> shardResults = new ArrayList<>(shards);
+        for (int shard = 0; shard < shards; shard++) {
+            List<TopDocs> topDocsPerSubQuery = new ArrayList<>(subQueries);
+            for (int subQuery = 0; subQuery < subQueries; subQuery++) {
+                // scores of some sub-queries are above 1, e.g. bm25, and some are not, e.g. cosine similarity
+                topDocsPerSubQuery.add(subQueryTopDocs(random, docIdPool, hitsPerSubQuery, shard, subQuery % 2 == 0 ? 10.0f : 1.0f));
+            }
+            shardResults.add(new CompoundTopDocs(new TotalHits(hitsPerSubQuery, TotalHits.Relation.EQUAL_TO), topDocsPerSubQuery));
+        }
+        return shardResults;
+    }
+
+    private static TopDocs subQueryTopDocs(
+        final Random random,
+        final int[] docIdPool,
+        final int hits,
+        final int shard,
+        final float maxScore
+    ) {
+        // partial shuffle, first hits elements of the pool are the matched documents
+        for (int i = 0; i < hits; i++) {
+            int j = i + random.nextInt(docIdPool.length - i);
+            int docId = docIdPool[i];
+            docIdPool[i] = docIdPool[j];
+            docIdPool[j] = docId;
+        }
+        float[] scores = new float[hits];
+        for (int i = 0; i < hits; i++) {
+            scores[i] = random.nextFloat() * maxScore;
+        }
+        Arrays.sort(scores);
+        ScoreDoc[] scoreDocs = new ScoreDoc[hits];
+        for (int i = 0; i < hits; i++) {
+            scoreDocs[i] = new ScoreDoc(docIdPool[i], scores[hits - 1 - i], shard);
+        }
+        return new TopDocs(new TotalHits(hits, TotalHits.Relation.EQUAL_TO), scoreDocs);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.chunker;
+
+import static org.opensearch.neuralsearch.processor.chunker.Chunker.CHUNK_STRING_COUNT_FIELD;
+import static org.opensearch.neuralsearch.processor.chunker.Chunker.DISABLED_MAX_CHUNK_LIMIT;
+import static org.opensearch.neuralsearch.processor.chunker.Chunker.MAX_CHUNK_LIMIT_FIELD;
+import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.ANALYSIS_REGISTRY_FIELD;
+import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.MAX_TOKEN_COUNT_FIELD;
+import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.OVERLAP_RATE_FIELD;
+import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.TOKEN_LIMIT_FIELD;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.util.List;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import org.opensearch.common.settings.Settings;
+import org.opensearch.env.Environment;
+import org.opensearch.index.analysis.AnalysisRegistry;
+import org.opensearch.indices.analysis.AnalysisModule;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Chunking of one document field with the default standard tokenizer. Spans reference characters of the input, chunk
+ * additionally creates a string for every passage, like the text chunking processor does when it writes the passages.
+ */
+@Fork(1)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+public class FixedTokenLengthChunkerBenchmark {
+
+    @Param({ "100", "1000", "10000" })
+    public int docLength;
+    @Param({ "128", "384" })
+    public int tokenLimit;
+    @Param({ "0.0", "0.2" })
+    public double overlapRate;
+
+    private FixedTokenLengthChunker chunker;
+    private Map<String, Object> runtimeParameters;
+    private String content;
+
+    @Setup(Level.Trial)
+    public void setUpChunker() throws IOException {
+        Settings settings = Settings.builder()
+            .put(Environment.PATH_HOME_SETTING.getKey(), Files.createTempDirectory("neural-search-benchmarks").toString())
+            .build();
+        AnalysisRegistry analysisRegistry = new AnalysisModule(new Environment(settings, null), List.of()).getAnalysisRegistry();
+        chunker = new FixedTokenLengthChunker(
+            Map.of(TOKEN_LIMIT_FIELD, tokenLimit, OVERLAP_RATE_FIELD, overlapRate, ANALYSIS_REGISTRY_FIELD, analysisRegistry)
+        );
+        runtimeParameters = Map.of(
+            MAX_TOKEN_COUNT_FIELD,
+            docLength * 2,
+            MAX_CHUNK_LIMIT_FIELD,
+            DISABLED_MAX_CHUNK_LIMIT,
+            CHUNK_STRING_COUNT_FIELD,
+            1
+        );
+        content = createContent(docLength);
+    }
+
+    @Benchmark
+    public List<String> chunk() {
+        return chunker.chunk(content, runtimeParameters);
+    }
+
+    private static String createContent(final int words) {
+        Random random = new Random(42L);
+        StringBuilder content = new StringBuilder();
+        for (int i = 0; i < words; i++) {
+            int wordLength = 2 + random.nextInt(8);
+            for (int j = 0; j < wordLength; j++) {
+                content.append((char) ('a' + random.nextInt(26)));
+            }
+            // sentences of about 15 words
+            content.append(random.nextInt(15) == 0 ? ". " : " ");
+        }
+        return content.toString();
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.combination;
+
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+
+import org.opensearch.neuralsearch.processor.CompoundTopDocs;
+import org.opensearch.neuralsearch.processor.SyntheticShardResults;
+import org.opensearch.neuralsearch.processor.normalization.MinMaxScoreNormalizationTechnique;
+import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizationFactory;
+import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizationTechnique;
+import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizer;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Combination of normalized sub-query scores into one score per document, done by {@link ScoreCombiner} for every shard
+ * result: collect scores per document, combine them, select and sort top documents
+ */
+@Fork(1)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+public class ScoreCombinationBenchmark {
+
+    @Param(
+        {
+            ArithmeticMeanScoreCombinationTechnique.TECHNIQUE_NAME,
+            GeometricMeanScoreCombinationTechnique.TECHNIQUE_NAME,
+            HarmonicMeanScoreCombinationTechnique.TECHNIQUE_NAME,
+            RRFScoreCombinationTechnique.TECHNIQUE_NAME }
+    )
+    public String technique;
+    @Param({ "2", "5" })
+    public int subQueries;
+    @Param({ "100", "1000" })
+    public int hitsPerSubQuery;
+    @Param({ "1", "5" })
+    public int shards;
+
+    private final ScoreCombiner scoreCombiner = new ScoreCombiner();
+    private ScoreCombinationTechnique combinationTechnique;
+    private ScoreNormalizationTechnique normalizationTechnique;
+    private List<CompoundTopDocs> queryTopDocs;
+
+    @Setup(Level.Trial)
+    public void setUpTechniques() {
+        combinationTechnique = new ScoreCombinationFactory().createCombination(technique);
+        normalizationTechnique = new ScoreNormalizationFactory().createNormalization(MinMaxScoreNormalizationTechnique.TECHNIQUE_NAME);
+    }
+
+    @Setup(Level.Invocation)
+    public void setUpShardResults() {
+        // combination replaces hits of shard results, every invocation starts with normalized results that are not combined yet
+        queryTopDocs = SyntheticShardResults.create(shards, subQueries, hitsPerSubQuery);
+        new ScoreNormalizer().normalizeScores(queryTopDocs, normalizationTechnique);
+    }
+
+    @Benchmark
+    public List<CompoundTopDocs> combineScores() {
+        scoreCombiner.combineScores(queryTopDocs, combinationTechnique);
+        return queryTopDocs;
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.normalization;
+
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+
+import org.opensearch.neuralsearch.processor.CompoundTopDocs;
+import org.opensearch.neuralsearch.processor.SyntheticShardResults;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Normalization of sub-query scores of all shards, the first stage of the normalization processor on the coordinator node
+ */
+@Fork(1)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+public class ScoreNormalizationBenchmark {
+
+    @Param({ MinMaxScoreNormalizationTechnique.TECHNIQUE_NAME, L2ScoreNormalizationTechnique.TECHNIQUE_NAME })
+    public String technique;
+    @Param({ "2", "5" })
+    public int subQueries;
+    @Param({ "100", "1000" })
+    public int hitsPerSubQuery;
+    @Param({ "1", "5" })
+    public int shards;
+
+    private final ScoreNormalizer scoreNormalizer = new ScoreNormalizer();
+    private ScoreNormalizationTechnique normalizationTechnique;
+    private List<CompoundTopDocs> queryTopDocs;
+
+    @Setup(Level.Trial)
+    public void setUpTechnique() {
+        normalizationTechnique = new ScoreNormalizationFactory().createNormalization(technique);
+    }
+
+    @Setup(Level.Invocation)
+    public void setUpShardResults() {
+        // scores are normalized in place, every invocation starts with results that are not normalized yet
+        queryTopDocs = SyntheticShardResults.create(shards, subQueries, hitsPerSubQuery);
+    }
+
+    @Benchmark
+    public List<CompoundTopDocs> normalizeScores() {
+        scoreNormalizer.normalizeScores(queryTopDocs, normalizationTechnique);
+        return queryTopDocs;
+    }
+}
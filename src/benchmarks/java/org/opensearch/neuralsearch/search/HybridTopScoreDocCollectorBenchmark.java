@@ -0,0 +1,139 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.search;
+
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import org.apache.lucene.analysis.standard.StandardAnalyzer;
+import org.apache.lucene.document.Document;
+import org.apache.lucene.document.Field;
+import org.apache.lucene.document.TextField;
+import org.apache.lucene.index.DirectoryReader;
+import org.apache.lucene.index.IndexWriter;
+import org.apache.lucene.index.IndexWriterConfig;
+import org.apache.lucene.index.LeafReaderContext;
+import org.apache.lucene.index.Term;
+import org.apache.lucene.search.CollectionTerminatedException;
+import org.apache.lucene.search.DocIdSetIterator;
+import org.apache.lucene.search.IndexSearcher;
+import org.apache.lucene.search.LeafCollector;
+import org.apache.lucene.search.Query;
+import org.apache.lucene.search.Scorer;
+import org.apache.lucene.search.TermQuery;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.Weight;
+import org.apache.lucene.store.ByteBuffersDirectory;
+import org.apache.lucene.store.Directory;
+import org.opensearch.neuralsearch.query.HybridQuery;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Shard level execution of hybrid query over a synthetic index: weights of sub-queries, {@code HybridQueryScorer} that
+ * iterates over the union of sub-query matches and {@link HybridTopScoreDocCollector} that keeps top hits per sub-query.
+ * Allocations reported by the gc profiler that grow with the number of documents come from the per document path, e.g.
+ * collect, the rest is the fixed cost of weights and priority queues.
+ */
+@Fork(1)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Benchmark)
+public class HybridTopScoreDocCollectorBenchmark {
+
+    private static final String FIELD_NAME = "text";
+    private static final int VOCABULARY_SIZE = 1_000;
+    // default value of track_total_hits
+    private static final int TOTAL_HITS_THRESHOLD = 10_000;
+
+    @Param({ "10000", "100000" })
+    public int numDocs;
+    @Param({ "10", "100" })
+    public int docLength;
+    @Param({ "1", "3", "5" })
+    public int subQueries;
+    @Param({ "10", "100" })
+    public int numHits;
+
+    private Directory directory;
+    private DirectoryReader reader;
+    private IndexSearcher searcher;
+    private HybridQuery hybridQuery;
+
+    @Setup(Level.Trial)
+    public void setUpIndex() throws IOException {
+        Random random = new Random(42L);
+        directory = new ByteBuffersDirectory();
+        try (IndexWriter writer = new IndexWriter(directory, new IndexWriterConfig(new StandardAnalyzer()))) {
+            StringBuilder text = new StringBuilder();
+            for (int i = 0; i < numDocs; i++) {
+                text.setLength(0);
+                for (int j = 0; j < docLength; j++) {
+                    // skewed distribution of terms, so sub-queries match very different numbers of documents
+                    text.append("term").append((int) (VOCABULARY_SIZE * Math.pow(random.nextDouble(), 2))).append(' ');
+                }
+                Document document = new Document();
+                document.add(new TextField(FIELD_NAME, text.toString(), Field.Store.NO));
+                writer.addDocument(document);
+            }
+            writer.forceMerge(1);
+        }
+        reader = DirectoryReader.open(directory);
+        searcher = new IndexSearcher(reader);
+        // results of sub-queries must not be cached between invocations
+        searcher.setQueryCache(null);
+
+        List<Query> queries = new ArrayList<>(subQueries);
+        for (int i = 0; i < subQueries; i++) {
+            queries.add(new TermQuery(new Term(FIELD_NAME, "term" + i * 7)));
+        }
+        hybridQuery = new HybridQuery(queries);
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDownIndex() throws IOException {
+        reader.close();
+        directory.close();
+    }
+
+    @Benchmark
+    public List<TopDocs> search() throws IOException {
+        HybridTopScoreDocCollector collector = new HybridTopScoreDocCollector(numHits, new HitsThresholdChecker(TOTAL_HITS_THRESHOLD));
+        Weight weight = searcher.createWeight(searcher.rewrite(hybridQuery), collector.scoreMode(), 1.0f);
+        for (LeafReaderContext leafReaderContext : reader.leaves()) {
+            Scorer scorer = weight.scorer(leafReaderContext);
+            if (scorer == null) {
+                continue;
+            }
+            LeafCollector leafCollector = collector.getLeafCollector(leafReaderContext);
+            leafCollector.setScorer(scorer);
+            DocIdSetIterator iterator = scorer.iterator();
+            try {
+                for (int doc = iterator.nextDoc(); doc != DocIdSetIterator.NO_MORE_DOCS; doc = iterator.nextDoc()) {
+                    leafCollector.collect(doc);
+                }
+            } catch (CollectionTerminatedException e) {
+                // collector has no competitive documents left in the segment
+            }
+        }
+        return collector.topDocs();
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.util;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Parsing of sparse encoding model output into token weight maps, done for every query of neural_sparse query and for
+ * every batch of the sparse encoding processor. Weights are doubles the same way they are after parsing of the model
+ * response.
+ */
+@Fork(1)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+public class TokenWeightUtilBenchmark {
+
+    @Param({ "1", "16" })
+    public int texts;
+    @Param({ "50", "500" })
+    public int tokensPerText;
+
+    private List<Map<String, ?>> modelOutput;
+
+    @Setup(Level.Trial)
+    public void setUpModelOutput() {
+        Random random = new Random(42L);
+        List<Map<String, Double>> tokenWeights = new ArrayList<>(texts);
+        for (int i = 0; i < texts; i++) {
+            Map<String, Double> weights = new HashMap<>();
+            while (weights.size() < tokensPerText) {
+                // vocabulary of bert based sparse models has about 30k tokens
+                weights.put("token" + random.nextInt(30_000), random.nextDouble() * 2);
+            }
+            tokenWeights.add(weights);
+        }
+        modelOutput = List.of(Map.of(TokenWeightUtil.RESPONSE_KEY, tokenWeights));
+    }
+
+    @Benchmark
+    public List<Map<String, Float>> fetchListOfTokenWeightMap() {
+        return TokenWeightUtil.fetchListOfTokenWeightMap(modelOutput);
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.common;
+
+import java.util.AbstractList;
+import java.util.Arrays;
+import java.util.Objects;
+import java.util.RandomAccess;
+
+import org.apache.lucene.util.Accountable;
+import org.apache.lucene.util.RamUsageEstimator;
+
+/**
+ * Fixed size {@link java.util.List} of floats backed by a range of a primitive array. Vectors produced by the model are kept
+ * in this form so there are no boxed {@link Float} objects per dimension, elements get boxed only when they are read through
+ * the List interface. Several lists can share one array, e.g. all vectors from one model response.
+ */
+public final class FloatArrayList extends AbstractList<Float> implements RandomAccess, Accountable {
+
+    private static final long SHALLOW_SIZE = RamUsageEstimator.shallowSizeOfInstance(FloatArrayList.class);
+
+    private final float[] array;
+    private final int offset;
+    private final int length;
+
+    public FloatArrayList(final float[] array) {
+        this(array, 0, array.length);
+    }
+
+    public FloatArrayList(final float[] array, final int offset, final int length) {
+        Objects.checkFromIndexSize(offset, length, array.length);
+        this.array = array;
+        this.offset = offset;
+        this.length = length;
+    }
+
+    @Override
+    public Float get(final int index) {
+        return getFloat(index);
+    }
+
+    /**
+     * Returns element without boxing it
+     * @param index index of the element
+     * @return element at the index
+     */
+    public float getFloat(final int index) {
+        Objects.checkIndex(index, length);
+        return array[offset + index];
+    }
+
+    @Override
+    public Float set(final int index, final Float element) {
+        Objects.checkIndex(index, length);
+        float previous = array[offset + index];
+        array[offset + index] = element;
+        return previous;
+    }
+
+    @Override
+    public int size() {
+        return length;
+    }
+
+    /**
+     * Copies elements to a new primitive array
+     * @return array with elements of this list
+     */
+    public float[] toFloatArray() {
+        return Arrays.copyOfRange(array, offset, offset + length);
+    }
+
+    /**
+     * Size of the list with its range of the array, array shared with other lists is accounted only partially
+     * @return size in bytes
+     */
+    @Override
+    public long ramBytesUsed() {
+        return SHALLOW_SIZE + RamUsageEstimator.alignObjectSize(RamUsageEstimator.NUM_BYTES_ARRAY_HEADER + (long) Float.BYTES * length);
+    }
+}
@@ -22,6 +22,9 @@ public class VectorUtil {
      * @return array of floats produced from input list
      */
     public static float[] vectorAsListToArray(List<Float> vectorAsList) {
+        if (vectorAsList instanceof FloatArrayList) {
+            return ((FloatArrayList) vectorAsList).toFloatArray();
+        }
         float[] vector = new float[vectorAsList.size()];
         for (int i = 0; i < vectorAsList.size(); i++) {
             vector[i] = vectorAsList.get(i);
@@ -7,19 +7,39 @@ package org.opensearch.neuralsearch.executors;
 import lombok.AccessLevel;
 import lombok.NoArgsConstructor;
 import lombok.experimental.PackagePrivate;
-import org.apache.lucene.search.TaskExecutor;
+import org.apache.lucene.util.ThreadInterruptedException;
 import org.opensearch.common.settings.Settings;
 import org.opensearch.common.util.concurrent.OpenSearchExecutors;
+import org.opensearch.neuralsearch.stats.NeuralStats;
 import org.opensearch.threadpool.ExecutorBuilder;
 import org.opensearch.threadpool.FixedExecutorBuilder;
 import org.opensearch.threadpool.ThreadPool;
 
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Objects;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.Executor;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.concurrent.atomic.LongAdder;
+
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST;
+
 /**
  * {@link HybridQueryExecutor} provides necessary implementation and instances to execute
  * sub-queries from hybrid query in parallel as a Task by caller. This ensures that one thread pool
  * is used for hybrid query execution per node. The number of parallelization is also constrained
  * by twice allocated processor count since most of the operation from hybrid search is expected to be
  * short-lived thread. This will help us to achieve optimal parallelization and reasonable throughput.
+ * Tasks of one call are run by calling thread and at most "max parallel tasks per request - 1" pool threads, that take
+ * tasks from a shared list. Calling thread never waits for a task that hasn't been started, it runs such tasks itself,
+ * so tasks rejected by saturated pool are executed by the caller. Calls with few tasks are executed inline. If calling
+ * thread is interrupted while it waits for pool threads, tasks of the call that are still running get interrupted.
  */
 @NoArgsConstructor(access = AccessLevel.PRIVATE)
 public final class HybridQueryExecutor {
@@ -28,7 +48,13 @@ public final class HybridQueryExecutor {
     private static final Integer MAX_THREAD_SIZE = 1000;
     private static final Integer MIN_THREAD_SIZE = 2;
     private static final Integer PROCESSOR_COUNT_MULTIPLIER = 2;
-    private static TaskExecutor taskExecutor;
+    // forking threads doesn't pay off for up to this number of tasks
+    private static final int MAX_NUMBER_OF_INLINE_TASKS = 2;
+    private static final LongAdder INLINE_EXECUTIONS = new LongAdder();
+    private static final LongAdder STOLEN_TASKS = new LongAdder();
+    private static final LongAdder REJECTED_TASKS = new LongAdder();
+    private static Executor executor;
+    private static int maxParallelTasksPerRequest = HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST.getDefault(Settings.EMPTY);
 
     /**
      * Provide fixed executor builder to use for hybrid query executors
@@ -48,24 +74,42 @@ public final class HybridQueryExecutor {
     }
 
     /**
-     * Initialize @{@link TaskExecutor} to run tasks concurrently using {@link ThreadPool}
+     * Initialize executor to run tasks concurrently using {@link ThreadPool}
      * @param threadPool OpenSearch's thread pool instance
+     * @param settings Node level settings
      */
-    public static void initialize(ThreadPool threadPool) {
+    public static void initialize(final ThreadPool threadPool, final Settings settings) {
         if (threadPool == null) {
             throw new IllegalArgumentException(
                 "Argument thread-pool to Hybrid Query Executor cannot be null. This is required to build executor to run actions in parallel"
             );
         }
-        taskExecutor = new TaskExecutor(threadPool.executor(HYBRID_QUERY_EXEC_THREAD_POOL_NAME));
+        executor = threadPool.executor(HYBRID_QUERY_EXEC_THREAD_POOL_NAME);
+        maxParallelTasksPerRequest = HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST.get(settings);
+    }
+
+    /**
+     * Run all tasks and wait for them to finish. Tasks are executed by calling thread and pool threads, number of threads
+     * is limited per call. If executor is not initialized all tasks are executed by calling thread.
+     * @param tasks tasks to execute
+     * @return results of tasks in the same order as tasks
+     * @throws IOException if any of tasks failed with IOException
+     */
+    public static <T> List<T> invokeAll(final List<Callable<T>> tasks) throws IOException {
+        if (tasks.size() <= MAX_NUMBER_OF_INLINE_TASKS || Objects.isNull(executor) || maxParallelTasksPerRequest <= 1) {
+            INLINE_EXECUTIONS.increment();
+            return invokeInline(tasks);
+        }
+        return new ParallelTasks<>(tasks).invoke(executor, maxParallelTasksPerRequest);
     }
 
     /**
-     * Return TaskExecutor Wrapper that helps runs tasks concurrently
-     * @return TaskExecutor instance to help run search tasks in parallel
+     * Return current scheduling counters of the executor
+     * @return executor stats
      */
-    public static TaskExecutor getExecutor() {
-        return taskExecutor != null ? taskExecutor : new TaskExecutor(Runnable::run);
+    public static HybridQueryExecutorStats getStats() {
+        int queueSize = executor instanceof ThreadPoolExecutor ? ((ThreadPoolExecutor) executor).getQueue().size() : 0;
+        return new HybridQueryExecutorStats(queueSize, INLINE_EXECUTIONS.sum(), STOLEN_TASKS.sum(), REJECTED_TASKS.sum());
     }
 
     @PackagePrivate
@@ -83,4 +127,141 @@ public final class HybridQueryExecutor {
         int threadSize = Math.max(PROCESSOR_COUNT_MULTIPLIER * allocatedProcessors, MIN_THREAD_SIZE);
         return Math.min(threadSize, MAX_THREAD_SIZE);
     }
+
+    private static <T> List<T> invokeInline(final List<Callable<T>> tasks) throws IOException {
+        List<T> results = new ArrayList<>(tasks.size());
+        for (Callable<T> task : tasks) {
+            try {
+                results.add(task.call());
+            } catch (Exception e) {
+                throw rethrow(e);
+            }
+        }
+        return results;
+    }
+
+    private static IOException rethrow(final Throwable throwable) throws IOException {
+        if (throwable instanceof IOException) {
+            throw (IOException) throwable;
+        }
+        if (throwable instanceof RuntimeException) {
+            throw (RuntimeException) throwable;
+        }
+        if (throwable instanceof Error) {
+            throw (Error) throwable;
+        }
+        throw new RuntimeException(throwable);
+    }
+
+    /**
+     * Tasks of one invokeAll call. Every thread takes next not started task until all tasks are taken, so pool threads
+     * that start late or don't start at all only reduce parallelism
+     */
+    private static final class ParallelTasks<T> {
+        private final List<Callable<T>> tasks;
+        private final Object[] results;
+        private final AtomicInteger nextTask = new AtomicInteger();
+        private final CountDownLatch finishedTasks;
+        private final AtomicReference<Throwable> failure = new AtomicReference<>();
+        // pool threads that are running tasks of this call by task index, guarded by this
+        private final Thread[] runningThreads;
+        private boolean cancelled;
+
+        private ParallelTasks(final List<Callable<T>> tasks) {
+            this.tasks = tasks;
+            this.results = new Object[tasks.size()];
+            this.finishedTasks = new CountDownLatch(tasks.size());
+            this.runningThreads = new Thread[tasks.size()];
+        }
+
+        @SuppressWarnings("unchecked")
+        private List<T> invoke(final Executor executor, final int maxParallelTasks) throws IOException {
+            int numOfForkedThreads = Math.min(tasks.size(), maxParallelTasks) - 1;
+            for (int i = 0; i < numOfForkedThreads; i++) {
+                long submitNanos = NeuralStats.instance().startTimer();
+                try {
+                    executor.execute(() -> {
+                        NeuralStats.instance().recordTime(NeuralStats.HYBRID_QUERY_EXECUTOR_QUEUE_TIME, submitNanos);
+                        runTasks(false);
+                    });
+                } catch (RejectedExecutionException e) {
+                    // pool is saturated, remaining tasks are executed by calling thread
+                    REJECTED_TASKS.add(numOfForkedThreads - i);
+                    break;
+                }
+            }
+            runTasks(true);
+            try {
+                finishedTasks.await();
+            } catch (InterruptedException e) {
+                cancel();
+                Thread.currentThread().interrupt();
+                throw new ThreadInterruptedException(e);
+            }
+            if (Objects.nonNull(failure.get())) {
+                throw rethrow(failure.get());
+            }
+            List<T> taskResults = new ArrayList<>(results.length);
+            for (Object result : results) {
+                taskResults.add((T) result);
+            }
+            return taskResults;
+        }
+
+        private void runTasks(final boolean isCallingThread) {
+            int numOfExecutedTasks = 0;
+            int taskIndex;
+            while ((taskIndex = nextTask.getAndIncrement()) < tasks.size()) {
+                if (isCallingThread && numOfExecutedTasks > 0) {
+                    STOLEN_TASKS.increment();
+                }
+                try {
+                    if (isCallingThread || startTask(taskIndex)) {
+                        results[taskIndex] = tasks.get(taskIndex).call();
+                    }
+                } catch (Throwable e) {
+                    if (!failure.compareAndSet(null, e)) {
+                        failure.get().addSuppressed(e);
+                    }
+                } finally {
+                    if (!isCallingThread) {
+                        finishTask(taskIndex);
+                    }
+                    numOfExecutedTasks++;
+                    finishedTasks.countDown();
+                }
+            }
+        }
+
+        private synchronized boolean startTask(final int taskIndex) {
+            if (cancelled) {
+                return false;
+            }
+            runningThreads[taskIndex] = Thread.currentThread();
+            return true;
+        }
+
+        private synchronized void finishTask(final int taskIndex) {
+            if (Objects.nonNull(runningThreads[taskIndex])) {
+                runningThreads[taskIndex] = null;
+                if (cancelled) {
+                    // clear interrupt of the cancelled task, pool thread goes on with other work
+                    Thread.interrupted();
+                }
+            }
+        }
+
+        /**
+         * Stop tasks of the call, tasks that haven't been started are skipped and threads running tasks are interrupted
+         */
+        private synchronized void cancel() {
+            cancelled = true;
+            nextTask.set(tasks.size());
+            for (Thread runningThread : runningThreads) {
+                if (Objects.nonNull(runningThread)) {
+                    runningThread.interrupt();
+                }
+            }
+        }
+    }
 }
@@ -0,0 +1,46 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.executors;
+
+import java.util.Map;
+
+import lombok.AllArgsConstructor;
+import lombok.Getter;
+import lombok.ToString;
+
+/**
+ * Point in time counters of {@link HybridQueryExecutor}. Active threads, completed and rejected tasks of the pool itself are
+ * reported by thread pool stats of the node, these counters show how tasks of hybrid queries were scheduled.
+ */
+@AllArgsConstructor
+@Getter
+@ToString
+public final class HybridQueryExecutorStats {
+    // number of pool tasks waiting in the queue
+    private final int queueSize;
+    // number of invokeAll calls executed on the calling thread only, because they had few tasks
+    private final long inlineExecutions;
+    // number of tasks the calling thread took over from the queue instead of waiting for pool threads
+    private final long stolenTasks;
+    // number of tasks rejected by saturated pool and executed by the calling thread
+    private final long rejectedTasks;
+
+    /**
+     * Counters as a map reported by the neural stats API
+     * @return map of counter names to values
+     */
+    public Map<String, Object> toMap() {
+        return Map.of(
+            "queue_size",
+            queueSize,
+            "inline_executions",
+            inlineExecutions,
+            "stolen_tasks",
+            stolenTasks,
+            "rejected_tasks",
+            rejectedTasks
+        );
+    }
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.concurrency.OpenSearchRejectedExecutionException;
+import org.opensearch.threadpool.ThreadPool;
+
+import com.google.common.annotations.VisibleForTesting;
+
+import lombok.AllArgsConstructor;
+import lombok.NonNull;
+import lombok.extern.log4j.Log4j2;
+
+/**
+ * Coalesces single text inference requests for the same model into batched predict calls. Requests are collected until
+ * either the batch window expires or the batch reaches its maximum size, then they are sent as one call and results are
+ * routed back to each listener by position. Number of queued and in-flight requests per model is limited, requests above
+ * the limit are rejected so a slow model can't accumulate unbounded number of listeners.
+ */
+@Log4j2
+public class InferenceBatchDispatcher {
+
+    private final MLCommonsClientAccessor mlCommonsClientAccessor;
+    private final ThreadPool threadPool;
+    private final TimeValue batchWindow;
+    private final int maxBatchSize;
+    private final int maxQueueDepth;
+    private final Map<String, ModelBatchQueue> queuesByModel = new ConcurrentHashMap<>();
+
+    public InferenceBatchDispatcher(
+        final MLCommonsClientAccessor mlCommonsClientAccessor,
+        final ThreadPool threadPool,
+        final TimeValue batchWindow,
+        final int maxBatchSize,
+        final int maxQueueDepth
+    ) {
+        this.mlCommonsClientAccessor = mlCommonsClientAccessor;
+        this.threadPool = threadPool;
+        this.batchWindow = batchWindow;
+        this.maxBatchSize = maxBatchSize;
+        this.maxQueueDepth = maxQueueDepth;
+    }
+
+    /**
+     * Queues input text for inference, it's sent to the model together with other texts queued for the same model.
+     * Result is the same as for {@link MLCommonsClientAccessor#inferenceSentence}.
+     *
+     * @param modelId {@link String}
+     * @param inputText {@link String} on which inference needs to happen
+     * @param listener {@link ActionListener} which will be called when prediction is completed or errored out
+     */
+    public void inferenceSentence(
+        @NonNull final String modelId,
+        @NonNull final String inputText,
+        @NonNull final ActionListener<List<Float>> listener
+    ) {
+        queuesByModel.computeIfAbsent(modelId, ModelBatchQueue::new).add(new PendingInference(inputText, listener));
+    }
+
+    @VisibleForTesting
+    int queueDepth(final String modelId) {
+        ModelBatchQueue queue = queuesByModel.get(modelId);
+        return queue == null ? 0 : queue.depth.get();
+    }
+
+    @AllArgsConstructor
+    private static final class PendingInference {
+        private final String inputText;
+        private final ActionListener<List<Float>> listener;
+    }
+
+    /**
+     * Requests waiting to be sent to one model. Depth counts both queued requests and requests that are sent but not yet completed.
+     */
+    private final class ModelBatchQueue {
+        private final String modelId;
+        private final AtomicInteger depth = new AtomicInteger();
+        private List<PendingInference> pendingInferences = new ArrayList<>();
+        private boolean flushScheduled;
+
+        ModelBatchQueue(final String modelId) {
+            this.modelId = modelId;
+        }
+
+        void add(final PendingInference pendingInference) {
+            if (depth.incrementAndGet() > maxQueueDepth) {
+                depth.decrementAndGet();
+                pendingInference.listener.onFailure(
+                    new OpenSearchRejectedExecutionException(
+                        String.format(
+                            Locale.ROOT,
+                            "rejected inference request for model [%s], number of pending requests reached the limit of [%d]",
+                            modelId,
+                            maxQueueDepth
+                        )
+                    )
+                );
+                return;
+            }
+            List<PendingInference> fullBatch = null;
+            boolean scheduleFlush = false;
+            synchronized (this) {
+                pendingInferences.add(pendingInference);
+                if (pendingInferences.size() >= maxBatchSize) {
+                    fullBatch = pendingInferences;
+                    pendingInferences = new ArrayList<>();
+                } else if (!flushScheduled) {
+                    flushScheduled = true;
+                    scheduleFlush = true;
+                }
+            }
+            if (fullBatch != null) {
+                send(fullBatch);
+            } else if (scheduleFlush) {
+                threadPool.schedule(this::flush, batchWindow, ThreadPool.Names.GENERIC);
+            }
+        }
+
+        void flush() {
+            List<PendingInference> batch;
+            synchronized (this) {
+                flushScheduled = false;
+                if (pendingInferences.isEmpty()) {
+                    return;
+                }
+                batch = pendingInferences;
+                pendingInferences = new ArrayList<>();
+            }
+            send(batch);
+        }
+
+        private void send(final List<PendingInference> batch) {
+            List<String> inputTexts = new ArrayList<>(batch.size());
+            for (PendingInference pendingInference : batch) {
+                inputTexts.add(pendingInference.inputText);
+            }
+            try {
+                mlCommonsClientAccessor.inferenceSentences(modelId, inputTexts, new ActionListener<>() {
+                    @Override
+                    public void onResponse(final List<List<Float>> vectors) {
+                        depth.addAndGet(-batch.size());
+                        if (vectors.size() != batch.size()) {
+                            notifyFailure(
+                                batch,
+                                new IllegalStateException(
+                                    String.format(
+                                        Locale.ROOT,
+                                        "Unexpected number of vectors produced. Expected %d vectors to be returned, but got [%d]",
+                                        batch.size(),
+                                        vectors.size()
+                                    )
+                                )
+                            );
+                            return;
+                        }
+                        for (int i = 0; i < batch.size(); i++) {
+                            try {
+                                batch.get(i).listener.onResponse(vectors.get(i));
+                            } catch (Exception e) {
+                                log.error("Failed to notify listener of inference result", e);
+                            }
+                        }
+                    }
+
+                    @Override
+                    public void onFailure(final Exception exception) {
+                        depth.addAndGet(-batch.size());
+                        notifyFailure(batch, exception);
+                    }
+                });
+            } catch (Exception e) {
+                depth.addAndGet(-batch.size());
+                notifyFailure(batch, e);
+            }
+        }
+
+        private void notifyFailure(final List<PendingInference> batch, final Exception exception) {
+            for (PendingInference pendingInference : batch) {
+                try {
+                    pendingInference.listener.onFailure(exception);
+                } catch (Exception e) {
+                    log.error("Failed to notify listener of inference failure", e);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.nio.charset.StandardCharsets;
+import java.util.List;
+import java.util.Objects;
+
+import org.apache.commons.lang.StringUtils;
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.common.hash.MessageDigests;
+
+/**
+ * Key of an inference result kept in {@link InferenceResultCache}. Model inference is deterministic for the same model,
+ * input and response filter, so those values are enough to identify a result. Images are kept as a digest to avoid
+ * holding large base64 payloads in the cache, the same is possible for long texts such as ingested documents.
+ */
+public final class InferenceCacheKey {
+
+    private static final long SHALLOW_SIZE = RamUsageEstimator.shallowSizeOfInstance(InferenceCacheKey.class);
+
+    private final String modelId;
+    private final String text;
+    private final String textHash;
+    private final String imageHash;
+    private final List<String> responseFilters;
+    private final int hashCode;
+
+    private InferenceCacheKey(
+        final String modelId,
+        final String text,
+        final String textHash,
+        final String imageHash,
+        final List<String> responseFilters
+    ) {
+        this.modelId = modelId;
+        this.text = text;
+        this.textHash = textHash;
+        this.imageHash = imageHash;
+        this.responseFilters = responseFilters;
+        this.hashCode = Objects.hash(modelId, text, textHash, imageHash, responseFilters);
+    }
+
+    /**
+     * Creates key for text and optional image input
+     * @param modelId id of the model used for inference
+     * @param text input text, may be null for image only input
+     * @param image base64 encoded image, may be null for text only input
+     * @param responseFilters filters applied to model response, identify the shape of the result
+     * @return new cache key
+     */
+    public static InferenceCacheKey of(final String modelId, final String text, final String image, final List<String> responseFilters) {
+        return new InferenceCacheKey(modelId, text, null, hashOf(image), responseFilters);
+    }
+
+    /**
+     * Creates key for text input that keeps only digest of the text
+     * @param modelId id of the model used for inference
+     * @param text input text
+     * @param responseFilters filters applied to model response, identify the shape of the result
+     * @return new cache key
+     */
+    public static InferenceCacheKey ofHashedText(final String modelId, final String text, final List<String> responseFilters) {
+        return new InferenceCacheKey(modelId, null, digestOf(text), null, responseFilters);
+    }
+
+    /**
+     * Approximate number of bytes taken by the key, used to weigh cache entries
+     * @return size of the key in bytes
+     */
+    public long ramBytesUsed() {
+        long size = SHALLOW_SIZE + RamUsageEstimator.sizeOf(modelId) + RamUsageEstimator.sizeOf(text);
+        size += RamUsageEstimator.sizeOf(textHash) + RamUsageEstimator.sizeOf(imageHash);
+        for (String responseFilter : responseFilters) {
+            size += RamUsageEstimator.sizeOf(responseFilter);
+        }
+        return size;
+    }
+
+    private static String hashOf(final String value) {
+        if (StringUtils.isBlank(value)) {
+            return null;
+        }
+        return digestOf(value);
+    }
+
+    private static String digestOf(final String value) {
+        return MessageDigests.toHexString(MessageDigests.sha256().digest(value.getBytes(StandardCharsets.UTF_8)));
+    }
+
+    @Override
+    public boolean equals(Object o) {
+        if (this == o) return true;
+        if (o == null || getClass() != o.getClass()) return false;
+        InferenceCacheKey that = (InferenceCacheKey) o;
+        return hashCode == that.hashCode
+            && Objects.equals(modelId, that.modelId)
+            && Objects.equals(text, that.text)
+            && Objects.equals(textHash, that.textHash)
+            && Objects.equals(imageHash, that.imageHash)
+            && Objects.equals(responseFilters, that.responseFilters);
+    }
+
+    @Override
+    public int hashCode() {
+        return hashCode;
+    }
+}
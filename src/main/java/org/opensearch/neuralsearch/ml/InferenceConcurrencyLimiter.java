@@ -0,0 +1,290 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.ArrayDeque;
+import java.util.HashMap;
+import java.util.Locale;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Consumer;
+import java.util.function.LongSupplier;
+
+import org.opensearch.ExceptionsHelper;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.concurrency.OpenSearchRejectedExecutionException;
+import org.opensearch.core.rest.RestStatus;
+import org.opensearch.neuralsearch.util.RetryUtil;
+
+import com.google.common.annotations.VisibleForTesting;
+
+/**
+ * Node level limit of concurrent predict calls per model. Limit of every model adapts to the observed latency with
+ * additive increase and multiplicative decrease: it grows by about one per limit of completed calls while latency stays
+ * close to the baseline latency of the model, and shrinks by a ratio once latency doubles or the model reports overload.
+ * Baseline is a moving average of latencies kept separately per range of input count, so batch calls of ingestion
+ * are not compared with single text calls of search. Calls above the limit wait in a bounded queue, calls that don't
+ * fit into the queue are rejected right away so a slow model node doesn't get flooded by ingest and search threads.
+ */
+public class InferenceConcurrencyLimiter {
+
+    private static final int MIN_LIMIT = 1;
+    // limit is multiplied by this ratio on overload
+    private static final double BACKOFF_RATIO = 0.9;
+    // latency above the baseline multiplied by this factor is treated as overload
+    private static final double LATENCY_TOLERANCE = 2.0;
+    // weight of a new latency in the moving average baseline
+    private static final double BASELINE_SMOOTHING = 0.1;
+    // baseline follows slow latencies with this share of the difference, so it recovers when the model gets slower
+    private static final double BASELINE_DRIFT = 0.01;
+    // calls get baselines by power of two ranges of their input count: 1, 2-3, 4-7 and so on, larger batches share the last one
+    private static final int INPUT_COUNT_BUCKETS = 16;
+
+    private final int initialLimit;
+    private final int maxLimit;
+    private final int maxQueueSize;
+    private final LongSupplier nanoTimeSupplier;
+    private final Map<String, ModelLimit> limitsByModel = new ConcurrentHashMap<>();
+
+    public InferenceConcurrencyLimiter(final int initialLimit, final int maxLimit, final int maxQueueSize) {
+        this(initialLimit, maxLimit, maxQueueSize, System::nanoTime);
+    }
+
+    @VisibleForTesting
+    InferenceConcurrencyLimiter(final int initialLimit, final int maxLimit, final int maxQueueSize, final LongSupplier nanoTimeSupplier) {
+        this.maxLimit = Math.max(MIN_LIMIT, maxLimit);
+        this.initialLimit = Math.max(MIN_LIMIT, Math.min(initialLimit, this.maxLimit));
+        this.maxQueueSize = maxQueueSize;
+        this.nanoTimeSupplier = nanoTimeSupplier;
+    }
+
+    /**
+     * Runs the call once the model has a free slot. Call is rejected with {@link OpenSearchRejectedExecutionException}
+     * if all slots are taken and the queue of the model is full.
+     * @param modelId id of the model the call is sent to
+     * @param inputCount number of inputs sent with the call, latency is compared only with calls of similar size
+     * @param call function that sends the predict request and completes passed listener with the result
+     * @param listener listener that gets the result
+     * @param <T> type of the result
+     */
+    public <T> void execute(
+        final String modelId,
+        final int inputCount,
+        final Consumer<ActionListener<T>> call,
+        final ActionListener<T> listener
+    ) {
+        ModelLimit modelLimit = limitsByModel.computeIfAbsent(modelId, id -> new ModelLimit());
+        int inputCountBucket = toInputCountBucket(inputCount);
+        Runnable limitedCall = () -> run(modelLimit, inputCountBucket, call, listener);
+        switch (modelLimit.admit(limitedCall)) {
+            case ACQUIRED:
+                limitedCall.run();
+                break;
+            case QUEUED:
+                // slot may have been released between the check and adding the call to the queue
+                drain(modelLimit);
+                break;
+            default:
+                InferenceConcurrencyLimiterStats stats = modelLimit.stats();
+                listener.onFailure(
+                    new OpenSearchRejectedExecutionException(
+                        String.format(
+                            Locale.ROOT,
+                            "inference call to model [%s] is rejected, in flight calls [%d], limit [%d], queued calls [%d]",
+                            modelId,
+                            stats.getInFlight(),
+                            stats.getLimit(),
+                            stats.getQueueSize()
+                        )
+                    )
+                );
+        }
+    }
+
+    /**
+     * Checks if a call to the model would run right away, without waiting in the queue
+     * @param modelId id of the model
+     * @return true if the model has a free slot
+     */
+    public boolean hasCapacity(final String modelId) {
+        ModelLimit modelLimit = limitsByModel.get(modelId);
+        return modelLimit == null || modelLimit.hasCapacity();
+    }
+
+    /**
+     * Current limits of all models that got calls on this node
+     * @return map of model id to limiter state of the model
+     */
+    public Map<String, InferenceConcurrencyLimiterStats> getStats() {
+        Map<String, InferenceConcurrencyLimiterStats> stats = new HashMap<>();
+        limitsByModel.forEach((modelId, modelLimit) -> stats.put(modelId, modelLimit.stats()));
+        return stats;
+    }
+
+    @VisibleForTesting
+    static int toInputCountBucket(final int inputCount) {
+        int bucket = 31 - Integer.numberOfLeadingZeros(Math.max(1, inputCount));
+        return Math.min(bucket, INPUT_COUNT_BUCKETS - 1);
+    }
+
+    private <T> void run(
+        final ModelLimit modelLimit,
+        final int inputCountBucket,
+        final Consumer<ActionListener<T>> call,
+        final ActionListener<T> listener
+    ) {
+        long startNanos = nanoTimeSupplier.getAsLong();
+        AtomicBoolean released = new AtomicBoolean();
+        ActionListener<T> releasingListener = new ActionListener<>() {
+            @Override
+            public void onResponse(final T result) {
+                release(modelLimit, inputCountBucket, startNanos, false, released);
+                listener.onResponse(result);
+            }
+
+            @Override
+            public void onFailure(final Exception e) {
+                release(modelLimit, inputCountBucket, startNanos, isOverloaded(e), released);
+                listener.onFailure(e);
+            }
+        };
+        try {
+            call.accept(releasingListener);
+        } catch (Exception e) {
+            releasingListener.onFailure(e);
+        }
+    }
+
+    private void release(
+        final ModelLimit modelLimit,
+        final int inputCountBucket,
+        final long startNanos,
+        final boolean overloaded,
+        final AtomicBoolean released
+    ) {
+        if (!released.compareAndSet(false, true)) {
+            return;
+        }
+        long nowNanos = nanoTimeSupplier.getAsLong();
+        modelLimit.release(inputCountBucket, nowNanos - startNanos, overloaded, nowNanos);
+        drain(modelLimit);
+    }
+
+    private void drain(final ModelLimit modelLimit) {
+        // queued call may complete on the calling thread, in such case the loop below runs next calls
+        // instead of going into recursion
+        if (modelLimit.drainRequests.getAndIncrement() > 0) {
+            return;
+        }
+        do {
+            Runnable call;
+            while ((call = modelLimit.pollQueued()) != null) {
+                call.run();
+            }
+        } while (modelLimit.drainRequests.decrementAndGet() > 0);
+    }
+
+    private static boolean isOverloaded(final Exception e) {
+        RestStatus status = ExceptionsHelper.status(e);
+        return status == RestStatus.TOO_MANY_REQUESTS
+            || status == RestStatus.SERVICE_UNAVAILABLE
+            || status == RestStatus.GATEWAY_TIMEOUT
+            || RetryUtil.isRetryableException(e);
+    }
+
+    private enum Admission {
+        ACQUIRED,
+        QUEUED,
+        REJECTED
+    }
+
+    /**
+     * Limit, in flight calls and queue of one model
+     */
+    private final class ModelLimit {
+        private final ArrayDeque<Runnable> queue = new ArrayDeque<>();
+        private final AtomicInteger drainRequests = new AtomicInteger();
+        private double limit = initialLimit;
+        private int inFlight;
+        private final double[] baselineLatencyNanos = new double[INPUT_COUNT_BUCKETS];
+        private long lastDecreaseNanos;
+        private long rejectedCalls;
+
+        synchronized Admission admit(final Runnable call) {
+            if (inFlight < (int) limit && queue.isEmpty()) {
+                inFlight++;
+                return Admission.ACQUIRED;
+            }
+            if (queue.size() < maxQueueSize) {
+                queue.add(call);
+                return Admission.QUEUED;
+            }
+            rejectedCalls++;
+            return Admission.REJECTED;
+        }
+
+        synchronized Runnable pollQueued() {
+            if (queue.isEmpty() || inFlight >= (int) limit) {
+                return null;
+            }
+            inFlight++;
+            return queue.poll();
+        }
+
+        synchronized boolean hasCapacity() {
+            return inFlight < (int) limit && queue.isEmpty();
+        }
+
+        synchronized void release(final int inputCountBucket, final long latencyNanos, final boolean overloaded, final long nowNanos) {
+            // limit grows only if it was actually used, otherwise it would grow without bounds on light load
+            boolean limitUsed = inFlight >= limit / 2;
+            inFlight--;
+            boolean slow = false;
+            double baseline = baselineLatencyNanos[inputCountBucket];
+            if (!overloaded) {
+                if (baseline == 0) {
+                    baseline = latencyNanos;
+                } else {
+                    slow = latencyNanos > baseline * LATENCY_TOLERANCE;
+                    // slow calls move the baseline only a little, otherwise overload would become the new normal
+                    baseline += (latencyNanos - baseline) * (slow ? BASELINE_DRIFT : BASELINE_SMOOTHING);
+                }
+                baselineLatencyNanos[inputCountBucket] = baseline;
+            }
+            if (overloaded || slow) {
+                // calls that were sent before the decrease complete later, limit is decreased once per round trip
+                if (nowNanos - lastDecreaseNanos > baseline) {
+                    limit = Math.max(MIN_LIMIT, limit * BACKOFF_RATIO);
+                    lastDecreaseNanos = nowNanos;
+                }
+            } else if (limitUsed) {
+                limit = Math.min(maxLimit, limit + 1.0 / limit);
+            }
+        }
+
+        synchronized InferenceConcurrencyLimiterStats stats() {
+            return new InferenceConcurrencyLimiterStats(
+                (int) limit,
+                inFlight,
+                queue.size(),
+                TimeUnit.NANOSECONDS.toMillis((long) smallestCallsBaseline()),
+                rejectedCalls
+            );
+        }
+
+        // baseline of the smallest calls the model got, for search it's the latency of a single query text
+        private double smallestCallsBaseline() {
+            for (double baseline : baselineLatencyNanos) {
+                if (baseline > 0) {
+                    return baseline;
+                }
+            }
+            return 0;
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.Map;
+
+import lombok.AllArgsConstructor;
+import lombok.Getter;
+import lombok.ToString;
+
+/**
+ * Point in time state of the {@link InferenceConcurrencyLimiter} for one model
+ */
+@AllArgsConstructor
+@Getter
+@ToString
+public final class InferenceConcurrencyLimiterStats {
+    // current limit of concurrent predict calls
+    private final int limit;
+    // number of predict calls sent to the model and not completed yet
+    private final int inFlight;
+    // number of calls waiting for a free slot
+    private final int queueSize;
+    // average latency of the smallest calls of the model, used as a baseline to detect overload
+    private final long baselineLatencyMillis;
+    // number of calls rejected because the queue was full
+    private final long rejectedCalls;
+
+    /**
+     * State of the limiter as a map reported by the neural stats API
+     * @return map of counter names to values
+     */
+    public Map<String, Object> toMap() {
+        return Map.of(
+            "limit",
+            limit,
+            "in_flight",
+            inFlight,
+            "queue_size",
+            queueSize,
+            "baseline_latency_millis",
+            baselineLatencyMillis,
+            "rejected_calls",
+            rejectedCalls
+        );
+    }
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.function.Consumer;
+import java.util.function.ToLongFunction;
+
+import org.opensearch.common.cache.Cache;
+import org.opensearch.common.cache.CacheBuilder;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.common.unit.ByteSizeValue;
+
+import com.google.common.annotations.VisibleForTesting;
+
+import lombok.extern.log4j.Log4j2;
+
+/**
+ * Node level cache of model inference results. Entries are bounded by memory and expire after a configured time.
+ * Concurrent loads of the same key are merged, only the first caller triggers the inference and all others get
+ * notified once that call completes.
+ * @param <V> type of the inference result
+ */
+@Log4j2
+public class InferenceResultCache<V> {
+
+    private final Cache<InferenceCacheKey, V> cache;
+    private final Map<InferenceCacheKey, PendingLoad<V>> inFlightLoads = new ConcurrentHashMap<>();
+
+    public InferenceResultCache(final ByteSizeValue maxSize, final TimeValue expireAfterWrite, final ToLongFunction<V> valueWeigher) {
+        this.cache = CacheBuilder.<InferenceCacheKey, V>builder()
+            .setMaximumWeight(maxSize.getBytes())
+            .weigher((key, value) -> key.ramBytesUsed() + valueWeigher.applyAsLong(value))
+            .setExpireAfterWrite(expireAfterWrite)
+            .build();
+    }
+
+    /**
+     * Returns cached result for the key
+     * @param key cache key
+     * @return cached result or null if there is no such entry
+     */
+    public V get(final InferenceCacheKey key) {
+        return cache.get(key);
+    }
+
+    /**
+     * Adds result to the cache, replacing existing entry for the key
+     * @param key cache key
+     * @param value inference result
+     */
+    public void put(final InferenceCacheKey key, final V value) {
+        cache.put(key, value);
+    }
+
+    /**
+     * Returns cached result via listener, or loads it with provided loader if there is no entry for the key. If load for the same
+     * key is already in progress the listener is attached to it, and no additional inference call is made.
+     * @param key cache key
+     * @param loader function that runs inference and completes passed listener with the result
+     * @param listener listener that gets the result
+     */
+    public void getOrLoad(final InferenceCacheKey key, final Consumer<ActionListener<V>> loader, final ActionListener<V> listener) {
+        V cachedValue = cache.get(key);
+        if (cachedValue != null) {
+            listener.onResponse(cachedValue);
+            return;
+        }
+        PendingLoad<V> pendingLoad = new PendingLoad<>();
+        PendingLoad<V> existingLoad = inFlightLoads.putIfAbsent(key, pendingLoad);
+        if (existingLoad != null) {
+            existingLoad.addListener(listener);
+            return;
+        }
+        pendingLoad.addListener(listener);
+        try {
+            loader.accept(ActionListener.wrap(value -> {
+                cache.put(key, value);
+                inFlightLoads.remove(key, pendingLoad);
+                pendingLoad.onResponse(value);
+            }, exception -> {
+                inFlightLoads.remove(key, pendingLoad);
+                pendingLoad.onFailure(exception);
+            }));
+        } catch (Exception e) {
+            inFlightLoads.remove(key, pendingLoad);
+            pendingLoad.onFailure(e);
+        }
+    }
+
+    /**
+     * Removes all entries from the cache
+     */
+    public void invalidateAll() {
+        cache.invalidateAll();
+    }
+
+    /**
+     * Number of entries in the cache
+     * @return entries count
+     */
+    public int count() {
+        return cache.count();
+    }
+
+    /**
+     * Approximate memory used by cache entries
+     * @return memory in bytes
+     */
+    public long weight() {
+        return cache.weight();
+    }
+
+    /**
+     * Hits, misses and evictions recorded by the cache so far
+     * @return cache statistics
+     */
+    public Cache.CacheStats stats() {
+        return cache.stats();
+    }
+
+    @VisibleForTesting
+    int inFlightLoadsCount() {
+        return inFlightLoads.size();
+    }
+
+    /**
+     * Inference call that is in progress, collects all listeners waiting for the same key
+     */
+    private static final class PendingLoad<V> implements ActionListener<V> {
+        private final List<ActionListener<V>> listeners = new ArrayList<>();
+        private boolean completed;
+        private V value;
+        private Exception exception;
+
+        void addListener(final ActionListener<V> listener) {
+            synchronized (this) {
+                if (!completed) {
+                    listeners.add(listener);
+                    return;
+                }
+            }
+            notifyListener(listener);
+        }
+
+        @Override
+        public void onResponse(final V value) {
+            complete(value, null);
+        }
+
+        @Override
+        public void onFailure(final Exception exception) {
+            complete(null, exception);
+        }
+
+        private void complete(final V value, final Exception exception) {
+            List<ActionListener<V>> listenersToNotify;
+            synchronized (this) {
+                if (completed) {
+                    return;
+                }
+                this.completed = true;
+                this.value = value;
+                this.exception = exception;
+                listenersToNotify = new ArrayList<>(listeners);
+                listeners.clear();
+            }
+            listenersToNotify.forEach(this::notifyListener);
+        }
+
+        private void notifyListener(final ActionListener<V> listener) {
+            try {
+                if (exception != null) {
+                    listener.onFailure(exception);
+                } else {
+                    listener.onResponse(value);
+                }
+            } catch (Exception e) {
+                log.error("Failed to notify listener of inference result", e);
+            }
+        }
+    }
+}
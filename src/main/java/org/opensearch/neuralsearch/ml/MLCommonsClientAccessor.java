@@ -8,11 +8,14 @@ import static org.opensearch.neuralsearch.processor.TextImageEmbeddingProcessor.
 import static org.opensearch.neuralsearch.processor.TextImageEmbeddingProcessor.INPUT_TEXT;
 
 import java.util.ArrayList;
-import java.util.Arrays;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.BiFunction;
 import java.util.stream.Collectors;
 
+import org.opensearch.common.unit.TimeValue;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.core.common.util.CollectionUtils;
 import org.opensearch.ml.client.MachineLearningNodeClient;
@@ -26,20 +29,68 @@ import org.opensearch.ml.common.output.model.ModelResultFilter;
 import org.opensearch.ml.common.output.model.ModelTensor;
 import org.opensearch.ml.common.output.model.ModelTensorOutput;
 import org.opensearch.ml.common.output.model.ModelTensors;
+import org.opensearch.neuralsearch.common.FloatArrayList;
 import org.opensearch.neuralsearch.util.RetryUtil;
+import org.opensearch.threadpool.Scheduler;
+
+import com.google.common.annotations.VisibleForTesting;
 
 import lombok.NonNull;
-import lombok.RequiredArgsConstructor;
 import lombok.extern.log4j.Log4j2;
 
 /**
  * This class will act as an abstraction on the MLCommons client for accessing the ML Capabilities
  */
-@RequiredArgsConstructor
 @Log4j2
 public class MLCommonsClientAccessor {
-    private static final List<String> TARGET_RESPONSE_FILTERS = List.of("sentence_embedding");
+    public static final List<String> TARGET_RESPONSE_FILTERS = List.of("sentence_embedding");
     private final MachineLearningNodeClient mlClient;
+    // limit of concurrent predict calls per model, null if calls are not limited
+    private final InferenceConcurrencyLimiter concurrencyLimiter;
+    // schedules delayed retries and hedged calls, if null retries are sent right away and calls are not hedged
+    private final BiFunction<Long, Runnable, Scheduler.ScheduledCancellable> scheduler;
+    // delay after which the same call is sent once more if the first one hasn't completed, null or zero disables hedging
+    private final TimeValue hedgeDelay;
+
+    public MLCommonsClientAccessor(final MachineLearningNodeClient mlClient) {
+        this(mlClient, null, null, null);
+    }
+
+    public MLCommonsClientAccessor(
+        final MachineLearningNodeClient mlClient,
+        final InferenceConcurrencyLimiter concurrencyLimiter,
+        final BiFunction<Long, Runnable, Scheduler.ScheduledCancellable> scheduler,
+        final TimeValue hedgeDelay
+    ) {
+        this.mlClient = mlClient;
+        this.concurrencyLimiter = concurrencyLimiter;
+        this.scheduler = scheduler;
+        this.hedgeDelay = hedgeDelay;
+    }
+
+    /**
+     * Creates accessor that shares ml client and concurrency limits with this one and hedges its calls: if a call doesn't
+     * complete within the delay and the model has a free slot, the same call is sent once more and the first successful
+     * response is used. Meant for query time inference, where tail latency matters more than an extra call.
+     *
+     * @param scheduler schedules the hedged calls and delayed retries
+     * @param hedgeDelay {@link TimeValue} delay before the hedged call, zero disables hedging
+     * @return accessor with hedged calls
+     */
+    public MLCommonsClientAccessor withHedging(
+        final BiFunction<Long, Runnable, Scheduler.ScheduledCancellable> scheduler,
+        final TimeValue hedgeDelay
+    ) {
+        return new MLCommonsClientAccessor(mlClient, concurrencyLimiter, scheduler, hedgeDelay);
+    }
+
+    /**
+     * Current concurrency limits of models that got calls on this node
+     * @return map of model id to limiter state, empty if calls are not limited
+     */
+    public Map<String, InferenceConcurrencyLimiterStats> getConcurrencyLimiterStats() {
+        return concurrencyLimiter == null ? Map.of() : concurrencyLimiter.getStats();
+    }
 
     /**
      * Wrapper around {@link #inferenceSentences} that expected a single input text and produces a single floating
@@ -105,7 +156,7 @@ public class MLCommonsClientAccessor {
         @NonNull final List<String> inputText,
         @NonNull final ActionListener<List<List<Float>>> listener
     ) {
-        retryableInferenceSentencesWithVectorResult(targetResponseFilters, modelId, inputText, 0, listener);
+        retryableInferenceSentencesWithVectorResult(targetResponseFilters, modelId, inputText, listener);
     }
 
     public void inferenceSentencesWithMapResult(
@@ -113,7 +164,7 @@ public class MLCommonsClientAccessor {
         @NonNull final List<String> inputText,
         @NonNull final ActionListener<List<Map<String, ?>>> listener
     ) {
-        retryableInferenceSentencesWithMapResult(modelId, inputText, 0, listener);
+        retryableInferenceSentencesWithMapResult(modelId, inputText, listener);
     }
 
     /**
@@ -130,7 +181,7 @@ public class MLCommonsClientAccessor {
         @NonNull final Map<String, String> inputObjects,
         @NonNull final ActionListener<List<Float>> listener
     ) {
-        retryableInferenceSentencesWithSingleVectorResult(TARGET_RESPONSE_FILTERS, modelId, inputObjects, 0, listener);
+        retryableInferenceSentencesWithSingleVectorResult(TARGET_RESPONSE_FILTERS, modelId, inputObjects, listener);
     }
 
     /**
@@ -149,70 +200,94 @@ public class MLCommonsClientAccessor {
         @NonNull final List<String> inputText,
         @NonNull final ActionListener<List<Float>> listener
     ) {
-        retryableInferenceSimilarityWithVectorResult(modelId, queryText, inputText, 0, listener);
+        retryableInferenceSimilarityWithVectorResult(modelId, queryText, inputText, listener);
     }
 
     private void retryableInferenceSentencesWithMapResult(
         final String modelId,
         final List<String> inputText,
-        final int retryTime,
         final ActionListener<List<Map<String, ?>>> listener
     ) {
         MLInput mlInput = createMLTextInput(null, inputText);
-        mlClient.predict(modelId, mlInput, ActionListener.wrap(mlOutput -> {
+        predict(modelId, mlInput, inputText.size(), ActionListener.wrap(mlOutput -> {
             final List<Map<String, ?>> result = buildMapResultFromResponse(mlOutput);
             listener.onResponse(result);
-        }, e -> {
-            if (RetryUtil.shouldRetry(e, retryTime)) {
-                final int retryTimeAdd = retryTime + 1;
-                retryableInferenceSentencesWithMapResult(modelId, inputText, retryTimeAdd, listener);
-            } else {
-                listener.onFailure(e);
-            }
-        }));
+        }, listener::onFailure));
     }
 
     private void retryableInferenceSentencesWithVectorResult(
         final List<String> targetResponseFilters,
         final String modelId,
         final List<String> inputText,
-        final int retryTime,
         final ActionListener<List<List<Float>>> listener
     ) {
         MLInput mlInput = createMLTextInput(targetResponseFilters, inputText);
-        mlClient.predict(modelId, mlInput, ActionListener.wrap(mlOutput -> {
+        predict(modelId, mlInput, inputText.size(), ActionListener.wrap(mlOutput -> {
             final List<List<Float>> vector = buildVectorFromResponse(mlOutput);
             listener.onResponse(vector);
-        }, e -> {
-            if (RetryUtil.shouldRetry(e, retryTime)) {
-                final int retryTimeAdd = retryTime + 1;
-                retryableInferenceSentencesWithVectorResult(targetResponseFilters, modelId, inputText, retryTimeAdd, listener);
-            } else {
-                listener.onFailure(e);
-            }
-        }));
+        }, listener::onFailure));
     }
 
     private void retryableInferenceSimilarityWithVectorResult(
         final String modelId,
         final String queryText,
         final List<String> inputText,
-        final int retryTime,
         final ActionListener<List<Float>> listener
     ) {
         MLInput mlInput = createMLTextPairsInput(queryText, inputText);
-        mlClient.predict(modelId, mlInput, ActionListener.wrap(mlOutput -> {
+        predict(modelId, mlInput, inputText.size(), ActionListener.wrap(mlOutput -> {
             final List<Float> scores = buildVectorFromResponse(mlOutput).stream().map(v -> v.get(0)).collect(Collectors.toList());
             listener.onResponse(scores);
-        }, e -> {
-            if (RetryUtil.shouldRetry(e, retryTime)) {
-                retryableInferenceSimilarityWithVectorResult(modelId, queryText, inputText, retryTime + 1, listener);
-            } else {
-                listener.onFailure(e);
+        }, listener::onFailure));
+    }
+
+    private void predict(final String modelId, final MLInput mlInput, final int inputCount, final ActionListener<MLOutput> listener) {
+        if (scheduler == null || hedgeDelay == null || hedgeDelay.millis() <= 0) {
+            retryablePredict(modelId, mlInput, inputCount, 0, listener);
+            return;
+        }
+        HedgedCall hedgedCall = new HedgedCall(listener);
+        retryablePredict(modelId, mlInput, inputCount, 0, hedgedCall.newAttempt());
+        hedgedCall.setScheduledHedge(scheduler.apply(hedgeDelay.millis(), () -> {
+            // hedged call is sent only if it doesn't have to wait for a slot, otherwise it would add to the overload
+            if (hedgedCall.isCompleted() || (concurrencyLimiter != null && !concurrencyLimiter.hasCapacity(modelId))) {
+                return;
             }
+            retryablePredict(modelId, mlInput, inputCount, 0, hedgedCall.newAttempt());
         }));
     }
 
+    private void retryablePredict(
+        final String modelId,
+        final MLInput mlInput,
+        final int inputCount,
+        final int retryTime,
+        final ActionListener<MLOutput> listener
+    ) {
+        ActionListener<MLOutput> retryingListener = ActionListener.wrap(listener::onResponse, e -> {
+            if (!RetryUtil.shouldRetry(e, retryTime)) {
+                listener.onFailure(e);
+                return;
+            }
+            final Runnable retry = () -> retryablePredict(modelId, mlInput, inputCount, retryTime + 1, listener);
+            if (scheduler == null) {
+                retry.run();
+                return;
+            }
+            scheduler.apply(RetryUtil.getBackoffDelayMillis(retryTime), retry);
+        });
+        if (concurrencyLimiter == null) {
+            mlClient.predict(modelId, mlInput, retryingListener);
+            return;
+        }
+        concurrencyLimiter.execute(
+            modelId,
+            inputCount,
+            limitedListener -> mlClient.predict(modelId, mlInput, limitedListener),
+            retryingListener
+        );
+    }
+
     private MLInput createMLTextInput(final List<String> targetResponseFilters, List<String> inputText) {
         final ModelResultFilter modelResultFilter = new ModelResultFilter(false, true, targetResponseFilters, null);
         final MLInputDataset inputDataset = new TextDocsInputDataSet(inputText, modelResultFilter);
@@ -224,14 +299,30 @@ public class MLCommonsClientAccessor {
         return new MLInput(FunctionName.TEXT_SIMILARITY, null, inputDataset);
     }
 
-    private List<List<Float>> buildVectorFromResponse(MLOutput mlOutput) {
-        final List<List<Float>> vector = new ArrayList<>();
+    @VisibleForTesting
+    List<List<Float>> buildVectorFromResponse(MLOutput mlOutput) {
         final ModelTensorOutput modelTensorOutput = (ModelTensorOutput) mlOutput;
         final List<ModelTensors> tensorOutputList = modelTensorOutput.getMlModelOutputs();
+        // all vectors of the response are copied into one primitive array, every vector is a view over its range
+        int totalDimensions = 0;
+        int vectorCount = 0;
         for (final ModelTensors tensors : tensorOutputList) {
-            final List<ModelTensor> tensorsList = tensors.getMlModelTensors();
-            for (final ModelTensor tensor : tensorsList) {
-                vector.add(Arrays.stream(tensor.getData()).map(value -> (Float) value).collect(Collectors.toList()));
+            for (final ModelTensor tensor : tensors.getMlModelTensors()) {
+                totalDimensions += tensor.getData().length;
+                vectorCount++;
+            }
+        }
+        final float[] data = new float[totalDimensions];
+        final List<List<Float>> vector = new ArrayList<>(vectorCount);
+        int offset = 0;
+        for (final ModelTensors tensors : tensorOutputList) {
+            for (final ModelTensor tensor : tensors.getMlModelTensors()) {
+                final Number[] tensorData = tensor.getData();
+                for (int i = 0; i < tensorData.length; i++) {
+                    data[offset + i] = tensorData[i].floatValue();
+                }
+                vector.add(new FloatArrayList(data, offset, tensorData.length));
+                offset += tensorData.length;
             }
         }
         return vector;
@@ -264,22 +355,15 @@ public class MLCommonsClientAccessor {
         final List<String> targetResponseFilters,
         final String modelId,
         final Map<String, String> inputObjects,
-        final int retryTime,
         final ActionListener<List<Float>> listener
     ) {
         MLInput mlInput = createMLMultimodalInput(targetResponseFilters, inputObjects);
-        mlClient.predict(modelId, mlInput, ActionListener.wrap(mlOutput -> {
+        // text and image of one document produce a single vector
+        predict(modelId, mlInput, 1, ActionListener.wrap(mlOutput -> {
             final List<Float> vector = buildSingleVectorFromResponse(mlOutput);
             log.debug("Inference Response for input sentence is : {} ", vector);
             listener.onResponse(vector);
-        }, e -> {
-            if (RetryUtil.shouldRetry(e, retryTime)) {
-                final int retryTimeAdd = retryTime + 1;
-                retryableInferenceSentencesWithSingleVectorResult(targetResponseFilters, modelId, inputObjects, retryTimeAdd, listener);
-            } else {
-                listener.onFailure(e);
-            }
-        }));
+        }, listener::onFailure));
     }
 
     private MLInput createMLMultimodalInput(final List<String> targetResponseFilters, final Map<String, String> input) {
@@ -292,4 +376,57 @@ public class MLCommonsClientAccessor {
         final MLInputDataset inputDataset = new TextDocsInputDataSet(inputText, modelResultFilter);
         return new MLInput(FunctionName.TEXT_EMBEDDING, null, inputDataset);
     }
+
+    /**
+     * Predict call that may be sent twice. The first successful attempt completes the listener, result of the other attempt
+     * is dropped as the ml client doesn't allow to cancel a sent call. Listener fails only when all sent attempts failed.
+     */
+    private static final class HedgedCall {
+        private final ActionListener<MLOutput> listener;
+        private final AtomicBoolean completed = new AtomicBoolean();
+        private final AtomicInteger pendingAttempts = new AtomicInteger();
+        private volatile Scheduler.ScheduledCancellable scheduledHedge;
+
+        HedgedCall(final ActionListener<MLOutput> listener) {
+            this.listener = listener;
+        }
+
+        ActionListener<MLOutput> newAttempt() {
+            pendingAttempts.incrementAndGet();
+            return ActionListener.wrap(this::onAttemptResponse, this::onAttemptFailure);
+        }
+
+        boolean isCompleted() {
+            return completed.get();
+        }
+
+        void setScheduledHedge(final Scheduler.ScheduledCancellable scheduledHedge) {
+            this.scheduledHedge = scheduledHedge;
+            // first attempt may have completed before the hedge was scheduled
+            if (completed.get()) {
+                cancelScheduledHedge();
+            }
+        }
+
+        private void onAttemptResponse(final MLOutput mlOutput) {
+            if (completed.compareAndSet(false, true)) {
+                cancelScheduledHedge();
+                listener.onResponse(mlOutput);
+            }
+        }
+
+        private void onAttemptFailure(final Exception e) {
+            if (pendingAttempts.decrementAndGet() == 0 && completed.compareAndSet(false, true)) {
+                cancelScheduledHedge();
+                listener.onFailure(e);
+            }
+        }
+
+        private void cancelScheduledHedge() {
+            Scheduler.ScheduledCancellable hedge = scheduledHedge;
+            if (hedge != null) {
+                hedge.cancel();
+            }
+        }
+    }
 }
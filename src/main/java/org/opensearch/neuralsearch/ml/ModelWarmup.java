@@ -0,0 +1,355 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Objects;
+import java.util.TreeMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.TimeUnit;
+import java.util.function.BiConsumer;
+
+import org.opensearch.cluster.ClusterChangedEvent;
+import org.opensearch.cluster.ClusterStateListener;
+import org.opensearch.cluster.metadata.Metadata;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.gateway.GatewayService;
+import org.opensearch.ingest.IngestMetadata;
+import org.opensearch.neuralsearch.processor.InferenceProcessor;
+import org.opensearch.neuralsearch.processor.NeuralQueryEnricherProcessor;
+import org.opensearch.neuralsearch.processor.SparseEncodingProcessor;
+import org.opensearch.neuralsearch.processor.TextEmbeddingProcessor;
+import org.opensearch.neuralsearch.processor.TextImageEmbeddingProcessor;
+import org.opensearch.neuralsearch.processor.rerank.MLOpenSearchRerankProcessor;
+import org.opensearch.neuralsearch.processor.rerank.RerankProcessor;
+import org.opensearch.neuralsearch.processor.rerank.RerankType;
+import org.opensearch.search.pipeline.SearchPipelineMetadata;
+import org.opensearch.threadpool.ThreadPool;
+
+import com.google.common.annotations.VisibleForTesting;
+
+import lombok.extern.log4j.Log4j2;
+
+/**
+ * Sends warm-up inferences to models referenced by ingest and search pipelines, so the first requests after a node
+ * start or a pipeline update don't pay for model loading and connector setup. Pipelines are read from cluster state
+ * on every change of their metadata, every model is warmed up once with a configured number of inferences, failed
+ * calls are retried after a delay. The node is ready when no model is being warmed up, models that failed all attempts
+ * don't block readiness because a broken model fails on every node the same way.
+ */
+@Log4j2
+public class ModelWarmup implements ClusterStateListener {
+
+    public static final String READY_FIELD = "ready";
+    private static final String DEFAULT_MODEL_ID_FIELD = "default_model_id";
+    private static final String NEURAL_FIELD_DEFAULT_ID_FIELD = "neural_field_default_id";
+    private static final String PROCESSORS_FIELD = "processors";
+    private static final String REQUEST_PROCESSORS_FIELD = "request_processors";
+    private static final String RESPONSE_PROCESSORS_FIELD = "response_processors";
+
+    /**
+     * Kind of inference call a model receives, the same that is sent by the processor that references the model
+     */
+    public enum InferenceType {
+        TEXT_EMBEDDING,
+        TEXT_IMAGE_EMBEDDING,
+        // raw model output, works for both sparse and dense models
+        TEXT_DOCS,
+        TEXT_SIMILARITY
+    }
+
+    /**
+     * Status of the warm-up of one model
+     */
+    public enum Status {
+        WARMING,
+        READY,
+        FAILED
+    }
+
+    private final MLCommonsClientAccessor mlCommonsClientAccessor;
+    private final ThreadPool threadPool;
+    private final String warmupText;
+    private final int inferences;
+    private final TimeValue retryDelay;
+    private final int maxAttempts;
+    private final Map<String, ModelState> statesByModel = new ConcurrentHashMap<>();
+    private volatile boolean enabled;
+    // pipelines of the last seen cluster state, warm-up starts from them when it gets enabled
+    private volatile Metadata lastMetadata;
+
+    public ModelWarmup(
+        final MLCommonsClientAccessor mlCommonsClientAccessor,
+        final ThreadPool threadPool,
+        final boolean enabled,
+        final String warmupText,
+        final int inferences,
+        final TimeValue retryDelay,
+        final int maxAttempts
+    ) {
+        this.mlCommonsClientAccessor = mlCommonsClientAccessor;
+        this.threadPool = threadPool;
+        this.enabled = enabled;
+        this.warmupText = warmupText;
+        this.inferences = inferences;
+        this.retryDelay = retryDelay;
+        this.maxAttempts = maxAttempts;
+    }
+
+    @Override
+    public void clusterChanged(final ClusterChangedEvent event) {
+        if (event.state().blocks().hasGlobalBlock(GatewayService.STATE_NOT_RECOVERED_BLOCK)) {
+            // pipelines are not known until the cluster state is recovered
+            return;
+        }
+        if (Objects.nonNull(lastMetadata)
+            && !event.changedCustomMetadataSet().contains(IngestMetadata.TYPE)
+            && !event.changedCustomMetadataSet().contains(SearchPipelineMetadata.TYPE)) {
+            return;
+        }
+        lastMetadata = event.state().metadata();
+        if (enabled) {
+            warmUp(findModels(lastMetadata));
+        }
+    }
+
+    /**
+     * Enables or disables warm-up, models of known pipelines are warmed up again after warm-up gets enabled
+     * @param enabled new value of the setting
+     */
+    public void setEnabled(final boolean enabled) {
+        this.enabled = enabled;
+        if (!enabled) {
+            statesByModel.clear();
+            return;
+        }
+        if (Objects.nonNull(lastMetadata)) {
+            warmUp(findModels(lastMetadata));
+        }
+    }
+
+    /**
+     * Node is ready when warm-up is disabled, or pipelines were read and none of their models is being warmed up
+     * @return true if the node can serve traffic without paying for cold models
+     */
+    public boolean isReady() {
+        if (!enabled) {
+            return true;
+        }
+        return Objects.nonNull(lastMetadata) && statesByModel.values().stream().noneMatch(state -> state.status == Status.WARMING);
+    }
+
+    /**
+     * Warm-up state of the node as a map reported by the readiness API and the neural stats API
+     * @return map with readiness flag and state of every model
+     */
+    public Map<String, Object> toMap() {
+        Map<String, Object> models = new TreeMap<>();
+        statesByModel.forEach((modelId, state) -> models.put(modelId, state.toMap()));
+        Map<String, Object> result = new LinkedHashMap<>();
+        result.put("enabled", enabled);
+        result.put(READY_FIELD, isReady());
+        result.put("models", models);
+        return result;
+    }
+
+    @VisibleForTesting
+    void warmUp(final Map<String, InferenceType> models) {
+        // models that are no longer referenced by any pipeline don't affect readiness
+        statesByModel.keySet().retainAll(models.keySet());
+        models.forEach((modelId, inferenceType) -> {
+            ModelState newState = new ModelState(inferenceType);
+            ModelState state = statesByModel.compute(
+                modelId,
+                (id, existingState) -> Objects.isNull(existingState) || existingState.status == Status.FAILED ? newState : existingState
+            );
+            if (state == newState) {
+                log.debug("starting warm-up of model [{}] with [{}] inferences", modelId, inferences);
+                sendInference(modelId, newState);
+            }
+        });
+    }
+
+    private void sendInference(final String modelId, final ModelState state) {
+        try {
+            switch (state.inferenceType) {
+                case TEXT_EMBEDDING:
+                    mlCommonsClientAccessor.inferenceSentences(modelId, List.of(warmupText), warmupListener(modelId, state));
+                    break;
+                case TEXT_IMAGE_EMBEDDING:
+                    mlCommonsClientAccessor.inferenceSentences(
+                        modelId,
+                        Map.of(TextImageEmbeddingProcessor.INPUT_TEXT, warmupText),
+                        warmupListener(modelId, state)
+                    );
+                    break;
+                case TEXT_DOCS:
+                    mlCommonsClientAccessor.inferenceSentencesWithMapResult(modelId, List.of(warmupText), warmupListener(modelId, state));
+                    break;
+                case TEXT_SIMILARITY:
+                    mlCommonsClientAccessor.inferenceSimilarity(modelId, warmupText, List.of(warmupText), warmupListener(modelId, state));
+                    break;
+                default:
+                    throw new IllegalStateException("unsupported inference type " + state.inferenceType);
+            }
+        } catch (Exception e) {
+            onInferenceFailure(modelId, state, e);
+        }
+    }
+
+    private <T> ActionListener<T> warmupListener(final String modelId, final ModelState state) {
+        return ActionListener.wrap(result -> onInferenceResponse(modelId, state), e -> onInferenceFailure(modelId, state, e));
+    }
+
+    private void onInferenceResponse(final String modelId, final ModelState state) {
+        state.successfulInferences++;
+        if (statesByModel.get(modelId) != state) {
+            // warm-up got disabled or the model was removed from pipelines
+            return;
+        }
+        if (state.successfulInferences < inferences) {
+            sendInference(modelId, state);
+            return;
+        }
+        state.tookMillis = TimeUnit.NANOSECONDS.toMillis(System.nanoTime() - state.startNanos);
+        state.status = Status.READY;
+        log.info("model [{}] is warmed up in [{}] ms", modelId, state.tookMillis);
+    }
+
+    private void onInferenceFailure(final String modelId, final ModelState state, final Exception e) {
+        state.failedAttempts++;
+        state.lastError = e.getMessage();
+        if (state.failedAttempts >= maxAttempts) {
+            state.status = Status.FAILED;
+            log.warn("warm-up of model [{}] failed after [{}] attempts", modelId, state.failedAttempts, e);
+            return;
+        }
+        log.debug("warm-up inference of model [{}] failed, retrying in [{}]", modelId, retryDelay, e);
+        threadPool.schedule(() -> {
+            // state is replaced when warm-up is disabled or the model is removed from pipelines
+            if (statesByModel.get(modelId) == state) {
+                sendInference(modelId, state);
+            }
+        }, retryDelay, ThreadPool.Names.GENERIC);
+    }
+
+    /**
+     * Collects model ids of neural processors of all ingest and search pipelines
+     * @param metadata cluster metadata with pipelines
+     * @return map of model id to the kind of inference the model receives, ordered by first reference
+     */
+    @VisibleForTesting
+    static Map<String, InferenceType> findModels(final Metadata metadata) {
+        Map<String, InferenceType> models = new LinkedHashMap<>();
+        IngestMetadata ingestMetadata = metadata.custom(IngestMetadata.TYPE);
+        if (Objects.nonNull(ingestMetadata)) {
+            ingestMetadata.getPipelines()
+                .values()
+                .forEach(pipeline -> forEachProcessor(pipeline.getConfigAsMap(), PROCESSORS_FIELD, (type, config) -> {
+                    switch (type) {
+                        case TextEmbeddingProcessor.TYPE:
+                            addModel(models, config.get(InferenceProcessor.MODEL_ID_FIELD), InferenceType.TEXT_EMBEDDING);
+                            break;
+                        case SparseEncodingProcessor.TYPE:
+                            addModel(models, config.get(InferenceProcessor.MODEL_ID_FIELD), InferenceType.TEXT_DOCS);
+                            break;
+                        case TextImageEmbeddingProcessor.TYPE:
+                            addModel(models, config.get(TextImageEmbeddingProcessor.MODEL_ID_FIELD), InferenceType.TEXT_IMAGE_EMBEDDING);
+                            break;
+                        default:
+                            break;
+                    }
+                }));
+        }
+        SearchPipelineMetadata searchPipelineMetadata = metadata.custom(SearchPipelineMetadata.TYPE);
+        if (Objects.nonNull(searchPipelineMetadata)) {
+            searchPipelineMetadata.getPipelines().values().forEach(pipeline -> {
+                Map<String, Object> pipelineConfig = pipeline.getConfigAsMap();
+                forEachProcessor(pipelineConfig, REQUEST_PROCESSORS_FIELD, (type, config) -> {
+                    if (NeuralQueryEnricherProcessor.TYPE.equals(type)) {
+                        // default model can be either dense or sparse
+                        addModel(models, config.get(DEFAULT_MODEL_ID_FIELD), InferenceType.TEXT_DOCS);
+                        Object modelIdsByField = config.get(NEURAL_FIELD_DEFAULT_ID_FIELD);
+                        if (modelIdsByField instanceof Map) {
+                            ((Map<?, ?>) modelIdsByField).values().forEach(modelId -> addModel(models, modelId, InferenceType.TEXT_DOCS));
+                        }
+                    }
+                });
+                forEachProcessor(pipelineConfig, RESPONSE_PROCESSORS_FIELD, (type, config) -> {
+                    Object reranker = config.get(RerankType.ML_OPENSEARCH.getLabel());
+                    if (RerankProcessor.TYPE.equals(type) && reranker instanceof Map) {
+                        Object modelId = ((Map<?, ?>) reranker).get(MLOpenSearchRerankProcessor.MODEL_ID_FIELD);
+                        addModel(models, modelId, InferenceType.TEXT_SIMILARITY);
+                    }
+                });
+            });
+        }
+        return models;
+    }
+
+    private static void forEachProcessor(
+        final Map<String, Object> pipelineConfig,
+        final String processorsField,
+        final BiConsumer<String, Map<?, ?>> consumer
+    ) {
+        Object processors = pipelineConfig.get(processorsField);
+        if (!(processors instanceof List)) {
+            return;
+        }
+        for (Object processor : (List<?>) processors) {
+            if (!(processor instanceof Map)) {
+                continue;
+            }
+            // every processor is a map with processor type as the only key
+            ((Map<?, ?>) processor).forEach((type, config) -> {
+                if (config instanceof Map) {
+                    consumer.accept(String.valueOf(type), (Map<?, ?>) config);
+                }
+            });
+        }
+    }
+
+    private static void addModel(final Map<String, InferenceType> models, final Object modelId, final InferenceType inferenceType) {
+        if (modelId instanceof String && !((String) modelId).isBlank()) {
+            models.putIfAbsent((String) modelId, inferenceType);
+        }
+    }
+
+    /**
+     * Warm-up progress of one model, updated by the chain of warm-up calls of the model
+     */
+    private static final class ModelState {
+        private final InferenceType inferenceType;
+        private final long startNanos = System.nanoTime();
+        private volatile Status status = Status.WARMING;
+        private volatile int successfulInferences;
+        private volatile int failedAttempts;
+        private volatile String lastError;
+        private volatile long tookMillis;
+
+        private ModelState(final InferenceType inferenceType) {
+            this.inferenceType = inferenceType;
+        }
+
+        private Map<String, Object> toMap() {
+            Map<String, Object> result = new LinkedHashMap<>();
+            result.put("status", status.name().toLowerCase(Locale.ROOT));
+            result.put("inference_type", inferenceType.name().toLowerCase(Locale.ROOT));
+            result.put("successful_inferences", successfulInferences);
+            result.put("failed_attempts", failedAttempts);
+            if (Objects.nonNull(lastError)) {
+                result.put("last_error", lastError);
+            }
+            if (status == Status.READY) {
+                result.put("took_millis", tookMillis);
+            }
+            return result;
+        }
+    }
+}
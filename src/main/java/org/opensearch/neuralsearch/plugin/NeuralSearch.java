@@ -4,30 +4,79 @@
  */
 package org.opensearch.neuralsearch.plugin;
 
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_SEARCH_SHARD_WINDOW_ENABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_SEARCH_SHARD_WINDOW_FACTOR;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INFERENCE_CONCURRENCY_LIMIT_ENABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INFERENCE_CONCURRENCY_LIMIT_INITIAL;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INFERENCE_CONCURRENCY_LIMIT_MAX;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INFERENCE_CONCURRENCY_LIMIT_MAX_QUEUE_SIZE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_BATCH_MAX_CHARS;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_BATCH_MAX_IN_FLIGHT;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_BATCH_MAX_SIZE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_CACHE_EXPIRE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_CACHE_SIZE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.MODEL_WARMUP_ENABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.MODEL_WARMUP_INFERENCES;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.MODEL_WARMUP_MAX_ATTEMPTS;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.MODEL_WARMUP_RETRY_DELAY;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.MODEL_WARMUP_TEXT;
 import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.NEURAL_SEARCH_HYBRID_SEARCH_DISABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.NEURAL_SEARCH_STATS_ENABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.QUERY_INFERENCE_BATCH_ENABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.QUERY_INFERENCE_BATCH_MAX_QUEUE_DEPTH;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.QUERY_INFERENCE_BATCH_MAX_SIZE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.QUERY_INFERENCE_BATCH_WINDOW;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.QUERY_INFERENCE_CACHE_EXPIRE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.QUERY_INFERENCE_CACHE_SIZE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.QUERY_INFERENCE_HEDGE_DELAY;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.RERANK_SCORE_CACHE_EXPIRE;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.RERANK_SCORE_CACHE_SIZE;
 import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.RERANKER_MAX_DOC_FIELDS;
 
 import java.util.Arrays;
 import java.util.Collection;
 import java.util.List;
 import java.util.Map;
+import java.util.Objects;
 import java.util.Optional;
+import java.util.TreeMap;
+import java.util.function.IntSupplier;
+import java.util.function.LongSupplier;
 import java.util.function.Supplier;
+import java.util.stream.Collectors;
 
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.action.ActionRequest;
 import org.opensearch.client.Client;
 import org.opensearch.cluster.metadata.IndexNameExpressionResolver;
+import org.opensearch.cluster.node.DiscoveryNodes;
 import org.opensearch.cluster.service.ClusterService;
+import org.opensearch.common.cache.Cache;
+import org.opensearch.common.settings.ClusterSettings;
+import org.opensearch.common.settings.IndexScopedSettings;
 import org.opensearch.common.settings.Setting;
 import org.opensearch.common.settings.Settings;
+import org.opensearch.common.settings.SettingsFilter;
+import org.opensearch.common.unit.TimeValue;
 import org.opensearch.common.util.FeatureFlags;
+import org.opensearch.core.action.ActionResponse;
+import org.opensearch.core.common.unit.ByteSizeValue;
 import org.opensearch.core.common.io.stream.NamedWriteableRegistry;
 import org.opensearch.core.xcontent.NamedXContentRegistry;
 import org.opensearch.env.Environment;
 import org.opensearch.env.NodeEnvironment;
+import org.opensearch.index.IndexModule;
+import org.opensearch.ingest.IngestMetadata;
+import org.opensearch.ingest.IngestService;
 import org.opensearch.ingest.Processor;
 import org.opensearch.ml.client.MachineLearningNodeClient;
 import org.opensearch.neuralsearch.executors.HybridQueryExecutor;
+import org.opensearch.neuralsearch.ml.InferenceBatchDispatcher;
+import org.opensearch.neuralsearch.ml.InferenceConcurrencyLimiter;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
+import org.opensearch.neuralsearch.ml.ModelWarmup;
 import org.opensearch.neuralsearch.processor.NeuralQueryEnricherProcessor;
 import org.opensearch.neuralsearch.processor.NeuralSparseTwoPhaseProcessor;
 import org.opensearch.neuralsearch.processor.NormalizationProcessor;
@@ -47,11 +96,18 @@ import org.opensearch.neuralsearch.processor.factory.TextImageEmbeddingProcessor
 import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizationFactory;
 import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizer;
 import org.opensearch.neuralsearch.processor.rerank.RerankProcessor;
+import org.opensearch.neuralsearch.processor.rerank.RerankScoreCache;
 import org.opensearch.neuralsearch.query.HybridQueryBuilder;
 import org.opensearch.neuralsearch.query.NeuralQueryBuilder;
 import org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder;
 import org.opensearch.neuralsearch.query.ext.RerankSearchExtBuilder;
+import org.opensearch.neuralsearch.rest.RestModelWarmupHandler;
+import org.opensearch.neuralsearch.rest.RestNeuralStatsHandler;
 import org.opensearch.neuralsearch.search.query.HybridQueryPhaseSearcher;
+import org.opensearch.neuralsearch.search.query.HybridQuerySearchOperationListener;
+import org.opensearch.neuralsearch.stats.NeuralStats;
+import org.opensearch.neuralsearch.transport.NeuralStatsAction;
+import org.opensearch.neuralsearch.transport.NeuralStatsTransportAction;
 import org.opensearch.neuralsearch.util.NeuralSearchClusterUtil;
 import org.opensearch.plugins.ActionPlugin;
 import org.opensearch.plugins.ExtensiblePlugin;
@@ -60,6 +116,8 @@ import org.opensearch.plugins.Plugin;
 import org.opensearch.plugins.SearchPipelinePlugin;
 import org.opensearch.plugins.SearchPlugin;
 import org.opensearch.repositories.RepositoriesService;
+import org.opensearch.rest.RestController;
+import org.opensearch.rest.RestHandler;
 import org.opensearch.script.ScriptService;
 import org.opensearch.search.pipeline.SearchPhaseResultsProcessor;
 import org.opensearch.search.pipeline.SearchRequestProcessor;
@@ -77,6 +135,11 @@ import lombok.extern.log4j.Log4j2;
 @Log4j2
 public class NeuralSearch extends Plugin implements ActionPlugin, SearchPlugin, IngestPlugin, ExtensiblePlugin, SearchPipelinePlugin {
     private MLCommonsClientAccessor clientAccessor;
+    private IngestService ingestService;
+    private ClusterService clusterService;
+    // shares ml client and concurrency limits with ingest accessor, hedges calls made at query time
+    private MLCommonsClientAccessor queryClientAccessor;
+    private ModelWarmup modelWarmup;
     private NormalizationProcessorWorkflow normalizationProcessorWorkflow;
     private final ScoreNormalizationFactory scoreNormalizationFactory = new ScoreNormalizationFactory();
     private final ScoreCombinationFactory scoreCombinationFactory = new ScoreCombinationFactory();
@@ -96,13 +159,121 @@ public class NeuralSearch extends Plugin implements ActionPlugin, SearchPlugin,
         final Supplier<RepositoriesService> repositoriesServiceSupplier
     ) {
         NeuralSearchClusterUtil.instance().initialize(clusterService);
-        NeuralQueryBuilder.initialize(clientAccessor);
-        NeuralSparseQueryBuilder.initialize(clientAccessor);
-        HybridQueryExecutor.initialize(threadPool);
+        this.clusterService = clusterService;
+        initializeStats(clusterService);
+        initializeQueryBuilders(environment.settings(), threadPool);
+        HybridQueryExecutor.initialize(threadPool, environment.settings());
+        initializeModelWarmup(clusterService, threadPool);
         normalizationProcessorWorkflow = new NormalizationProcessorWorkflow(new ScoreNormalizer(), new ScoreCombiner());
         return List.of(clientAccessor);
     }
 
+    private void initializeStats(final ClusterService clusterService) {
+        NeuralStats neuralStats = NeuralStats.instance();
+        neuralStats.setEnabled(NEURAL_SEARCH_STATS_ENABLED.get(clusterService.getSettings()));
+        clusterService.getClusterSettings().addSettingsUpdateConsumer(NEURAL_SEARCH_STATS_ENABLED, neuralStats::setEnabled);
+        neuralStats.registerStatsSupplier("hybrid_query_executor", () -> HybridQueryExecutor.getStats().toMap());
+        neuralStats.registerStatsSupplier("inference_concurrency_limits", () -> {
+            Map<String, Object> limitsByModel = new TreeMap<>();
+            clientAccessor.getConcurrencyLimiterStats().forEach((modelId, stats) -> limitsByModel.put(modelId, stats.toMap()));
+            return limitsByModel;
+        });
+        neuralStats.registerStatsSupplier("sparse_encoding_pruning_ratio", this::getSparseEncodingPruningRatios);
+    }
+
+    private void initializeModelWarmup(final ClusterService clusterService, final ThreadPool threadPool) {
+        Settings settings = clusterService.getSettings();
+        modelWarmup = new ModelWarmup(
+            clientAccessor,
+            threadPool,
+            MODEL_WARMUP_ENABLED.get(settings),
+            MODEL_WARMUP_TEXT.get(settings),
+            MODEL_WARMUP_INFERENCES.get(settings),
+            MODEL_WARMUP_RETRY_DELAY.get(settings),
+            MODEL_WARMUP_MAX_ATTEMPTS.get(settings)
+        );
+        clusterService.addListener(modelWarmup);
+        clusterService.getClusterSettings().addSettingsUpdateConsumer(MODEL_WARMUP_ENABLED, modelWarmup::setEnabled);
+        NeuralStats.instance().registerStatsSupplier("model_warmup", modelWarmup::toMap);
+    }
+
+    /**
+     * Pruning ratio of sparse encoding processors of every ingest pipeline, pipelines that have several such processors
+     * report ratio of each processor in order
+     */
+    private Map<String, Object> getSparseEncodingPruningRatios() {
+        IngestMetadata ingestMetadata = clusterService.state().metadata().custom(IngestMetadata.TYPE);
+        if (Objects.isNull(ingestMetadata) || Objects.isNull(ingestService)) {
+            return Map.of();
+        }
+        Map<String, Object> pruningRatios = new TreeMap<>();
+        for (String pipelineId : ingestMetadata.getPipelines().keySet()) {
+            List<SparseEncodingProcessor> processors;
+            try {
+                processors = ingestService.getProcessorsInPipeline(pipelineId, SparseEncodingProcessor.class);
+            } catch (IllegalArgumentException e) {
+                // pipeline is in cluster state but hasn't been created on this node yet
+                continue;
+            }
+            if (!processors.isEmpty()) {
+                pruningRatios.put(
+                    pipelineId,
+                    processors.stream().map(SparseEncodingProcessor::getPruningRatio).collect(Collectors.toList())
+                );
+            }
+        }
+        return pruningRatios;
+    }
+
+    private void initializeQueryBuilders(final Settings settings, final ThreadPool threadPool) {
+        queryClientAccessor = clientAccessor.withHedging(
+            (delay, command) -> threadPool.schedule(command, TimeValue.timeValueMillis(delay), ThreadPool.Names.GENERIC),
+            QUERY_INFERENCE_HEDGE_DELAY.get(settings)
+        );
+        InferenceBatchDispatcher batchDispatcher = QUERY_INFERENCE_BATCH_ENABLED.get(settings)
+            ? new InferenceBatchDispatcher(
+                queryClientAccessor,
+                threadPool,
+                QUERY_INFERENCE_BATCH_WINDOW.get(settings),
+                QUERY_INFERENCE_BATCH_MAX_SIZE.get(settings),
+                QUERY_INFERENCE_BATCH_MAX_QUEUE_DEPTH.get(settings)
+            )
+            : null;
+        ByteSizeValue inferenceCacheSize = QUERY_INFERENCE_CACHE_SIZE.get(settings);
+        if (inferenceCacheSize.getBytes() <= 0) {
+            NeuralQueryBuilder.initialize(queryClientAccessor, null, batchDispatcher);
+            NeuralSparseQueryBuilder.initialize(queryClientAccessor);
+            return;
+        }
+        // dense and sparse results are kept in separate caches, each gets half of the configured memory
+        ByteSizeValue cacheSizePerQueryType = new ByteSizeValue(inferenceCacheSize.getBytes() / 2);
+        TimeValue expireAfterWrite = QUERY_INFERENCE_CACHE_EXPIRE.get(settings);
+        InferenceResultCache<float[]> denseCache = new InferenceResultCache<>(
+            cacheSizePerQueryType,
+            expireAfterWrite,
+            RamUsageEstimator::sizeOf
+        );
+        InferenceResultCache<Map<String, Float>> sparseCache = new InferenceResultCache<>(
+            cacheSizePerQueryType,
+            expireAfterWrite,
+            RamUsageEstimator::sizeOfMap
+        );
+        NeuralQueryBuilder.initialize(queryClientAccessor, denseCache, batchDispatcher);
+        NeuralSparseQueryBuilder.initialize(queryClientAccessor, sparseCache);
+        registerCacheStats("neural_query_inference_cache", denseCache::count, denseCache::weight, denseCache::stats);
+        registerCacheStats("neural_sparse_query_inference_cache", sparseCache::count, sparseCache::weight, sparseCache::stats);
+    }
+
+    private void registerCacheStats(
+        final String name,
+        final IntSupplier count,
+        final LongSupplier memorySizeInBytes,
+        final Supplier<Cache.CacheStats> cacheStats
+    ) {
+        NeuralStats.instance()
+            .registerStatsSupplier(name, () -> NeuralStats.cacheStats(count.getAsInt(), memorySizeInBytes.getAsLong(), cacheStats.get()));
+    }
+
     @Override
     public List<QuerySpec<?>> getQueries() {
         return Arrays.asList(
@@ -119,12 +290,29 @@ public class NeuralSearch extends Plugin implements ActionPlugin, SearchPlugin,
 
     @Override
     public Map<String, Processor.Factory> getProcessors(Processor.Parameters parameters) {
-        clientAccessor = new MLCommonsClientAccessor(new MachineLearningNodeClient(parameters.client));
+        ingestService = parameters.ingestService;
+        clientAccessor = new MLCommonsClientAccessor(
+            new MachineLearningNodeClient(parameters.client),
+            createInferenceConcurrencyLimiter(parameters.env.settings()),
+            parameters.scheduler,
+            null
+        );
+        InferenceResultCache<Object> ingestInferenceCache = createIngestInferenceCache(parameters.env.settings());
         return Map.of(
             TextEmbeddingProcessor.TYPE,
-            new TextEmbeddingProcessorFactory(clientAccessor, parameters.env, parameters.ingestService.getClusterService()),
+            new TextEmbeddingProcessorFactory(
+                clientAccessor,
+                parameters.env,
+                parameters.ingestService.getClusterService(),
+                ingestInferenceCache
+            ),
             SparseEncodingProcessor.TYPE,
-            new SparseEncodingProcessorFactory(clientAccessor, parameters.env, parameters.ingestService.getClusterService()),
+            new SparseEncodingProcessorFactory(
+                clientAccessor,
+                parameters.env,
+                parameters.ingestService.getClusterService(),
+                ingestInferenceCache
+            ),
             TextImageEmbeddingProcessor.TYPE,
             new TextImageEmbeddingProcessorFactory(clientAccessor, parameters.env, parameters.ingestService.getClusterService()),
             TextChunkingProcessor.TYPE,
@@ -132,6 +320,32 @@ public class NeuralSearch extends Plugin implements ActionPlugin, SearchPlugin,
         );
     }
 
+    private InferenceConcurrencyLimiter createInferenceConcurrencyLimiter(final Settings settings) {
+        if (!INFERENCE_CONCURRENCY_LIMIT_ENABLED.get(settings)) {
+            return null;
+        }
+        return new InferenceConcurrencyLimiter(
+            INFERENCE_CONCURRENCY_LIMIT_INITIAL.get(settings),
+            INFERENCE_CONCURRENCY_LIMIT_MAX.get(settings),
+            INFERENCE_CONCURRENCY_LIMIT_MAX_QUEUE_SIZE.get(settings)
+        );
+    }
+
+    private InferenceResultCache<Object> createIngestInferenceCache(final Settings settings) {
+        ByteSizeValue inferenceCacheSize = INGEST_INFERENCE_CACHE_SIZE.get(settings);
+        if (inferenceCacheSize.getBytes() <= 0) {
+            return null;
+        }
+        // dense vectors and sparse token maps share one cache, keys include the processor type
+        InferenceResultCache<Object> inferenceCache = new InferenceResultCache<Object>(
+            inferenceCacheSize,
+            INGEST_INFERENCE_CACHE_EXPIRE.get(settings),
+            RamUsageEstimator::sizeOfObject
+        );
+        registerCacheStats("ingest_inference_cache", inferenceCache::count, inferenceCache::weight, inferenceCache::stats);
+        return inferenceCache;
+    }
+
     @Override
     public Optional<QueryPhaseSearcher> getQueryPhaseSearcher() {
         // we're using "is_disabled" flag as there are no proper implementation of FeatureFlags.isDisabled(). Both
@@ -148,6 +362,12 @@ public class NeuralSearch extends Plugin implements ActionPlugin, SearchPlugin,
         return Optional.of(new HybridQueryPhaseSearcher());
     }
 
+    @Override
+    public void onIndexModule(final IndexModule indexModule) {
+        // hybrid query results read from the shard request cache need the same preparation for fetch as fresh ones
+        indexModule.addSearchOperationListener(new HybridQuerySearchOperationListener());
+    }
+
     @Override
     public Map<String, org.opensearch.search.pipeline.Processor.Factory<SearchPhaseResultsProcessor>> getSearchPhaseResultsProcessors(
         Parameters parameters
@@ -160,7 +380,37 @@ public class NeuralSearch extends Plugin implements ActionPlugin, SearchPlugin,
 
     @Override
     public List<Setting<?>> getSettings() {
-        return List.of(NEURAL_SEARCH_HYBRID_SEARCH_DISABLED, RERANKER_MAX_DOC_FIELDS);
+        return List.of(
+            NEURAL_SEARCH_HYBRID_SEARCH_DISABLED,
+            RERANKER_MAX_DOC_FIELDS,
+            QUERY_INFERENCE_CACHE_SIZE,
+            QUERY_INFERENCE_CACHE_EXPIRE,
+            QUERY_INFERENCE_BATCH_ENABLED,
+            QUERY_INFERENCE_BATCH_WINDOW,
+            QUERY_INFERENCE_BATCH_MAX_SIZE,
+            QUERY_INFERENCE_BATCH_MAX_QUEUE_DEPTH,
+            INGEST_INFERENCE_BATCH_MAX_SIZE,
+            INGEST_INFERENCE_BATCH_MAX_CHARS,
+            INGEST_INFERENCE_BATCH_MAX_IN_FLIGHT,
+            INGEST_INFERENCE_CACHE_SIZE,
+            INGEST_INFERENCE_CACHE_EXPIRE,
+            RERANK_SCORE_CACHE_SIZE,
+            RERANK_SCORE_CACHE_EXPIRE,
+            INFERENCE_CONCURRENCY_LIMIT_ENABLED,
+            INFERENCE_CONCURRENCY_LIMIT_INITIAL,
+            INFERENCE_CONCURRENCY_LIMIT_MAX,
+            INFERENCE_CONCURRENCY_LIMIT_MAX_QUEUE_SIZE,
+            QUERY_INFERENCE_HEDGE_DELAY,
+            NEURAL_SEARCH_STATS_ENABLED,
+            HYBRID_SEARCH_SHARD_WINDOW_ENABLED,
+            HYBRID_SEARCH_SHARD_WINDOW_FACTOR,
+            HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST,
+            MODEL_WARMUP_ENABLED,
+            MODEL_WARMUP_TEXT,
+            MODEL_WARMUP_INFERENCES,
+            MODEL_WARMUP_RETRY_DELAY,
+            MODEL_WARMUP_MAX_ATTEMPTS
+        );
     }
 
     @Override
@@ -181,10 +431,42 @@ public class NeuralSearch extends Plugin implements ActionPlugin, SearchPlugin,
     ) {
         return Map.of(
             RerankProcessor.TYPE,
-            new RerankProcessorFactory(clientAccessor, parameters.searchPipelineService.getClusterService())
+            new RerankProcessorFactory(
+                queryClientAccessor,
+                parameters.searchPipelineService.getClusterService(),
+                createRerankScoreCache(parameters.env.settings())
+            )
         );
     }
 
+    private RerankScoreCache createRerankScoreCache(final Settings settings) {
+        ByteSizeValue scoreCacheSize = RERANK_SCORE_CACHE_SIZE.get(settings);
+        if (scoreCacheSize.getBytes() <= 0) {
+            return null;
+        }
+        RerankScoreCache scoreCache = new RerankScoreCache(scoreCacheSize, RERANK_SCORE_CACHE_EXPIRE.get(settings));
+        registerCacheStats("rerank_score_cache", scoreCache::count, scoreCache::weight, scoreCache::stats);
+        return scoreCache;
+    }
+
+    @Override
+    public List<ActionHandler<? extends ActionRequest, ? extends ActionResponse>> getActions() {
+        return List.of(new ActionHandler<>(NeuralStatsAction.INSTANCE, NeuralStatsTransportAction.class));
+    }
+
+    @Override
+    public List<RestHandler> getRestHandlers(
+        final Settings settings,
+        final RestController restController,
+        final ClusterSettings clusterSettings,
+        final IndexScopedSettings indexScopedSettings,
+        final SettingsFilter settingsFilter,
+        final IndexNameExpressionResolver indexNameExpressionResolver,
+        final Supplier<DiscoveryNodes> nodesInCluster
+    ) {
+        return List.of(new RestNeuralStatsHandler(), new RestModelWarmupHandler(modelWarmup));
+    }
+
     @Override
     public List<SearchPlugin.SearchExtSpec<?>> getSearchExts() {
         return List.of(
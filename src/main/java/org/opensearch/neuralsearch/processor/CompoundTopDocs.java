@@ -4,14 +4,11 @@
  */
 package org.opensearch.neuralsearch.processor;
 
-import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQueryDelimiterElement;
-import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQueryStartStopElement;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.getSubQueryTopDocs;
 
 import java.util.ArrayList;
-import java.util.Arrays;
 import java.util.List;
 import java.util.Objects;
-import java.util.stream.Collectors;
 
 import org.apache.lucene.search.ScoreDoc;
 import org.apache.lucene.search.TopDocs;
@@ -80,21 +77,7 @@ public class CompoundTopDocs {
             return;
         }
         // skipping first two elements, it's a start-stop element and delimiter for first series
-        List<TopDocs> topDocsList = new ArrayList<>();
-        List<ScoreDoc> scoreDocList = new ArrayList<>();
-        for (int index = 2; index < scoreDocs.length; index++) {
-            // getting first element of score's series
-            ScoreDoc scoreDoc = scoreDocs[index];
-            if (isHybridQueryDelimiterElement(scoreDoc) || isHybridQueryStartStopElement(scoreDoc)) {
-                ScoreDoc[] subQueryScores = scoreDocList.toArray(new ScoreDoc[0]);
-                TotalHits totalHits = new TotalHits(subQueryScores.length, TotalHits.Relation.EQUAL_TO);
-                TopDocs subQueryTopDocs = new TopDocs(totalHits, subQueryScores);
-                topDocsList.add(subQueryTopDocs);
-                scoreDocList.clear();
-            } else {
-                scoreDocList.add(scoreDoc);
-            }
-        }
+        List<TopDocs> topDocsList = getSubQueryTopDocs(scoreDocs);
         initialize(topDocs.totalHits, topDocsList);
     }
 
@@ -114,6 +97,10 @@ public class CompoundTopDocs {
             }
         }
         // do deep copy
-        return Arrays.stream(maxScoreDocs).map(doc -> new ScoreDoc(doc.doc, doc.score, doc.shardIndex)).collect(Collectors.toList());
+        List<ScoreDoc> scoreDocs = new ArrayList<>(maxScoreDocs.length);
+        for (ScoreDoc scoreDoc : maxScoreDocs) {
+            scoreDocs.add(new ScoreDoc(scoreDoc.doc, scoreDoc.score, scoreDoc.shardIndex));
+        }
+        return scoreDocs;
     }
 }
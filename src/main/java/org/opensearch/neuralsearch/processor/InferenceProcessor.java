@@ -4,6 +4,10 @@
  */
 package org.opensearch.neuralsearch.processor;
 
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_BATCH_MAX_CHARS;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_BATCH_MAX_IN_FLIGHT;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_BATCH_MAX_SIZE;
+
 import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Collections;
@@ -11,8 +15,10 @@ import java.util.Comparator;
 import java.util.HashMap;
 import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Locale;
 import java.util.Map;
 import java.util.Objects;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.BiConsumer;
 import java.util.function.Consumer;
 import java.util.stream.Collectors;
@@ -24,12 +30,17 @@ import org.apache.commons.lang3.StringUtils;
 import org.opensearch.common.collect.Tuple;
 import org.opensearch.core.common.util.CollectionUtils;
 import org.opensearch.cluster.service.ClusterService;
+import org.opensearch.common.settings.Settings;
 import org.opensearch.env.Environment;
 import org.opensearch.index.mapper.IndexFieldMapper;
 import org.opensearch.ingest.AbstractProcessor;
 import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
+import org.opensearch.neuralsearch.common.FloatArrayList;
+import org.opensearch.neuralsearch.ml.InferenceCacheKey;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
+import org.opensearch.neuralsearch.stats.NeuralStats;
 
 import com.google.common.annotations.VisibleForTesting;
 import com.google.common.collect.ImmutableMap;
@@ -63,6 +74,13 @@ public abstract class InferenceProcessor extends AbstractProcessor {
     private final Environment environment;
     private final ClusterService clusterService;
 
+    // node level cache of batch inference results, null when the cache is disabled
+    private final InferenceResultCache<Object> inferenceResultCache;
+    private final List<String> inferenceCacheResponseFilters;
+    // names of stats are resolved once per processor, they include the processor type
+    private final String inferenceTimeStat;
+    private final String inferenceBatchSizeStat;
+
     public InferenceProcessor(
         String tag,
         String description,
@@ -73,6 +91,21 @@ public abstract class InferenceProcessor extends AbstractProcessor {
         MLCommonsClientAccessor clientAccessor,
         Environment environment,
         ClusterService clusterService
+    ) {
+        this(tag, description, type, listTypeNestedMapKey, modelId, fieldMap, clientAccessor, environment, clusterService, null);
+    }
+
+    public InferenceProcessor(
+        String tag,
+        String description,
+        String type,
+        String listTypeNestedMapKey,
+        String modelId,
+        Map<String, Object> fieldMap,
+        MLCommonsClientAccessor clientAccessor,
+        Environment environment,
+        ClusterService clusterService,
+        InferenceResultCache<Object> inferenceResultCache
     ) {
         super(tag, description);
         this.type = type;
@@ -84,6 +117,11 @@ public abstract class InferenceProcessor extends AbstractProcessor {
         this.mlCommonsClientAccessor = clientAccessor;
         this.environment = environment;
         this.clusterService = clusterService;
+        this.inferenceResultCache = inferenceResultCache;
+        // result of the same model differs between processor types, e.g. dense vs sparse embedding
+        this.inferenceCacheResponseFilters = List.of(type);
+        this.inferenceTimeStat = NeuralStats.INGEST_INFERENCE_TIME_PREFIX + type;
+        this.inferenceBatchSizeStat = NeuralStats.INGEST_INFERENCE_BATCH_SIZE_PREFIX + type;
     }
 
     private void validateEmbeddingConfiguration(Map<String, Object> fieldMap) {
@@ -125,13 +163,25 @@ public abstract class InferenceProcessor extends AbstractProcessor {
             if (inferenceList.size() == 0) {
                 handler.accept(ingestDocument, null);
             } else {
-                doExecute(ingestDocument, processMap, inferenceList, handler);
+                long startNanos = NeuralStats.instance().startTimer();
+                NeuralStats.instance().recordSize(inferenceBatchSizeStat, inferenceList.size());
+                doExecute(ingestDocument, processMap, inferenceList, timedHandler(handler, startNanos));
             }
         } catch (Exception e) {
             handler.accept(null, e);
         }
     }
 
+    private BiConsumer<IngestDocument, Exception> timedHandler(final BiConsumer<IngestDocument, Exception> handler, final long startNanos) {
+        if (startNanos == NeuralStats.DISABLED_TIMER) {
+            return handler;
+        }
+        return (document, exception) -> {
+            NeuralStats.instance().recordTime(inferenceTimeStat, startNanos);
+            handler.accept(document, exception);
+        };
+    }
+
     /**
      * This is the function which does actual inference work for batchExecute interface.
      * @param inferenceList a list of String for inference.
@@ -153,36 +203,16 @@ public abstract class InferenceProcessor extends AbstractProcessor {
             handler.accept(ingestDocumentWrappers);
             return;
         }
-        Tuple<List<String>, Map<Integer, Integer>> sortedResult = sortByLengthAndReturnOriginalOrder(inferenceList);
-        inferenceList = sortedResult.v1();
-        Map<Integer, Integer> originalOrder = sortedResult.v2();
-        doBatchExecute(inferenceList, results -> {
-            int startIndex = 0;
-            results = restoreToOriginalOrder(results, originalOrder);
-            for (DataForInference dataForInference : dataForInferences) {
-                if (dataForInference.getIngestDocumentWrapper().getException() != null
-                    || CollectionUtils.isEmpty(dataForInference.getInferenceList())) {
-                    continue;
-                }
-                List<?> inferenceResults = results.subList(startIndex, startIndex + dataForInference.getInferenceList().size());
-                startIndex += dataForInference.getInferenceList().size();
-                setVectorFieldsToDocument(
-                    dataForInference.getIngestDocumentWrapper().getIngestDocument(),
-                    dataForInference.getProcessMap(),
-                    inferenceResults
-                );
-            }
-            handler.accept(ingestDocumentWrappers);
-        }, exception -> {
-            for (IngestDocumentWrapper ingestDocumentWrapper : ingestDocumentWrappers) {
-                // The IngestDocumentWrapper might already run into exception and not sent for inference. So here we only
-                // set exception to IngestDocumentWrapper which doesn't have exception before.
-                if (ingestDocumentWrapper.getException() == null) {
-                    ingestDocumentWrapper.update(ingestDocumentWrapper.getIngestDocument(), exception);
-                }
-            }
-            handler.accept(ingestDocumentWrappers);
-        });
+        Settings settings = environment.settings();
+        new SubBatchExecution(
+            ingestDocumentWrappers,
+            dataForInferences,
+            inferenceList,
+            INGEST_INFERENCE_BATCH_MAX_SIZE.get(settings),
+            INGEST_INFERENCE_BATCH_MAX_CHARS.get(settings),
+            INGEST_INFERENCE_BATCH_MAX_IN_FLIGHT.get(settings),
+            handler
+        ).start();
     }
 
     private Tuple<List<String>, Map<Integer, Integer>> sortByLengthAndReturnOriginalOrder(List<String> inferenceList) {
@@ -199,16 +229,6 @@ public abstract class InferenceProcessor extends AbstractProcessor {
         return Tuple.tuple(sortedInferenceList, originalOrderMap);
     }
 
-    private List<?> restoreToOriginalOrder(List<?> results, Map<Integer, Integer> originalOrder) {
-        List<Object> sortedResults = Arrays.asList(results.toArray());
-        for (int i = 0; i < results.size(); ++i) {
-            if (!originalOrder.containsKey(i)) continue;
-            int oldIndex = originalOrder.get(i);
-            sortedResults.set(oldIndex, results.get(i));
-        }
-        return sortedResults;
-    }
-
     private List<String> constructInferenceTexts(List<DataForInference> dataForInferences) {
         List<String> inferenceTexts = new ArrayList<>();
         for (DataForInference dataForInference : dataForInferences) {
@@ -247,6 +267,315 @@ public abstract class InferenceProcessor extends AbstractProcessor {
         private final List<String> inferenceList;
     }
 
+    /**
+     * Runs inference for one batch of documents. Identical texts are sent to the model once and texts with a cached result
+     * are not sent at all. Remaining texts sorted by length are split into sub-batches limited by number of texts and total
+     * length, only a limited number of sub-batches is sent to the model at the same time. Document gets its inference results
+     * as soon as all sub-batches with its texts are completed, so results of the whole batch are never held in memory at once.
+     */
+    private final class SubBatchExecution {
+        private final List<IngestDocumentWrapper> ingestDocumentWrappers;
+        private final Consumer<List<IngestDocumentWrapper>> handler;
+        private final int maxInFlight;
+        // texts are identified by index in the list of unique texts, every unique text has a linked list of targets - indexes
+        // in the original inference list, each target is resolved to a document and position of the text in that document
+        private final List<String> uniqueTexts = new ArrayList<>();
+        private final int[] firstTargetByUniqueIndex;
+        private final int[] nextTargetByTarget;
+        private final DocumentResults[] documentResultsByTarget;
+        private final int[] positionInDocumentByTarget;
+        private final Object[] cachedResultByUniqueIndex;
+        // unique texts that need inference, sorted by length
+        private final List<String> sortedInferenceList;
+        private final int[] uniqueIndexBySortedIndex;
+        // ranges of sorted inference list, each range is [start, end)
+        private final List<int[]> subBatches = new ArrayList<>();
+        private final AtomicInteger dispatchRequests = new AtomicInteger();
+        private int nextSubBatch;
+        private int subBatchesInFlight;
+        private int completedSubBatches;
+
+        SubBatchExecution(
+            final List<IngestDocumentWrapper> ingestDocumentWrappers,
+            final List<DataForInference> dataForInferences,
+            final List<String> inferenceList,
+            final int maxBatchSize,
+            final int maxBatchChars,
+            final int maxInFlight,
+            final Consumer<List<IngestDocumentWrapper>> handler
+        ) {
+            this.ingestDocumentWrappers = ingestDocumentWrappers;
+            this.maxInFlight = maxInFlight;
+            this.handler = handler;
+
+            // texts are taken from documents in the same order as in constructInferenceTexts
+            int textCount = inferenceList.size();
+            this.documentResultsByTarget = new DocumentResults[textCount];
+            this.positionInDocumentByTarget = new int[textCount];
+            int target = 0;
+            for (DataForInference dataForInference : dataForInferences) {
+                if (dataForInference.getIngestDocumentWrapper().getException() != null
+                    || CollectionUtils.isEmpty(dataForInference.getInferenceList())) {
+                    continue;
+                }
+                DocumentResults documentResults = new DocumentResults(dataForInference);
+                for (int i = 0; i < dataForInference.getInferenceList().size(); i++) {
+                    documentResultsByTarget[target] = documentResults;
+                    positionInDocumentByTarget[target] = i;
+                    target++;
+                }
+            }
+
+            this.firstTargetByUniqueIndex = new int[textCount];
+            this.nextTargetByTarget = new int[textCount];
+            Map<String, Integer> uniqueIndexByText = new HashMap<>();
+            for (int i = 0; i < textCount; i++) {
+                Integer uniqueIndex = uniqueIndexByText.putIfAbsent(inferenceList.get(i), uniqueTexts.size());
+                if (uniqueIndex == null) {
+                    uniqueIndex = uniqueTexts.size();
+                    uniqueTexts.add(inferenceList.get(i));
+                    nextTargetByTarget[i] = -1;
+                } else {
+                    nextTargetByTarget[i] = firstTargetByUniqueIndex[uniqueIndex];
+                }
+                firstTargetByUniqueIndex[uniqueIndex] = i;
+            }
+
+            this.cachedResultByUniqueIndex = new Object[uniqueTexts.size()];
+            List<String> textsToInfer = new ArrayList<>();
+            List<Integer> uniqueIndexByTextToInfer = new ArrayList<>();
+            for (int i = 0; i < uniqueTexts.size(); i++) {
+                if (inferenceResultCache != null) {
+                    cachedResultByUniqueIndex[i] = inferenceResultCache.get(inferenceCacheKey(uniqueTexts.get(i)));
+                }
+                if (cachedResultByUniqueIndex[i] == null) {
+                    textsToInfer.add(uniqueTexts.get(i));
+                    uniqueIndexByTextToInfer.add(i);
+                }
+            }
+            Tuple<List<String>, Map<Integer, Integer>> sortedResult = sortByLengthAndReturnOriginalOrder(textsToInfer);
+            this.sortedInferenceList = sortedResult.v1();
+            this.uniqueIndexBySortedIndex = new int[sortedInferenceList.size()];
+            for (int i = 0; i < sortedInferenceList.size(); i++) {
+                uniqueIndexBySortedIndex[i] = uniqueIndexByTextToInfer.get(sortedResult.v2().get(i));
+            }
+
+            int start = 0;
+            long batchChars = 0;
+            for (int i = 0; i < sortedInferenceList.size(); i++) {
+                int textLength = sortedInferenceList.get(i).length();
+                boolean exceedsSize = i - start >= maxBatchSize;
+                boolean exceedsChars = maxBatchChars > 0 && i > start && batchChars + textLength > maxBatchChars;
+                if (exceedsSize || exceedsChars) {
+                    subBatches.add(new int[] { start, i });
+                    start = i;
+                    batchChars = 0;
+                }
+                batchChars += textLength;
+            }
+            if (start < sortedInferenceList.size()) {
+                subBatches.add(new int[] { start, sortedInferenceList.size() });
+            }
+        }
+
+        void start() {
+            for (int i = 0; i < cachedResultByUniqueIndex.length; i++) {
+                if (cachedResultByUniqueIndex[i] != null) {
+                    // cached result must stay unchanged, every document gets its own copy
+                    setResult(i, cachedResultByUniqueIndex[i], true);
+                    cachedResultByUniqueIndex[i] = null;
+                }
+            }
+            if (subBatches.isEmpty()) {
+                handler.accept(ingestDocumentWrappers);
+                return;
+            }
+            dispatch();
+        }
+
+        private void dispatch() {
+            // sub-batch may complete on the calling thread, in such case the loop below sends next sub-batches
+            // instead of going into recursion
+            if (dispatchRequests.getAndIncrement() > 0) {
+                return;
+            }
+            do {
+                int[] subBatch;
+                while ((subBatch = pollNextSubBatch()) != null) {
+                    execute(subBatch);
+                }
+            } while (dispatchRequests.decrementAndGet() > 0);
+        }
+
+        private synchronized int[] pollNextSubBatch() {
+            if (subBatchesInFlight >= maxInFlight || nextSubBatch >= subBatches.size()) {
+                return null;
+            }
+            subBatchesInFlight++;
+            return subBatches.get(nextSubBatch++);
+        }
+
+        private void execute(final int[] subBatch) {
+            long startNanos = NeuralStats.instance().startTimer();
+            NeuralStats.instance().recordSize(inferenceBatchSizeStat, subBatch[1] - subBatch[0]);
+            try {
+                doBatchExecute(sortedInferenceList.subList(subBatch[0], subBatch[1]), results -> {
+                    NeuralStats.instance().recordTime(inferenceTimeStat, startNanos);
+                    onSubBatchResponse(subBatch, results);
+                }, exception -> {
+                    NeuralStats.instance().recordTime(inferenceTimeStat, startNanos);
+                    onSubBatchFailure(subBatch, exception);
+                });
+            } catch (Exception e) {
+                onSubBatchFailure(subBatch, e);
+            }
+        }
+
+        private void onSubBatchResponse(final int[] subBatch, final List<?> results) {
+            if (results == null || results.size() < subBatch[1] - subBatch[0]) {
+                onSubBatchFailure(
+                    subBatch,
+                    new IllegalStateException(
+                        String.format(
+                            Locale.ROOT,
+                            "Unexpected number of inference results. Expected [%d] results to be returned, but got [%d]",
+                            subBatch[1] - subBatch[0],
+                            results == null ? 0 : results.size()
+                        )
+                    )
+                );
+                return;
+            }
+            if (inferenceResultCache != null) {
+                for (int i = subBatch[0]; i < subBatch[1]; i++) {
+                    Object result = results.get(i - subBatch[0]);
+                    if (result != null) {
+                        inferenceResultCache.put(inferenceCacheKey(sortedInferenceList.get(i)), copyInferenceResult(result));
+                    }
+                }
+            }
+            boolean completed;
+            synchronized (this) {
+                for (int i = subBatch[0]; i < subBatch[1]; i++) {
+                    setResult(uniqueIndexBySortedIndex[i], results.get(i - subBatch[0]), false);
+                }
+                completed = onSubBatchCompleted();
+            }
+            onAfterSubBatch(completed);
+        }
+
+        private void onSubBatchFailure(final int[] subBatch, final Exception exception) {
+            boolean completed;
+            synchronized (this) {
+                for (int i = subBatch[0]; i < subBatch[1]; i++) {
+                    int uniqueIndex = uniqueIndexBySortedIndex[i];
+                    for (int target = firstTargetByUniqueIndex[uniqueIndex]; target >= 0; target = nextTargetByTarget[target]) {
+                        documentResultsByTarget[target].setFailure(exception);
+                    }
+                }
+                completed = onSubBatchCompleted();
+            }
+            onAfterSubBatch(completed);
+        }
+
+        private void setResult(final int uniqueIndex, final Object result, final boolean copyForEveryTarget) {
+            for (int target = firstTargetByUniqueIndex[uniqueIndex]; target >= 0; target = nextTargetByTarget[target]) {
+                // documents must not share result objects, last target takes the original result
+                boolean copy = copyForEveryTarget || nextTargetByTarget[target] >= 0;
+                documentResultsByTarget[target].setResult(positionInDocumentByTarget[target], copy ? copyInferenceResult(result) : result);
+            }
+        }
+
+        private boolean onSubBatchCompleted() {
+            subBatchesInFlight--;
+            completedSubBatches++;
+            return completedSubBatches == subBatches.size();
+        }
+
+        private void onAfterSubBatch(final boolean completed) {
+            if (completed) {
+                handler.accept(ingestDocumentWrappers);
+            } else {
+                dispatch();
+            }
+        }
+    }
+
+    /**
+     * Collects inference results of one document, results are set to the document once all of them are received
+     */
+    private final class DocumentResults {
+        private final DataForInference dataForInference;
+        private Object[] results;
+        private int pendingResults;
+
+        DocumentResults(final DataForInference dataForInference) {
+            this.dataForInference = dataForInference;
+            this.pendingResults = dataForInference.getInferenceList().size();
+            this.results = new Object[pendingResults];
+        }
+
+        void setResult(final int position, final Object result) {
+            if (results == null) {
+                return;
+            }
+            results[position] = result;
+            if (--pendingResults > 0) {
+                return;
+            }
+            IngestDocumentWrapper ingestDocumentWrapper = dataForInference.getIngestDocumentWrapper();
+            try {
+                setVectorFieldsToDocument(
+                    ingestDocumentWrapper.getIngestDocument(),
+                    dataForInference.getProcessMap(),
+                    Arrays.asList(results)
+                );
+            } catch (Exception e) {
+                ingestDocumentWrapper.update(ingestDocumentWrapper.getIngestDocument(), e);
+            }
+            results = null;
+        }
+
+        void setFailure(final Exception exception) {
+            if (results == null) {
+                return;
+            }
+            IngestDocumentWrapper ingestDocumentWrapper = dataForInference.getIngestDocumentWrapper();
+            ingestDocumentWrapper.update(ingestDocumentWrapper.getIngestDocument(), exception);
+            results = null;
+        }
+    }
+
+    private InferenceCacheKey inferenceCacheKey(final String text) {
+        return InferenceCacheKey.ofHashedText(modelId, text, getInferenceCacheResponseFilters());
+    }
+
+    /**
+     * Identifies the shape of inference results of this processor in the cache, processors that post-process model output
+     * must include their parameters so different results of the same model and text are not mixed
+     * @return list of filters that is part of the cache key
+     */
+    protected List<String> getInferenceCacheResponseFilters() {
+        return inferenceCacheResponseFilters;
+    }
+
+    /**
+     * Copies inference result so it can be set to more than one document or kept in the cache. Vectors are copied
+     * to a compact primitive array, so a copy never holds the array of a whole model response.
+     */
+    private static Object copyInferenceResult(final Object result) {
+        if (result instanceof FloatArrayList) {
+            return new FloatArrayList(((FloatArrayList) result).toFloatArray());
+        }
+        if (result instanceof List) {
+            return new ArrayList<>((List<?>) result);
+        }
+        if (result instanceof Map) {
+            return new HashMap<>((Map<?, ?>) result);
+        }
+        return result;
+    }
+
     @SuppressWarnings({ "unchecked" })
     private List<String> createInferenceList(Map<String, Object> knnKeyMap) {
         List<String> texts = new ArrayList<>();
@@ -8,11 +8,14 @@ import com.google.common.collect.ArrayListMultimap;
 import com.google.common.collect.Multimap;
 import lombok.Getter;
 import lombok.Setter;
+import org.apache.lucene.search.BooleanClause;
 import org.opensearch.action.search.SearchRequest;
 import org.opensearch.common.collect.Tuple;
 import org.opensearch.index.query.BoolQueryBuilder;
 import org.opensearch.index.query.QueryBuilder;
+import org.opensearch.index.query.QueryBuilderVisitor;
 import org.opensearch.ingest.ConfigurationUtils;
+import org.opensearch.neuralsearch.query.HybridQueryBuilder;
 import org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder;
 import org.opensearch.search.builder.SearchSourceBuilder;
 import org.opensearch.search.pipeline.AbstractProcessor;
@@ -21,7 +24,9 @@ import org.opensearch.search.pipeline.SearchRequestProcessor;
 import org.opensearch.search.rescore.QueryRescorerBuilder;
 import org.opensearch.search.rescore.RescorerBuilder;
 
+import java.util.ArrayList;
 import java.util.Collections;
+import java.util.List;
 import java.util.Locale;
 import java.util.Map;
 import java.util.Objects;
@@ -29,7 +34,8 @@ import java.util.stream.Collectors;
 
 /**
  * A SearchRequestProcessor to generate two-phase NeuralSparseQueryBuilder,
- * and add it to the Rescore of a searchRequest.
+ * and add it to the Rescore of a searchRequest. Neural sparse queries that can't be rescored at top level, e.g. sub-queries
+ * of hybrid query, split their tokens into clause that drives matching and clause that only scores matched docs.
  */
 @Setter
 @Getter
@@ -97,18 +103,36 @@ public class NeuralSparseTwoPhaseProcessor extends AbstractProcessor implements
             return request;
         }
         QueryBuilder queryBuilder = request.source().query();
-        // Collect the nested NeuralSparseQueryBuilder in the whole query.
-        Multimap<NeuralSparseQueryBuilder, Float> queryBuilderMap;
-        queryBuilderMap = collectNeuralSparseQueryBuilder(queryBuilder, 1.0f);
-        if (queryBuilderMap.isEmpty()) {
+        if (Objects.isNull(queryBuilder)) {
             return request;
         }
-        // Make a nestedQueryBuilder which includes all the two-phase QueryBuilder.
-        QueryBuilder nestedTwoPhaseQueryBuilder = getNestedQueryBuilderFromNeuralSparseQueryBuilderMap(queryBuilderMap);
-        nestedTwoPhaseQueryBuilder.boost(getOriginQueryWeightAfterRescore(request.source()));
-        // Add it to the rescorer.
-        RescorerBuilder<QueryRescorerBuilder> twoPhaseRescorer = buildRescoreQueryBuilderForTwoPhase(nestedTwoPhaseQueryBuilder, request);
-        request.source().addRescorer(twoPhaseRescorer);
+        QueryBuilderCollector queryBuilderCollector = new QueryBuilderCollector();
+        queryBuilder.visit(queryBuilderCollector);
+        // results of hybrid query can't be rescored, all its neural sparse queries run two-phase within the query
+        boolean isHybridQuery = queryBuilderCollector.queryBuilders.stream().anyMatch(HybridQueryBuilder.class::isInstance);
+        // Collect the nested NeuralSparseQueryBuilder in the whole query.
+        Multimap<NeuralSparseQueryBuilder, Float> queryBuilderMap = isHybridQuery
+            ? ArrayListMultimap.create()
+            : collectNeuralSparseQueryBuilder(queryBuilder, 1.0f);
+        if (!queryBuilderMap.isEmpty()) {
+            // Make a nestedQueryBuilder which includes all the two-phase QueryBuilder.
+            QueryBuilder nestedTwoPhaseQueryBuilder = getNestedQueryBuilderFromNeuralSparseQueryBuilderMap(queryBuilderMap);
+            nestedTwoPhaseQueryBuilder.boost(getOriginQueryWeightAfterRescore(request.source()));
+            // Add it to the rescorer.
+            RescorerBuilder<QueryRescorerBuilder> twoPhaseRescorer = buildRescoreQueryBuilderForTwoPhase(
+                nestedTwoPhaseQueryBuilder,
+                request
+            );
+            request.source().addRescorer(twoPhaseRescorer);
+        }
+        // neural sparse queries that are not collected for the rescorer, e.g. hybrid sub-queries, must clauses or queries
+        // nested in other compound queries, split their tokens within the query. Split changes which docs match, so it's
+        // applied only where the query scores docs, never to queries that filter or exclude docs
+        for (NeuralSparseQueryBuilder neuralSparseQueryBuilder : queryBuilderCollector.scoringNeuralSparseQueryBuilders) {
+            if (neuralSparseQueryBuilder.twoPhasePruneRatio() == 0f) {
+                neuralSparseQueryBuilder.inlineTwoPhasePruneRatio(ratio);
+            }
+        }
         return request;
     }
 
@@ -261,4 +285,43 @@ public class NeuralSparseTwoPhaseProcessor extends AbstractProcessor implements
         }
     }
 
+    /**
+     * Visitor that collects every query builder of the query tree and neural sparse queries that contribute to the score,
+     * i.e. are not inside of a filter or must_not clause
+     */
+    private static final class QueryBuilderCollector implements QueryBuilderVisitor {
+        private final List<QueryBuilder> queryBuilders;
+        private final List<NeuralSparseQueryBuilder> scoringNeuralSparseQueryBuilders;
+        private final boolean scoring;
+
+        private QueryBuilderCollector() {
+            this(new ArrayList<>(), new ArrayList<>(), true);
+        }
+
+        private QueryBuilderCollector(
+            final List<QueryBuilder> queryBuilders,
+            final List<NeuralSparseQueryBuilder> scoringNeuralSparseQueryBuilders,
+            final boolean scoring
+        ) {
+            this.queryBuilders = queryBuilders;
+            this.scoringNeuralSparseQueryBuilders = scoringNeuralSparseQueryBuilders;
+            this.scoring = scoring;
+        }
+
+        @Override
+        public void accept(final QueryBuilder queryBuilder) {
+            queryBuilders.add(queryBuilder);
+            if (scoring && queryBuilder instanceof NeuralSparseQueryBuilder) {
+                scoringNeuralSparseQueryBuilders.add((NeuralSparseQueryBuilder) queryBuilder);
+            }
+        }
+
+        @Override
+        public QueryBuilderVisitor getChildVisitor(final BooleanClause.Occur occur) {
+            if (scoring && (occur == BooleanClause.Occur.FILTER || occur == BooleanClause.Occur.MUST_NOT)) {
+                return new QueryBuilderCollector(queryBuilders, scoringNeuralSparseQueryBuilders, false);
+            }
+            return this;
+        }
+    }
 }
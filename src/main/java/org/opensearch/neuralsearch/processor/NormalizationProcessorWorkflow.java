@@ -5,7 +5,7 @@
 package org.opensearch.neuralsearch.processor;
 
 import java.util.Arrays;
-import java.util.HashMap;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Locale;
 import java.util.Map;
@@ -20,6 +20,8 @@ import org.opensearch.neuralsearch.processor.combination.ScoreCombinationTechniq
 import org.opensearch.neuralsearch.processor.combination.ScoreCombiner;
 import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizationTechnique;
 import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizer;
+import org.opensearch.neuralsearch.search.util.HybridSearchProfileUtil;
+import org.opensearch.neuralsearch.stats.NeuralStats;
 import org.opensearch.search.SearchHit;
 import org.opensearch.search.SearchHits;
 import org.opensearch.search.fetch.FetchSearchResult;
@@ -36,6 +38,11 @@ import lombok.extern.log4j.Log4j2;
 @Log4j2
 public class NormalizationProcessorWorkflow {
 
+    // names of stages in hybrid query profile
+    private static final String NORMALIZE_STAGE = "normalize";
+    private static final String COMBINE_STAGE = "combine";
+    private static final String FETCH_UPDATE_STAGE = "fetch_update";
+
     private final ScoreNormalizer scoreNormalizer;
     private final ScoreCombiner scoreCombiner;
 
@@ -51,25 +58,57 @@ public class NormalizationProcessorWorkflow {
         final ScoreNormalizationTechnique normalizationTechnique,
         final ScoreCombinationTechnique combinationTechnique
     ) {
-        // save original state
-        List<Integer> unprocessedDocIds = unprocessedDocIds(querySearchResults);
+        // save original state, doc ids are needed only to match fetched hits of a single shard
+        int[] unprocessedDocIds = fetchSearchResultOptional.isPresent() ? unprocessedDocIds(querySearchResults) : null;
 
         // pre-process data
         log.debug("Pre-process query results");
         List<CompoundTopDocs> queryTopDocs = getQueryTopDocs(querySearchResults);
 
-        // normalize
-        log.debug("Do score normalization");
-        scoreNormalizer.normalizeScores(queryTopDocs, normalizationTechnique);
+        // normalize, techniques that combine ranks of documents don't need normalized scores
+        // time of every stage is measured for stats and profile, that's a few clock reads per search request
+        Map<String, Long> stageTimesInNanos = new LinkedHashMap<>();
+        long stageStartNanos = System.nanoTime();
+        if (combinationTechnique.usesRanks()) {
+            log.debug("Skip score normalization, combination technique uses ranks of documents");
+        } else {
+            log.debug("Do score normalization");
+            scoreNormalizer.normalizeScores(queryTopDocs, normalizationTechnique);
+            stageStartNanos = recordStageTime(
+                stageTimesInNanos,
+                NORMALIZE_STAGE,
+                NeuralStats.NORMALIZATION_NORMALIZE_TIME,
+                stageStartNanos
+            );
+        }
 
         // combine
         log.debug("Do score combination");
         scoreCombiner.combineScores(queryTopDocs, combinationTechnique);
+        stageStartNanos = recordStageTime(stageTimesInNanos, COMBINE_STAGE, NeuralStats.NORMALIZATION_COMBINE_TIME, stageStartNanos);
 
         // post-process data
         log.debug("Post-process query results after score normalization and combination");
         updateOriginalQueryResults(querySearchResults, queryTopDocs);
-        updateOriginalFetchResults(querySearchResults, fetchSearchResultOptional, unprocessedDocIds);
+        if (fetchSearchResultOptional.isPresent()) {
+            updateOriginalFetchResults(querySearchResults, fetchSearchResultOptional, unprocessedDocIds);
+            recordStageTime(stageTimesInNanos, FETCH_UPDATE_STAGE, NeuralStats.NORMALIZATION_FETCH_UPDATE_TIME, stageStartNanos);
+        }
+        if (HybridSearchProfileUtil.isProfiled(querySearchResults)) {
+            HybridSearchProfileUtil.addHybridProfileBreakdown(querySearchResults, stageTimesInNanos);
+        }
+    }
+
+    private static long recordStageTime(
+        final Map<String, Long> stageTimesInNanos,
+        final String stage,
+        final String statName,
+        final long stageStartNanos
+    ) {
+        long nowNanos = System.nanoTime();
+        stageTimesInNanos.put(stage, nowNanos - stageStartNanos);
+        NeuralStats.instance().recordElapsedTime(statName, nowNanos - stageStartNanos);
+        return nowNanos;
     }
 
     /**
@@ -126,7 +165,7 @@ public class NormalizationProcessorWorkflow {
     private void updateOriginalFetchResults(
         final List<QuerySearchResult> querySearchResults,
         final Optional<FetchSearchResult> fetchSearchResultOptional,
-        final List<Integer> docIds
+        final int[] docIds
     ) {
         if (fetchSearchResultOptional.isEmpty()) {
             return;
@@ -146,26 +185,43 @@ public class NormalizationProcessorWorkflow {
 
         SearchHit[] searchHitArray = getSearchHits(docIds, fetchSearchResult, requestCache);
 
-        // create map of docId to index of search hits. This solves (2), duplicates are from
-        // delimiter and start/stop elements, they all have same valid doc_id. For this map
-        // we use doc_id as a key, and all those special elements are collapsed into a single
-        // key-value pair.
-        Map<Integer, SearchHit> docIdToSearchHit = new HashMap<>();
+        // sort positions of search hits by doc_id. This solves (2), duplicates are from delimiter
+        // and start/stop elements and from different sub-queries, they all have same valid doc_id
+        // and any of their positions points to the same document content. Doc_id and position are
+        // packed into one long, so sorting and lookup work on primitive arrays without boxing.
+        long[] docIdAndPosition = new long[searchHitArray.length];
         for (int i = 0; i < searchHitArray.length; i++) {
-            int originalDocId = docIds.get(i);
-            docIdToSearchHit.put(originalDocId, searchHitArray[i]);
+            docIdAndPosition[i] = ((long) docIds[i] << Integer.SIZE) | i;
+        }
+        Arrays.sort(docIdAndPosition);
+        int[] sortedDocIds = new int[docIdAndPosition.length];
+        int[] positions = new int[docIdAndPosition.length];
+        for (int i = 0; i < docIdAndPosition.length; i++) {
+            sortedDocIds[i] = (int) (docIdAndPosition[i] >>> Integer.SIZE);
+            positions[i] = (int) docIdAndPosition[i];
         }
 
         QuerySearchResult querySearchResult = querySearchResults.get(0);
-        TopDocs topDocs = querySearchResult.topDocs().topDocs;
+        ScoreDoc[] scoreDocs = querySearchResult.topDocs().topDocs.scoreDocs;
         // iterate over the normalized/combined scores, that solves (1) and (3)
-        SearchHit[] updatedSearchHitArray = Arrays.stream(topDocs.scoreDocs).map(scoreDoc -> {
+        SearchHit[] updatedSearchHitArray = new SearchHit[scoreDocs.length];
+        for (int i = 0; i < scoreDocs.length; i++) {
             // get fetched hit content by doc_id
-            SearchHit searchHit = docIdToSearchHit.get(scoreDoc.doc);
+            int index = Arrays.binarySearch(sortedDocIds, scoreDocs[i].doc);
+            if (index < 0) {
+                throw new IllegalStateException(
+                    String.format(
+                        Locale.ROOT,
+                        "score normalization processor cannot produce final query result, document [%d] is missing in fetch results",
+                        scoreDocs[i].doc
+                    )
+                );
+            }
+            SearchHit searchHit = searchHitArray[positions[index]];
             // update score to normalized/combined value (3)
-            searchHit.score(scoreDoc.score);
-            return searchHit;
-        }).toArray(SearchHit[]::new);
+            searchHit.score(scoreDocs[i].score);
+            updatedSearchHitArray[i] = searchHit;
+        }
         SearchHits updatedSearchHits = new SearchHits(
             updatedSearchHitArray,
             querySearchResult.getTotalHits(),
@@ -174,7 +230,7 @@ public class NormalizationProcessorWorkflow {
         fetchSearchResult.hits(updatedSearchHits);
     }
 
-    private SearchHit[] getSearchHits(final List<Integer> docIds, final FetchSearchResult fetchSearchResult, final boolean requestCache) {
+    private SearchHit[] getSearchHits(final int[] docIds, final FetchSearchResult fetchSearchResult, final boolean requestCache) {
         SearchHits searchHits = fetchSearchResult.hits();
         SearchHit[] searchHitArray = searchHits.getHits();
         // validate the both collections are of the same size
@@ -185,25 +241,28 @@ public class NormalizationProcessorWorkflow {
         }
         // in case of cached request results of fetch and query may be different, only restriction is
         // that number of query results size is greater or equal size of fetch results
-        if ((!requestCache && searchHitArray.length != docIds.size()) || requestCache && docIds.size() < searchHitArray.length) {
+        if ((!requestCache && searchHitArray.length != docIds.length) || requestCache && docIds.length < searchHitArray.length) {
             throw new IllegalStateException(
                 String.format(
                     Locale.ROOT,
                     "score normalization processor cannot produce final query result, the number of documents after fetch phase [%d] is different from number of documents from query phase [%d]",
                     searchHitArray.length,
-                    docIds.size()
+                    docIds.length
                 )
             );
         }
         return searchHitArray;
     }
 
-    private List<Integer> unprocessedDocIds(final List<QuerySearchResult> querySearchResults) {
-        List<Integer> docIds = querySearchResults.isEmpty()
-            ? List.of()
-            : Arrays.stream(querySearchResults.get(0).topDocs().topDocs.scoreDocs)
-                .map(scoreDoc -> scoreDoc.doc)
-                .collect(Collectors.toList());
+    private int[] unprocessedDocIds(final List<QuerySearchResult> querySearchResults) {
+        if (querySearchResults.isEmpty()) {
+            return new int[0];
+        }
+        ScoreDoc[] scoreDocs = querySearchResults.get(0).topDocs().topDocs.scoreDocs;
+        int[] docIds = new int[scoreDocs.length];
+        for (int i = 0; i < scoreDocs.length; i++) {
+            docIds[i] = scoreDocs[i].doc;
+        }
         return docIds;
     }
 }
@@ -4,8 +4,11 @@
  */
 package org.opensearch.neuralsearch.processor;
 
+import java.util.ArrayList;
 import java.util.List;
+import java.util.Locale;
 import java.util.Map;
+import java.util.concurrent.atomic.LongAdder;
 import java.util.function.BiConsumer;
 import java.util.function.Consumer;
 
@@ -13,20 +16,40 @@ import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.env.Environment;
 import org.opensearch.ingest.IngestDocument;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.util.TokenWeightUtil;
+import org.opensearch.neuralsearch.util.prune.PruneType;
+import org.opensearch.neuralsearch.util.prune.PruneUtils;
 
+import lombok.Getter;
 import lombok.extern.log4j.Log4j2;
 
 /**
  * This processor is used for user input data text sparse encoding processing, model_id can be used to indicate which model user use,
  * and field_map can be used to indicate which fields needs text embedding and the corresponding keys for the sparse encoding results.
+ * Optionally tokens of sparse vectors are pruned with prune_type and prune_ratio, and weights are quantized with quantization_step
+ * before they are written to the document.
  */
 @Log4j2
 public final class SparseEncodingProcessor extends InferenceProcessor {
 
     public static final String TYPE = "sparse_encoding";
     public static final String LIST_TYPE_NESTED_MAP_KEY = "sparse_encoding";
+    public static final String PRUNE_TYPE_FIELD = "prune_type";
+    public static final String PRUNE_RATIO_FIELD = "prune_ratio";
+    public static final String QUANTIZATION_STEP_FIELD = "quantization_step";
+
+    @Getter
+    private final PruneType pruneType;
+    @Getter
+    private final float pruneRatio;
+    @Getter
+    private final float quantizationStep;
+    private final List<String> inferenceCacheResponseFilters;
+    // number of tokens returned by the model and number of tokens written to documents
+    private final LongAdder numOfInferredTokens = new LongAdder();
+    private final LongAdder numOfIndexedTokens = new LongAdder();
 
     public SparseEncodingProcessor(
         String tag,
@@ -35,9 +58,62 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
         Map<String, Object> fieldMap,
         MLCommonsClientAccessor clientAccessor,
         Environment environment,
-        ClusterService clusterService
+        ClusterService clusterService,
+        InferenceResultCache<Object> inferenceResultCache
     ) {
-        super(tag, description, TYPE, LIST_TYPE_NESTED_MAP_KEY, modelId, fieldMap, clientAccessor, environment, clusterService);
+        this(
+            tag,
+            description,
+            modelId,
+            fieldMap,
+            clientAccessor,
+            environment,
+            clusterService,
+            inferenceResultCache,
+            PruneType.NONE,
+            0f,
+            0f
+        );
+    }
+
+    public SparseEncodingProcessor(
+        String tag,
+        String description,
+        String modelId,
+        Map<String, Object> fieldMap,
+        MLCommonsClientAccessor clientAccessor,
+        Environment environment,
+        ClusterService clusterService,
+        InferenceResultCache<Object> inferenceResultCache,
+        PruneType pruneType,
+        float pruneRatio,
+        float quantizationStep
+    ) {
+        super(
+            tag,
+            description,
+            TYPE,
+            LIST_TYPE_NESTED_MAP_KEY,
+            modelId,
+            fieldMap,
+            clientAccessor,
+            environment,
+            clusterService,
+            inferenceResultCache
+        );
+        PruneUtils.validatePruneRatio(pruneType, pruneRatio);
+        if (quantizationStep < 0) {
+            throw new IllegalArgumentException(String.format(Locale.ROOT, "%s must not be negative", QUANTIZATION_STEP_FIELD));
+        }
+        this.pruneType = pruneType;
+        this.pruneRatio = pruneRatio;
+        this.quantizationStep = quantizationStep;
+        this.inferenceCacheResponseFilters = List.of(
+            TYPE,
+            pruneType.getValue(),
+            Float.toString(pruneRatio),
+            Float.toString(quantizationStep)
+        );
     }
 
     @Override
@@ -48,7 +124,8 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
         BiConsumer<IngestDocument, Exception> handler
     ) {
         mlCommonsClientAccessor.inferenceSentencesWithMapResult(this.modelId, inferenceList, ActionListener.wrap(resultMaps -> {
-            setVectorFieldsToDocument(ingestDocument, ProcessMap, TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps));
+            List<Map<String, Float>> sparseVectors = pruneSparseVectors(TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps));
+            setVectorFieldsToDocument(ingestDocument, ProcessMap, sparseVectors);
             handler.accept(ingestDocument, null);
         }, e -> { handler.accept(null, e); }));
     }
@@ -58,7 +135,44 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
         mlCommonsClientAccessor.inferenceSentencesWithMapResult(
             this.modelId,
             inferenceList,
-            ActionListener.wrap(resultMaps -> handler.accept(TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps)), onException)
+            ActionListener.wrap(
+                resultMaps -> handler.accept(pruneSparseVectors(TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps))),
+                onException
+            )
         );
     }
+
+    @Override
+    protected List<String> getInferenceCacheResponseFilters() {
+        return inferenceCacheResponseFilters;
+    }
+
+    /**
+     * Share of tokens returned by the model that were removed by pruning and quantization since processor was created
+     * @return pruning ratio in range [0, 1], zero if no tokens were processed
+     */
+    public double getPruningRatio() {
+        long inferredTokens = numOfInferredTokens.sum();
+        if (inferredTokens == 0) {
+            return 0;
+        }
+        return 1.0 - (double) numOfIndexedTokens.sum() / inferredTokens;
+    }
+
+    private List<Map<String, Float>> pruneSparseVectors(final List<Map<String, Float>> sparseVectors) {
+        if (pruneType == PruneType.NONE && quantizationStep == 0) {
+            return sparseVectors;
+        }
+        List<Map<String, Float>> prunedSparseVectors = new ArrayList<>(sparseVectors.size());
+        for (Map<String, Float> sparseVector : sparseVectors) {
+            Map<String, Float> prunedSparseVector = PruneUtils.quantizeSparseVector(
+                quantizationStep,
+                PruneUtils.pruneSparseVector(pruneType, pruneRatio, sparseVector)
+            );
+            numOfInferredTokens.add(sparseVector.size());
+            numOfIndexedTokens.add(prunedSparseVector.size());
+            prunedSparseVectors.add(prunedSparseVector);
+        }
+        return prunedSparseVectors;
+    }
 }
@@ -11,6 +11,7 @@ import java.util.Locale;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.Objects;
+import java.util.function.Consumer;
 
 import org.apache.commons.lang3.StringUtils;
 import org.opensearch.cluster.metadata.IndexMetadata;
@@ -20,10 +21,12 @@ import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.index.IndexSettings;
 import org.opensearch.ingest.AbstractProcessor;
 import org.opensearch.ingest.IngestDocument;
+import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.neuralsearch.processor.chunker.Chunker;
 import org.opensearch.index.mapper.IndexFieldMapper;
 import org.opensearch.neuralsearch.processor.chunker.ChunkerFactory;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
+import org.opensearch.neuralsearch.stats.NeuralStats;
 import org.opensearch.neuralsearch.util.ProcessorDocumentUtils;
 
 import static org.opensearch.neuralsearch.processor.chunker.Chunker.MAX_CHUNK_LIMIT_FIELD;
@@ -146,9 +149,8 @@ public final class TextChunkingProcessor extends AbstractProcessor {
         return true;
     }
 
-    private int getMaxTokenCount(final Map<String, Object> sourceAndMetadataMap) {
+    private int getMaxTokenCount(final String indexName) {
         int defaultMaxTokenCount = IndexSettings.MAX_TOKEN_COUNT_SETTING.get(environment.settings());
-        String indexName = sourceAndMetadataMap.get(IndexFieldMapper.NAME).toString();
         IndexMetadata indexMetadata = clusterService.state().metadata().index(indexName);
         if (Objects.isNull(indexMetadata)) {
             return defaultMaxTokenCount;
@@ -163,8 +165,40 @@ public final class TextChunkingProcessor extends AbstractProcessor {
      */
     @Override
     public IngestDocument execute(final IngestDocument ingestDocument) {
+        String indexName = ingestDocument.getSourceAndMetadata().get(IndexFieldMapper.NAME).toString();
+        return chunkDocument(ingestDocument, indexName, getMaxTokenCount(indexName));
+    }
+
+    /**
+     * Chunks documents of a batch. Max token count of every index is resolved from the cluster metadata once per batch.
+     * @param ingestDocumentWrappers list of documents of the batch
+     * @param handler handler that is called once all documents are processed
+     */
+    @Override
+    public void batchExecute(
+        final List<IngestDocumentWrapper> ingestDocumentWrappers,
+        final Consumer<List<IngestDocumentWrapper>> handler
+    ) {
+        Map<String, Integer> maxTokenCountByIndex = new HashMap<>();
+        for (IngestDocumentWrapper ingestDocumentWrapper : ingestDocumentWrappers) {
+            IngestDocument ingestDocument = ingestDocumentWrapper.getIngestDocument();
+            if (Objects.isNull(ingestDocument) || Objects.nonNull(ingestDocumentWrapper.getException())) {
+                continue;
+            }
+            try {
+                String indexName = ingestDocument.getSourceAndMetadata().get(IndexFieldMapper.NAME).toString();
+                int maxTokenCount = maxTokenCountByIndex.computeIfAbsent(indexName, this::getMaxTokenCount);
+                chunkDocument(ingestDocument, indexName, maxTokenCount);
+            } catch (Exception e) {
+                ingestDocumentWrapper.update(ingestDocument, e);
+            }
+        }
+        handler.accept(ingestDocumentWrappers);
+    }
+
+    private IngestDocument chunkDocument(final IngestDocument ingestDocument, final String indexName, final int maxTokenCount) {
+        long startNanos = NeuralStats.instance().startTimer();
         Map<String, Object> sourceAndMetadataMap = ingestDocument.getSourceAndMetadata();
-        String indexName = sourceAndMetadataMap.get(IndexFieldMapper.NAME).toString();
         ProcessorDocumentUtils.validateMapTypeValue(
             FIELD_MAP_FIELD,
             sourceAndMetadataMap,
@@ -176,12 +210,13 @@ public final class TextChunkingProcessor extends AbstractProcessor {
         );
         // fixed token length algorithm needs runtime parameter max_token_count for tokenization
         Map<String, Object> runtimeParameters = new HashMap<>();
-        int maxTokenCount = getMaxTokenCount(sourceAndMetadataMap);
         int chunkStringCount = getChunkStringCountFromMap(sourceAndMetadataMap, fieldMap);
         runtimeParameters.put(FixedTokenLengthChunker.MAX_TOKEN_COUNT_FIELD, maxTokenCount);
         runtimeParameters.put(MAX_CHUNK_LIMIT_FIELD, maxChunkLimit);
         runtimeParameters.put(CHUNK_STRING_COUNT_FIELD, chunkStringCount);
-        chunkMapType(sourceAndMetadataMap, fieldMap, runtimeParameters);
+        int chunkCount = chunkMapType(sourceAndMetadataMap, fieldMap, runtimeParameters);
+        NeuralStats.instance().recordTime(NeuralStats.TEXT_CHUNKING_TIME, startNanos);
+        NeuralStats.instance().recordSize(NeuralStats.TEXT_CHUNKING_CHUNKS, chunkCount);
         return ingestDocument;
     }
 
@@ -226,11 +261,12 @@ public final class TextChunkingProcessor extends AbstractProcessor {
     }
 
     @SuppressWarnings("unchecked")
-    private void chunkMapType(
+    private int chunkMapType(
         Map<String, Object> sourceAndMetadataMap,
         final Map<String, Object> fieldMap,
         final Map<String, Object> runtimeParameters
     ) {
+        int chunkCount = 0;
         for (Map.Entry<String, Object> fieldMapEntry : fieldMap.entrySet()) {
             String originalKey = fieldMapEntry.getKey();
             Object targetKey = fieldMapEntry.getValue();
@@ -241,19 +277,21 @@ public final class TextChunkingProcessor extends AbstractProcessor {
                     List<Object> sourceObjectList = (List<Object>) sourceObject;
                     for (Object source : sourceObjectList) {
                         if (source instanceof Map) {
-                            chunkMapType((Map<String, Object>) source, (Map<String, Object>) targetKey, runtimeParameters);
+                            chunkCount += chunkMapType((Map<String, Object>) source, (Map<String, Object>) targetKey, runtimeParameters);
                         }
                     }
                 } else if (sourceObject instanceof Map) {
-                    chunkMapType((Map<String, Object>) sourceObject, (Map<String, Object>) targetKey, runtimeParameters);
+                    chunkCount += chunkMapType((Map<String, Object>) sourceObject, (Map<String, Object>) targetKey, runtimeParameters);
                 }
             } else {
                 // chunk the object when target key is of leaf type (null, string and list of string)
                 Object chunkObject = sourceAndMetadataMap.get(originalKey);
                 List<String> chunkedResult = chunkLeafType(chunkObject, runtimeParameters);
                 sourceAndMetadataMap.put(String.valueOf(targetKey), chunkedResult);
+                chunkCount += chunkedResult.size();
             }
         }
+        return chunkCount;
     }
 
     /**
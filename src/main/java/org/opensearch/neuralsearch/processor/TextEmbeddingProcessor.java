@@ -13,6 +13,7 @@ import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.env.Environment;
 import org.opensearch.ingest.IngestDocument;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 
 import lombok.extern.log4j.Log4j2;
@@ -34,9 +35,21 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
         Map<String, Object> fieldMap,
         MLCommonsClientAccessor clientAccessor,
         Environment environment,
-        ClusterService clusterService
+        ClusterService clusterService,
+        InferenceResultCache<Object> inferenceResultCache
     ) {
-        super(tag, description, TYPE, LIST_TYPE_NESTED_MAP_KEY, modelId, fieldMap, clientAccessor, environment, clusterService);
+        super(
+            tag,
+            description,
+            TYPE,
+            LIST_TYPE_NESTED_MAP_KEY,
+            modelId,
+            fieldMap,
+            clientAccessor,
+            environment,
+            clusterService,
+            inferenceResultCache
+        );
     }
 
     @Override
@@ -4,6 +4,10 @@
  */
 package org.opensearch.neuralsearch.processor;
 
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.INGEST_INFERENCE_BATCH_MAX_IN_FLIGHT;
+
+import java.util.ArrayList;
+import java.util.Collections;
 import java.util.HashMap;
 import java.util.LinkedHashMap;
 import java.util.List;
@@ -11,15 +15,19 @@ import java.util.Locale;
 import java.util.Map;
 import java.util.Objects;
 import java.util.Set;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.BiConsumer;
+import java.util.function.Consumer;
 
 import org.apache.commons.lang3.StringUtils;
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.common.util.CollectionUtils;
 import org.opensearch.env.Environment;
 import org.opensearch.index.mapper.IndexFieldMapper;
 import org.opensearch.ingest.AbstractProcessor;
 import org.opensearch.ingest.IngestDocument;
+import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 
 import com.google.common.annotations.VisibleForTesting;
@@ -124,6 +132,138 @@ public class TextImageEmbeddingProcessor extends AbstractProcessor {
 
     }
 
+    /**
+     * Runs inference for a batch of documents. Multimodal model takes one text and image pair per request, so documents
+     * with the same pair share one request and only a limited number of requests is sent to the model at the same time.
+     * @param ingestDocumentWrappers list of documents of the batch
+     * @param handler handler that is called once all documents are processed
+     */
+    @Override
+    public void batchExecute(
+        final List<IngestDocumentWrapper> ingestDocumentWrappers,
+        final Consumer<List<IngestDocumentWrapper>> handler
+    ) {
+        if (CollectionUtils.isEmpty(ingestDocumentWrappers)) {
+            handler.accept(Collections.emptyList());
+            return;
+        }
+        Map<Map<String, String>, List<IngestDocumentWrapper>> documentsByInference = new LinkedHashMap<>();
+        for (IngestDocumentWrapper ingestDocumentWrapper : ingestDocumentWrappers) {
+            if (Objects.isNull(ingestDocumentWrapper.getIngestDocument()) || Objects.nonNull(ingestDocumentWrapper.getException())) {
+                continue;
+            }
+            try {
+                validateEmbeddingFieldsValue(ingestDocumentWrapper.getIngestDocument());
+                Map<String, String> knnMap = buildMapWithKnnKeyAndOriginalValue(ingestDocumentWrapper.getIngestDocument());
+                Map<String, String> inferenceMap = createInferences(knnMap);
+                if (!inferenceMap.isEmpty()) {
+                    documentsByInference.computeIfAbsent(inferenceMap, key -> new ArrayList<>()).add(ingestDocumentWrapper);
+                }
+            } catch (Exception e) {
+                ingestDocumentWrapper.update(ingestDocumentWrapper.getIngestDocument(), e);
+            }
+        }
+        if (documentsByInference.isEmpty()) {
+            handler.accept(ingestDocumentWrappers);
+            return;
+        }
+        new BatchInference(
+            ingestDocumentWrappers,
+            new ArrayList<>(documentsByInference.entrySet()),
+            INGEST_INFERENCE_BATCH_MAX_IN_FLIGHT.get(environment.settings()),
+            handler
+        ).start();
+    }
+
+    /**
+     * Sends inference requests of one batch, at most maxInFlight requests at the same time
+     */
+    private final class BatchInference {
+        private final List<IngestDocumentWrapper> ingestDocumentWrappers;
+        private final List<Map.Entry<Map<String, String>, List<IngestDocumentWrapper>>> inferences;
+        private final int maxInFlight;
+        private final Consumer<List<IngestDocumentWrapper>> handler;
+        private final AtomicInteger dispatchRequests = new AtomicInteger();
+        private int nextInference;
+        private int inferencesInFlight;
+        private int completedInferences;
+
+        BatchInference(
+            final List<IngestDocumentWrapper> ingestDocumentWrappers,
+            final List<Map.Entry<Map<String, String>, List<IngestDocumentWrapper>>> inferences,
+            final int maxInFlight,
+            final Consumer<List<IngestDocumentWrapper>> handler
+        ) {
+            this.ingestDocumentWrappers = ingestDocumentWrappers;
+            this.inferences = inferences;
+            this.maxInFlight = maxInFlight;
+            this.handler = handler;
+        }
+
+        void start() {
+            dispatch();
+        }
+
+        private void dispatch() {
+            // inference may complete on the calling thread, in such case the loop below sends next requests
+            // instead of going into recursion
+            if (dispatchRequests.getAndIncrement() > 0) {
+                return;
+            }
+            do {
+                Map.Entry<Map<String, String>, List<IngestDocumentWrapper>> inference;
+                while ((inference = pollNextInference()) != null) {
+                    execute(inference.getKey(), inference.getValue());
+                }
+            } while (dispatchRequests.decrementAndGet() > 0);
+        }
+
+        private synchronized Map.Entry<Map<String, String>, List<IngestDocumentWrapper>> pollNextInference() {
+            if (inferencesInFlight >= maxInFlight || nextInference >= inferences.size()) {
+                return null;
+            }
+            inferencesInFlight++;
+            return inferences.get(nextInference++);
+        }
+
+        private void execute(final Map<String, String> inferenceMap, final List<IngestDocumentWrapper> documents) {
+            try {
+                mlCommonsClientAccessor.inferenceSentences(modelId, inferenceMap, ActionListener.wrap(vectors -> {
+                    for (int i = 0; i < documents.size(); i++) {
+                        IngestDocumentWrapper document = documents.get(i);
+                        try {
+                            // every document gets its own copy of the vector
+                            setVectorFieldsToDocument(document.getIngestDocument(), i == 0 ? vectors : new ArrayList<>(vectors));
+                        } catch (Exception e) {
+                            document.update(document.getIngestDocument(), e);
+                        }
+                    }
+                    onInferenceCompleted();
+                }, e -> onInferenceFailure(documents, e)));
+            } catch (Exception e) {
+                onInferenceFailure(documents, e);
+            }
+        }
+
+        private void onInferenceFailure(final List<IngestDocumentWrapper> documents, final Exception exception) {
+            documents.forEach(document -> document.update(document.getIngestDocument(), exception));
+            onInferenceCompleted();
+        }
+
+        private void onInferenceCompleted() {
+            boolean completed;
+            synchronized (this) {
+                inferencesInFlight--;
+                completed = ++completedInferences == inferences.size();
+            }
+            if (completed) {
+                handler.accept(ingestDocumentWrappers);
+                return;
+            }
+            dispatch();
+        }
+    }
+
     private void setVectorFieldsToDocument(final IngestDocument ingestDocument, final List<Float> vectors) {
         Objects.requireNonNull(vectors, "embedding failed, inference returns null result!");
         log.debug("Text embedding result fetched, starting build vector output!");
@@ -10,10 +10,11 @@ import java.util.List;
 import java.util.Set;
 import java.util.ArrayList;
 
+import org.apache.lucene.analysis.Analyzer;
+import org.apache.lucene.analysis.TokenStream;
+import org.apache.lucene.analysis.tokenattributes.OffsetAttribute;
 import org.opensearch.index.analysis.AnalysisRegistry;
-import org.opensearch.action.admin.indices.analyze.AnalyzeAction;
-import org.opensearch.action.admin.indices.analyze.AnalyzeAction.AnalyzeToken;
-import static org.opensearch.action.admin.indices.analyze.TransportAnalyzeAction.analyze;
+import org.opensearch.index.analysis.NameOrDefinition;
 import static org.opensearch.neuralsearch.processor.chunker.ChunkerParameterParser.parseInteger;
 import static org.opensearch.neuralsearch.processor.chunker.ChunkerParameterParser.parseStringWithDefault;
 import static org.opensearch.neuralsearch.processor.chunker.ChunkerParameterParser.parseDoubleWithDefault;
@@ -122,49 +123,64 @@ public final class FixedTokenLengthChunker implements Chunker {
         int runtimeMaxChunkLimit = parseInteger(runtimeParameters, MAX_CHUNK_LIMIT_FIELD);
         int chunkStringCount = parseInteger(runtimeParameters, CHUNK_STRING_COUNT_FIELD);
 
-        List<AnalyzeToken> tokens = tokenize(content, tokenizer, maxTokenCount);
         List<String> chunkResult = new ArrayList<>();
-
-        int startTokenIndex = 0;
-        int startContentPosition, endContentPosition;
         int overlapTokenNumber = (int) Math.floor(tokenLimit * overlapRate);
+        // start offsets of the last tokenLimit + 1 tokens, enough to find both ends of the current passage
+        int[] startOffsets = new int[tokenLimit + 1];
+        int tokenCount = 0;
+        int startTokenIndex = 0;
+        int startContentPosition = 0;
+        boolean exceedMaxChunkLimit = false;
 
-        while (startTokenIndex < tokens.size()) {
-            if (startTokenIndex == 0) {
+        // analyzer is built per call and closed with its token stream so that no per thread components are left behind
+        try (
+            Analyzer analyzer = analysisRegistry.buildCustomAnalyzer(null, false, new NameOrDefinition(tokenizer), List.of(), List.of());
+            TokenStream tokenStream = analyzer.tokenStream("", content)
+        ) {
+            OffsetAttribute offsetAttribute = tokenStream.addAttribute(OffsetAttribute.class);
+            tokenStream.reset();
+            while (tokenStream.incrementToken()) {
+                int tokenIndex = tokenCount++;
+                if (tokenCount > maxTokenCount) {
+                    throw new IllegalStateException(
+                        String.format(
+                            Locale.ROOT,
+                            "The number of tokens produced by calling _analyze has exceeded the allowed maximum of [%d]."
+                                + " This limit can be set by changing the [index.analyze.max_token_count] index level setting.",
+                            maxTokenCount
+                        )
+                    );
+                }
+                if (exceedMaxChunkLimit) {
+                    // keep counting tokens to validate max_token_count
+                    continue;
+                }
+                startOffsets[tokenIndex % startOffsets.length] = offsetAttribute.startOffset();
+                if (tokenIndex != startTokenIndex + tokenLimit) {
+                    continue;
+                }
                 // include all characters till the start if no previous passage
-                startContentPosition = 0;
-            } else {
-                startContentPosition = tokens.get(startTokenIndex).getStartOffset();
-            }
-            if (Chunker.checkRunTimeMaxChunkLimit(chunkResult.size(), runtimeMaxChunkLimit, chunkStringCount)) {
-                // include all characters till the end if exceeds max chunk limit
-                chunkResult.add(content.substring(startContentPosition));
-                break;
-            }
-            if (startTokenIndex + tokenLimit >= tokens.size()) {
-                // include all characters till the end if no next passage
-                endContentPosition = content.length();
-                chunkResult.add(content.substring(startContentPosition, endContentPosition));
-                break;
-            } else {
+                startContentPosition = startTokenIndex == 0 ? 0 : startOffsets[startTokenIndex % startOffsets.length];
+                if (Chunker.checkRunTimeMaxChunkLimit(chunkResult.size(), runtimeMaxChunkLimit, chunkStringCount)) {
+                    // include all characters till the end if exceeds max chunk limit
+                    chunkResult.add(content.substring(startContentPosition));
+                    exceedMaxChunkLimit = true;
+                    continue;
+                }
                 // include gap characters between two passages
-                endContentPosition = tokens.get(startTokenIndex + tokenLimit).getStartOffset();
-                chunkResult.add(content.substring(startContentPosition, endContentPosition));
+                chunkResult.add(content.substring(startContentPosition, offsetAttribute.startOffset()));
+                startTokenIndex += tokenLimit - overlapTokenNumber;
             }
-            startTokenIndex += tokenLimit - overlapTokenNumber;
-        }
-        return chunkResult;
-    }
-
-    private List<AnalyzeToken> tokenize(final String content, final String tokenizer, final int maxTokenCount) {
-        AnalyzeAction.Request analyzeRequest = new AnalyzeAction.Request();
-        analyzeRequest.text(content);
-        analyzeRequest.tokenizer(tokenizer);
-        try {
-            AnalyzeAction.Response analyzeResponse = analyze(analyzeRequest, analysisRegistry, null, maxTokenCount);
-            return analyzeResponse.getTokens();
+            tokenStream.end();
         } catch (Exception e) {
             throw new IllegalStateException(String.format(Locale.ROOT, "analyzer %s throws exception: %s", tokenizer, e.getMessage()), e);
         }
+
+        if (!exceedMaxChunkLimit && startTokenIndex < tokenCount) {
+            // include all characters till the end as there is no next passage
+            startContentPosition = startTokenIndex == 0 ? 0 : startOffsets[startTokenIndex % startOffsets.length];
+            chunkResult.add(content.substring(startContentPosition));
+        }
+        return chunkResult;
     }
 }
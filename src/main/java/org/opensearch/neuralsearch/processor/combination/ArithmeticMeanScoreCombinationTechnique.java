@@ -37,11 +37,16 @@ public class ArithmeticMeanScoreCombinationTechnique implements ScoreCombination
      */
     @Override
     public float combine(final float[] scores) {
-        scoreCombinationUtil.validateIfWeightsMatchScores(scores, weights);
+        return combine(scores, 0, scores.length);
+    }
+
+    @Override
+    public float combine(final float[] scores, final int offset, final int length) {
+        scoreCombinationUtil.validateIfWeightsMatchScores(length, weights);
         float combinedScore = 0.0f;
         float sumOfWeights = 0;
-        for (int indexOfSubQuery = 0; indexOfSubQuery < scores.length; indexOfSubQuery++) {
-            float score = scores[indexOfSubQuery];
+        for (int indexOfSubQuery = 0; indexOfSubQuery < length; indexOfSubQuery++) {
+            float score = scores[offset + indexOfSubQuery];
             if (score >= 0.0) {
                 float weight = scoreCombinationUtil.getWeightForSubQuery(weights, indexOfSubQuery);
                 score = score * weight;
@@ -39,11 +39,16 @@ public class GeometricMeanScoreCombinationTechnique implements ScoreCombinationT
      */
     @Override
     public float combine(final float[] scores) {
-        scoreCombinationUtil.validateIfWeightsMatchScores(scores, weights);
+        return combine(scores, 0, scores.length);
+    }
+
+    @Override
+    public float combine(final float[] scores, final int offset, final int length) {
+        scoreCombinationUtil.validateIfWeightsMatchScores(length, weights);
         float weightedLnSum = 0;
         float sumOfWeights = 0;
-        for (int indexOfSubQuery = 0; indexOfSubQuery < scores.length; indexOfSubQuery++) {
-            float score = scores[indexOfSubQuery];
+        for (int indexOfSubQuery = 0; indexOfSubQuery < length; indexOfSubQuery++) {
+            float score = scores[offset + indexOfSubQuery];
             if (score <= 0) {
                 // scores 0.0 need to be skipped, ln() of 0 is not defined
                 continue;
@@ -37,11 +37,16 @@ public class HarmonicMeanScoreCombinationTechnique implements ScoreCombinationTe
      */
     @Override
     public float combine(final float[] scores) {
-        scoreCombinationUtil.validateIfWeightsMatchScores(scores, weights);
+        return combine(scores, 0, scores.length);
+    }
+
+    @Override
+    public float combine(final float[] scores, final int offset, final int length) {
+        scoreCombinationUtil.validateIfWeightsMatchScores(length, weights);
         float sumOfWeights = 0;
         float sumOfHarmonics = 0;
-        for (int indexOfSubQuery = 0; indexOfSubQuery < scores.length; indexOfSubQuery++) {
-            float score = scores[indexOfSubQuery];
+        for (int indexOfSubQuery = 0; indexOfSubQuery < length; indexOfSubQuery++) {
+            float score = scores[offset + indexOfSubQuery];
             if (score <= 0) {
                 continue;
             }
@@ -0,0 +1,74 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.combination;
+
+import java.util.Locale;
+import java.util.Map;
+import java.util.Objects;
+import java.util.Set;
+
+import lombok.ToString;
+
+/**
+ * Abstracts combination of scores based on reciprocal rank fusion method. Technique uses only ranks of documents
+ * in results of each sub-query, so scores don't need to be normalized
+ */
+@ToString(onlyExplicitlyIncluded = true)
+public class RRFScoreCombinationTechnique implements ScoreCombinationTechnique {
+    @ToString.Include
+    public static final String TECHNIQUE_NAME = "rrf";
+    public static final String PARAM_NAME_RANK_CONSTANT = "rank_constant";
+    public static final int DEFAULT_RANK_CONSTANT = 60;
+    private static final Set<String> SUPPORTED_PARAMS = Set.of(PARAM_NAME_RANK_CONSTANT);
+    private static final float ZERO_SCORE = 0.0f;
+    @ToString.Include
+    private final int rankConstant;
+
+    public RRFScoreCombinationTechnique(final Map<String, Object> params, final ScoreCombinationUtil combinationUtil) {
+        combinationUtil.validateParams(params, SUPPORTED_PARAMS);
+        rankConstant = getRankConstant(params);
+    }
+
+    /**
+     * Reciprocal rank fusion method for combining ranks.
+     * score = 1/(rank_constant + rank1) + 1/(rank_constant + rank2) + ... + 1/(rank_constant + rankN)
+     *
+     * Sub-queries that don't have the document in their results (rank is 0) are excluded
+     */
+    @Override
+    public float combine(final float[] ranks) {
+        return combine(ranks, 0, ranks.length);
+    }
+
+    @Override
+    public float combine(final float[] ranks, final int offset, final int length) {
+        float combinedScore = ZERO_SCORE;
+        for (int indexOfSubQuery = 0; indexOfSubQuery < length; indexOfSubQuery++) {
+            float rank = ranks[offset + indexOfSubQuery];
+            if (rank > 0) {
+                combinedScore += 1.0f / (rankConstant + rank);
+            }
+        }
+        return combinedScore;
+    }
+
+    @Override
+    public boolean usesRanks() {
+        return true;
+    }
+
+    private int getRankConstant(final Map<String, Object> params) {
+        if (Objects.isNull(params) || !params.containsKey(PARAM_NAME_RANK_CONSTANT)) {
+            return DEFAULT_RANK_CONSTANT;
+        }
+        Object rankConstant = params.get(PARAM_NAME_RANK_CONSTANT);
+        if (!(rankConstant instanceof Integer) || (Integer) rankConstant < 1) {
+            throw new IllegalArgumentException(
+                String.format(Locale.ROOT, "parameter [%s] must be an integer greater than or equal to 1", PARAM_NAME_RANK_CONSTANT)
+            );
+        }
+        return (Integer) rankConstant;
+    }
+}
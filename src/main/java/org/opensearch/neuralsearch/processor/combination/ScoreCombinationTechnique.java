@@ -4,6 +4,8 @@
  */
 package org.opensearch.neuralsearch.processor.combination;
 
+import java.util.Arrays;
+
 public interface ScoreCombinationTechnique {
 
     /**
@@ -12,4 +14,26 @@ public interface ScoreCombinationTechnique {
      * @return combined score
      */
     float combine(final float[] scores);
+
+    /**
+     * Defines combination function for scores that are a range of a bigger array, e.g. scores of one document
+     * in a flat array of scores of all documents. Default implementation copies the range.
+     * @param scores array that contains collected original scores
+     * @param offset index of the score of the first sub-query
+     * @param length number of sub-queries
+     * @return combined score
+     */
+    default float combine(final float[] scores, final int offset, final int length) {
+        return combine(Arrays.copyOfRange(scores, offset, offset + length));
+    }
+
+    /**
+     * Defines if technique combines ranks of document instead of its scores. For such techniques scores are not normalized,
+     * and combine functions get 1-based ranks of document in results of each sub-query merged from all shards by score,
+     * 0 if sub-query doesn't have the document
+     * @return true if technique combines ranks
+     */
+    default boolean usesRanks() {
+        return false;
+    }
 }
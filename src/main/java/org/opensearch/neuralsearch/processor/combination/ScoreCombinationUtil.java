@@ -95,16 +95,26 @@ class ScoreCombinationUtil {
      * @param weights score combination weights that are defined as part of search result processor
      */
     protected void validateIfWeightsMatchScores(final float[] scores, final List<Float> weights) {
+        validateIfWeightsMatchScores(scores.length, weights);
+    }
+
+    /**
+     * Check if number of weights matches number of queries, same as {@link #validateIfWeightsMatchScores(float[], List)}
+     * for scores that are a range of a bigger array
+     * @param numOfScores number of scores from all sub-queries of a single hybrid search query
+     * @param weights score combination weights that are defined as part of search result processor
+     */
+    protected void validateIfWeightsMatchScores(final int numOfScores, final List<Float> weights) {
         if (weights.isEmpty()) {
             return;
         }
-        if (scores.length != weights.size()) {
+        if (numOfScores != weights.size()) {
             throw new IllegalArgumentException(
                 String.format(
                     Locale.ROOT,
                     "number of weights [%d] must match number of sub-queries [%d] in hybrid query",
                     weights.size(),
-                    scores.length
+                    numOfScores
                 )
             );
         }
@@ -5,15 +5,14 @@
 package org.opensearch.neuralsearch.processor.combination;
 
 import java.util.ArrayList;
-import java.util.HashMap;
+import java.util.Arrays;
 import java.util.List;
-import java.util.Map;
 import java.util.Objects;
-import java.util.stream.Collectors;
 
 import org.apache.lucene.search.ScoreDoc;
 import org.apache.lucene.search.TopDocs;
 import org.apache.lucene.search.TotalHits;
+import org.apache.lucene.util.IntroSorter;
 import org.opensearch.neuralsearch.processor.CompoundTopDocs;
 
 import lombok.extern.log4j.Log4j2;
@@ -29,104 +28,288 @@ public class ScoreCombiner {
     /**
      * Performs score combination based on input combination technique. Mutates input object by updating combined scores
      * Main steps we're doing for combination:
-     *  - create map of normalized scores per doc id
-     *  - using normalized scores create another map of combined scores per doc id
+     *  - collect normalized scores per doc id into flat array
+     *  - using normalized scores create array of combined scores per doc id
      *  - count max number of hits among sub-queries
-     *  - sort documents by scores and take first "max number" of docs
+     *  - select first "max number" of docs with highest scores and sort them, equal scores are ordered by ascending doc id
      *  - update query search results with normalized scores
-     *  Different score combination techniques are different in step 2, where we create map of "doc id" - "combined score",
+     *  Different score combination techniques are different in step 2, where we calculate "combined score" per doc id,
      *  other steps are same for all techniques.
      * @param queryTopDocs query results that need to be normalized, mutated by method execution
      * @param scoreCombinationTechnique exact combination method that should be applied
      */
     public void combineScores(final List<CompoundTopDocs> queryTopDocs, final ScoreCombinationTechnique scoreCombinationTechnique) {
+        // rank of a document is its position in results of the sub-query merged from all shards, positions in results
+        // of one shard can't be compared between shards
+        List<float[][]> ranksPerShard = scoreCombinationTechnique.usesRanks() ? getRanksAcrossShards(queryTopDocs) : null;
         // iterate over results from each shard. Every CompoundTopDocs object has results from
         // multiple sub queries, doc ids may repeat for each sub query results
-        queryTopDocs.forEach(compoundQueryTopDocs -> combineShardScores(scoreCombinationTechnique, compoundQueryTopDocs));
+        for (int shard = 0; shard < queryTopDocs.size(); shard++) {
+            float[][] ranks = Objects.isNull(ranksPerShard) ? null : ranksPerShard.get(shard);
+            combineShardScores(scoreCombinationTechnique, queryTopDocs.get(shard), ranks);
+        }
     }
 
-    private void combineShardScores(final ScoreCombinationTechnique scoreCombinationTechnique, final CompoundTopDocs compoundQueryTopDocs) {
-        if (Objects.isNull(compoundQueryTopDocs) || compoundQueryTopDocs.getTotalHits().value == 0) {
+    private void combineShardScores(
+        final ScoreCombinationTechnique scoreCombinationTechnique,
+        final CompoundTopDocs compoundQueryTopDocs,
+        final float[][] ranks
+    ) {
+        if (isEmpty(compoundQueryTopDocs)) {
             return;
         }
         List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-        // - create map of normalized scores results returned from the single shard
-        Map<Integer, float[]> normalizedScoresPerDoc = getNormalizedScoresPerDocument(topDocsPerSubQuery);
+        // - collect normalized scores results returned from the single shard, scores of one document are
+        // stored next to each other in a flat array, position of document is defined by order of first occurrence
+        NormalizedScores normalizedScores = getNormalizedScoresPerDocument(topDocsPerSubQuery, ranks);
 
-        // - create map of combined scores per doc id
-        Map<Integer, Float> combinedNormalizedScoresByDocId = combineScoresAndGetCombinedNormalizedScoresPerDocument(
-            normalizedScoresPerDoc,
-            scoreCombinationTechnique
-        );
+        // - create array of combined scores per document position
+        float[] combinedScores = combineNormalizedScores(normalizedScores, scoreCombinationTechnique);
 
-        // - sort documents by scores and take first "max number" of docs
-        // create a collection of doc ids that are sorted by their combined scores
-        List<Integer> sortedDocsIds = getSortedDocIds(combinedNormalizedScoresByDocId);
+        // - max number of hits will be the same which are passed from QueryPhase
+        long maxHits = compoundQueryTopDocs.getTotalHits().value;
+        // - select first "max number" of docs that have highest combined scores and sort them
+        int[] sortedPositions = getTopPositions(normalizedScores.docIds, combinedScores, (int) Math.min(maxHits, normalizedScores.size));
 
         // - update query search results with normalized scores
-        updateQueryTopDocsWithCombinedScores(compoundQueryTopDocs, topDocsPerSubQuery, combinedNormalizedScoresByDocId, sortedDocsIds);
+        compoundQueryTopDocs.setScoreDocs(
+            getCombinedScoreDocs(compoundQueryTopDocs, normalizedScores.docIds, combinedScores, sortedPositions)
+        );
+        compoundQueryTopDocs.setTotalHits(getTotalHits(topDocsPerSubQuery, maxHits));
     }
 
-    private List<Integer> getSortedDocIds(final Map<Integer, Float> combinedNormalizedScoresByDocId) {
-        // we're merging docs with normalized and combined scores. we need to have only maxHits results
-        List<Integer> sortedDocsIds = new ArrayList<>(combinedNormalizedScoresByDocId.keySet());
-        sortedDocsIds.sort((a, b) -> Float.compare(combinedNormalizedScoresByDocId.get(b), combinedNormalizedScoresByDocId.get(a)));
-        return sortedDocsIds;
+    private static boolean isEmpty(final CompoundTopDocs compoundQueryTopDocs) {
+        return Objects.isNull(compoundQueryTopDocs) || compoundQueryTopDocs.getTotalHits().value == 0;
     }
 
-    private List<ScoreDoc> getCombinedScoreDocs(
-        final CompoundTopDocs compoundQueryTopDocs,
-        final Map<Integer, Float> combinedNormalizedScoresByDocId,
-        final List<Integer> sortedScores,
-        final long maxHits
-    ) {
-        List<ScoreDoc> scoreDocs = new ArrayList<>();
-        int shardId = compoundQueryTopDocs.getScoreDocs().get(0).shardIndex;
-        for (int j = 0; j < maxHits && j < sortedScores.size(); j++) {
-            int docId = sortedScores.get(j);
-            scoreDocs.add(new ScoreDoc(docId, combinedNormalizedScoresByDocId.get(docId), shardId));
+    /**
+     * Ranks of documents in results of every sub-query merged from all shards by score
+     * @return for every shard array of ranks per sub-query, ranks are in the order of the sub-query results of the shard
+     */
+    private List<float[][]> getRanksAcrossShards(final List<CompoundTopDocs> queryTopDocs) {
+        List<float[][]> ranksPerShard = new ArrayList<>(queryTopDocs.size());
+        int numOfSubQueries = 0;
+        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
+            if (isEmpty(compoundQueryTopDocs)) {
+                ranksPerShard.add(null);
+                continue;
+            }
+            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
+            float[][] ranks = new float[topDocsPerSubQuery.size()][];
+            for (int j = 0; j < ranks.length; j++) {
+                ranks[j] = new float[topDocsPerSubQuery.get(j).scoreDocs.length];
+            }
+            numOfSubQueries = Math.max(numOfSubQueries, ranks.length);
+            ranksPerShard.add(ranks);
+        }
+        for (int j = 0; j < numOfSubQueries; j++) {
+            assignRanksOfSubQuery(queryTopDocs, ranksPerShard, j);
+        }
+        return ranksPerShard;
+    }
+
+    private void assignRanksOfSubQuery(final List<CompoundTopDocs> queryTopDocs, final List<float[][]> ranksPerShard, final int subQuery) {
+        int numOfDocs = 0;
+        for (float[][] ranks : ranksPerShard) {
+            if (Objects.nonNull(ranks) && subQuery < ranks.length) {
+                numOfDocs += ranks[subQuery].length;
+            }
+        }
+        int[] shards = new int[numOfDocs];
+        int[] indexes = new int[numOfDocs];
+        float[] scores = new float[numOfDocs];
+        int doc = 0;
+        for (int shard = 0; shard < ranksPerShard.size(); shard++) {
+            float[][] ranks = ranksPerShard.get(shard);
+            if (Objects.isNull(ranks) || subQuery >= ranks.length) {
+                continue;
+            }
+            ScoreDoc[] scoreDocs = queryTopDocs.get(shard).getTopDocs().get(subQuery).scoreDocs;
+            for (int index = 0; index < scoreDocs.length; index++, doc++) {
+                shards[doc] = shard;
+                indexes[doc] = index;
+                scores[doc] = scoreDocs[index].score;
+            }
+        }
+        // merge order is score descending, equal scores keep order of shards and order within the shard
+        new IntroSorter() {
+            private float pivotScore;
+            private int pivotShard;
+            private int pivotIndex;
+
+            @Override
+            protected void swap(final int i, final int j) {
+                int shard = shards[i];
+                shards[i] = shards[j];
+                shards[j] = shard;
+                int index = indexes[i];
+                indexes[i] = indexes[j];
+                indexes[j] = index;
+                float score = scores[i];
+                scores[i] = scores[j];
+                scores[j] = score;
+            }
+
+            @Override
+            protected int compare(final int i, final int j) {
+                return compare(scores[i], shards[i], indexes[i], scores[j], shards[j], indexes[j]);
+            }
+
+            @Override
+            protected void setPivot(final int i) {
+                pivotScore = scores[i];
+                pivotShard = shards[i];
+                pivotIndex = indexes[i];
+            }
+
+            @Override
+            protected int comparePivot(final int j) {
+                return compare(pivotScore, pivotShard, pivotIndex, scores[j], shards[j], indexes[j]);
+            }
+
+            private int compare(
+                final float score,
+                final int shard,
+                final int index,
+                final float otherScore,
+                final int otherShard,
+                final int otherIndex
+            ) {
+                int scoreComparison = Float.compare(otherScore, score);
+                if (scoreComparison != 0) {
+                    return scoreComparison;
+                }
+                return shard != otherShard ? Integer.compare(shard, otherShard) : Integer.compare(index, otherIndex);
+            }
+        }.sort(0, numOfDocs);
+        for (int rank = 1; rank <= numOfDocs; rank++) {
+            ranksPerShard.get(shards[rank - 1])[subQuery][indexes[rank - 1]] = rank;
         }
-        return scoreDocs;
     }
 
-    public Map<Integer, float[]> getNormalizedScoresPerDocument(final List<TopDocs> topDocsPerSubQuery) {
-        Map<Integer, float[]> normalizedScoresPerDoc = new HashMap<>();
-        for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-            TopDocs topDocs = topDocsPerSubQuery.get(j);
-            for (ScoreDoc scoreDoc : topDocs.scoreDocs) {
-                normalizedScoresPerDoc.computeIfAbsent(scoreDoc.doc, key -> {
-                    float[] scores = new float[topDocsPerSubQuery.size()];
-                    // we initialize with -1.0, as after normalization it's possible that score is 0.0
-                    return scores;
-                });
-                normalizedScoresPerDoc.get(scoreDoc.doc)[j] = scoreDoc.score;
+    private NormalizedScores getNormalizedScoresPerDocument(final List<TopDocs> topDocsPerSubQuery, final float[][] ranks) {
+        int numOfSubQueries = topDocsPerSubQuery.size();
+        int maxNumOfDocs = 0;
+        for (TopDocs topDocs : topDocsPerSubQuery) {
+            maxNumOfDocs += topDocs.scoreDocs.length;
+        }
+        NormalizedScores normalizedScores = new NormalizedScores(numOfSubQueries, maxNumOfDocs);
+        // scores of sub-queries that didn't match document stay 0.0, techniques that use ranks get ranks across shards
+        // instead of scores
+        for (int j = 0; j < numOfSubQueries; j++) {
+            ScoreDoc[] scoreDocs = topDocsPerSubQuery.get(j).scoreDocs;
+            for (int i = 0; i < scoreDocs.length; i++) {
+                ScoreDoc scoreDoc = scoreDocs[i];
+                float score = Objects.isNull(ranks) ? scoreDoc.score : ranks[j][i];
+                normalizedScores.scores[normalizedScores.positionOf(scoreDoc.doc) * numOfSubQueries + j] = score;
             }
         }
-        return normalizedScoresPerDoc;
+        return normalizedScores;
     }
 
-    private Map<Integer, Float> combineScoresAndGetCombinedNormalizedScoresPerDocument(
-        final Map<Integer, float[]> normalizedScoresPerDocument,
+    private float[] combineNormalizedScores(
+        final NormalizedScores normalizedScores,
         final ScoreCombinationTechnique scoreCombinationTechnique
     ) {
-        return normalizedScoresPerDocument.entrySet()
-            .stream()
-            .collect(Collectors.toMap(Map.Entry::getKey, entry -> scoreCombinationTechnique.combine(entry.getValue())));
+        float[] combinedScores = new float[normalizedScores.size];
+        for (int position = 0; position < normalizedScores.size; position++) {
+            combinedScores[position] = scoreCombinationTechnique.combine(
+                normalizedScores.scores,
+                position * normalizedScores.numOfSubQueries,
+                normalizedScores.numOfSubQueries
+            );
+        }
+        return combinedScores;
+    }
+
+    /**
+     * Selects positions of documents with highest combined scores using bounded heap, documents with equal scores
+     * are ordered by ascending doc id, so their order doesn't depend on the order of sub-query results
+     * @return positions of top documents, sorted from the highest score to the lowest
+     */
+    private int[] getTopPositions(final int[] docIds, final float[] combinedScores, final int numOfTopDocs) {
+        if (numOfTopDocs <= 0) {
+            return new int[0];
+        }
+        // min heap, least competitive of selected documents is on top
+        int[] heap = new int[numOfTopDocs];
+        int heapSize = 0;
+        for (int position = 0; position < combinedScores.length; position++) {
+            if (heapSize < numOfTopDocs) {
+                heap[heapSize] = position;
+                siftUp(heap, heapSize++, docIds, combinedScores);
+            } else if (isLessCompetitive(heap[0], position, docIds, combinedScores)) {
+                heap[0] = position;
+                siftDown(heap, heapSize, docIds, combinedScores);
+            }
+        }
+        // pop least competitive documents first so array is filled from the end
+        int[] sortedPositions = new int[heapSize];
+        for (int i = heapSize - 1; i >= 0; i--) {
+            sortedPositions[i] = heap[0];
+            heap[0] = heap[--heapSize];
+            siftDown(heap, heapSize, docIds, combinedScores);
+        }
+        return sortedPositions;
     }
 
-    private void updateQueryTopDocsWithCombinedScores(
+    private boolean isLessCompetitive(final int position, final int otherPosition, final int[] docIds, final float[] combinedScores) {
+        int scoreComparison = Float.compare(combinedScores[position], combinedScores[otherPosition]);
+        if (scoreComparison != 0) {
+            return scoreComparison < 0;
+        }
+        return docIds[position] > docIds[otherPosition];
+    }
+
+    private void siftUp(final int[] heap, int index, final int[] docIds, final float[] combinedScores) {
+        int position = heap[index];
+        while (index > 0) {
+            int parent = (index - 1) >>> 1;
+            if (!isLessCompetitive(position, heap[parent], docIds, combinedScores)) {
+                break;
+            }
+            heap[index] = heap[parent];
+            index = parent;
+        }
+        heap[index] = position;
+    }
+
+    private void siftDown(final int[] heap, final int heapSize, final int[] docIds, final float[] combinedScores) {
+        if (heapSize == 0) {
+            return;
+        }
+        int position = heap[0];
+        int index = 0;
+        int child = 1;
+        while (child < heapSize) {
+            if (child + 1 < heapSize && isLessCompetitive(heap[child + 1], heap[child], docIds, combinedScores)) {
+                child++;
+            }
+            if (!isLessCompetitive(heap[child], position, docIds, combinedScores)) {
+                break;
+            }
+            heap[index] = heap[child];
+            index = child;
+            child = 2 * index + 1;
+        }
+        heap[index] = position;
+    }
+
+    private List<ScoreDoc> getCombinedScoreDocs(
         final CompoundTopDocs compoundQueryTopDocs,
-        final List<TopDocs> topDocsPerSubQuery,
-        final Map<Integer, Float> combinedNormalizedScoresByDocId,
-        final List<Integer> sortedScores
+        final int[] docIds,
+        final float[] combinedScores,
+        final int[] sortedPositions
     ) {
-        // - max number of hits will be the same which are passed from QueryPhase
-        long maxHits = compoundQueryTopDocs.getTotalHits().value;
-        // - update query search results with normalized scores
-        compoundQueryTopDocs.setScoreDocs(
-            getCombinedScoreDocs(compoundQueryTopDocs, combinedNormalizedScoresByDocId, sortedScores, maxHits)
-        );
-        compoundQueryTopDocs.setTotalHits(getTotalHits(topDocsPerSubQuery, maxHits));
+        List<ScoreDoc> scoreDocs = new ArrayList<>(sortedPositions.length);
+        if (sortedPositions.length == 0) {
+            return scoreDocs;
+        }
+        int shardId = compoundQueryTopDocs.getScoreDocs().get(0).shardIndex;
+        for (int position : sortedPositions) {
+            scoreDocs.add(new ScoreDoc(docIds[position], combinedScores[position], shardId));
+        }
+        return scoreDocs;
     }
 
     private TotalHits getTotalHits(final List<TopDocs> topDocsPerSubQuery, final long maxHits) {
@@ -136,4 +319,53 @@ public class ScoreCombiner {
         }
         return new TotalHits(maxHits, totalHits);
     }
+
+    /**
+     * Normalized scores of all documents from one shard. Doc ids are mapped to positions with open addressing hash table
+     * of primitive ints, scores are stored in flat array where scores of document at position p are in range
+     * [p * numOfSubQueries, (p + 1) * numOfSubQueries)
+     */
+    private static final class NormalizedScores {
+        private static final int EMPTY_SLOT = -1;
+
+        private final int numOfSubQueries;
+        private final int[] docIds;
+        private final float[] scores;
+        private final int[] positionBySlot;
+        private final int slotMask;
+        private int size;
+
+        NormalizedScores(final int numOfSubQueries, final int maxNumOfDocs) {
+            this.numOfSubQueries = numOfSubQueries;
+            this.docIds = new int[maxNumOfDocs];
+            this.scores = new float[maxNumOfDocs * numOfSubQueries];
+            // keep load factor at or below 0.5
+            int numOfSlots = Integer.highestOneBit(Math.max(2, maxNumOfDocs) * 2 - 1) << 1;
+            this.positionBySlot = new int[numOfSlots];
+            Arrays.fill(positionBySlot, EMPTY_SLOT);
+            this.slotMask = numOfSlots - 1;
+        }
+
+        /**
+         * Returns position of the document, assigns next position if document is seen for the first time
+         */
+        int positionOf(final int docId) {
+            int slot = mix(docId) & slotMask;
+            while (positionBySlot[slot] != EMPTY_SLOT) {
+                int position = positionBySlot[slot];
+                if (docIds[position] == docId) {
+                    return position;
+                }
+                slot = (slot + 1) & slotMask;
+            }
+            positionBySlot[slot] = size;
+            docIds[size] = docId;
+            return size++;
+        }
+
+        private static int mix(final int key) {
+            int hash = key * 0x9E3779B9;
+            return hash ^ (hash >>> 16);
+        }
+    }
 }
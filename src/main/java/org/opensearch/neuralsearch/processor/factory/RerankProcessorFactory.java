@@ -15,6 +15,7 @@ import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.ingest.ConfigurationUtils;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.rerank.MLOpenSearchRerankProcessor;
+import org.opensearch.neuralsearch.processor.rerank.RerankScoreCache;
 import org.opensearch.neuralsearch.processor.rerank.RerankType;
 import org.opensearch.neuralsearch.processor.rerank.context.ContextSourceFetcher;
 import org.opensearch.neuralsearch.processor.rerank.context.DocumentContextSourceFetcher;
@@ -39,6 +40,12 @@ public class RerankProcessorFactory implements Processor.Factory<SearchResponseP
 
     private final MLCommonsClientAccessor clientAccessor;
     private final ClusterService clusterService;
+    // node level cache of scores shared by all processors, null if the cache is disabled
+    private final RerankScoreCache scoreCache;
+
+    public RerankProcessorFactory(final MLCommonsClientAccessor clientAccessor, final ClusterService clusterService) {
+        this(clientAccessor, clusterService, null);
+    }
 
     @Override
     public SearchResponseProcessor create(
@@ -66,12 +73,37 @@ public class RerankProcessorFactory implements Processor.Factory<SearchResponseP
                     rerankerConfig,
                     MLOpenSearchRerankProcessor.MODEL_ID_FIELD
                 );
-                return new MLOpenSearchRerankProcessor(description, tag, ignoreFailure, modelId, contextFetchers, clientAccessor);
+                int rerankWindow = readOptionalPositiveInteger(tag, rerankerConfig, MLOpenSearchRerankProcessor.RERANK_WINDOW_FIELD);
+                int batchSize = readOptionalPositiveInteger(tag, rerankerConfig, MLOpenSearchRerankProcessor.BATCH_SIZE_FIELD);
+                int maxContextChars = readOptionalPositiveInteger(tag, rerankerConfig, MLOpenSearchRerankProcessor.MAX_CONTEXT_CHARS_FIELD);
+                return new MLOpenSearchRerankProcessor(
+                    description,
+                    tag,
+                    ignoreFailure,
+                    modelId,
+                    contextFetchers,
+                    clientAccessor,
+                    rerankWindow,
+                    batchSize,
+                    maxContextChars,
+                    scoreCache
+                );
             default:
                 throw new IllegalArgumentException(String.format(Locale.ROOT, "Cannot build reranker type %s", type.getLabel()));
         }
     }
 
+    private int readOptionalPositiveInteger(final String tag, final Map<String, Object> rerankerConfig, final String fieldName) {
+        Integer value = ConfigurationUtils.readIntProperty(RERANK_PROCESSOR_TYPE, tag, rerankerConfig, fieldName, null);
+        if (value == null) {
+            return MLOpenSearchRerankProcessor.UNLIMITED;
+        }
+        if (value <= 0) {
+            throw new IllegalArgumentException(String.format(Locale.ROOT, "%s must be a positive integer", fieldName));
+        }
+        return value;
+    }
+
     private RerankType findRerankType(final Map<String, Object> config) throws IllegalArgumentException {
         // Set of rerank type labels in the config
         Set<String> rerankTypes = Sets.intersection(config.keySet(), RerankType.labelMap().keySet());
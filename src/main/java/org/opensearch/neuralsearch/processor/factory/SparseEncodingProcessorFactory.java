@@ -4,19 +4,27 @@
  */
 package org.opensearch.neuralsearch.processor.factory;
 
+import static org.opensearch.ingest.ConfigurationUtils.newConfigurationException;
 import static org.opensearch.ingest.ConfigurationUtils.readMap;
+import static org.opensearch.ingest.ConfigurationUtils.readOptionalStringProperty;
 import static org.opensearch.ingest.ConfigurationUtils.readStringProperty;
 import static org.opensearch.neuralsearch.processor.TextEmbeddingProcessor.TYPE;
 import static org.opensearch.neuralsearch.processor.TextEmbeddingProcessor.MODEL_ID_FIELD;
 import static org.opensearch.neuralsearch.processor.TextEmbeddingProcessor.FIELD_MAP_FIELD;
+import static org.opensearch.neuralsearch.processor.SparseEncodingProcessor.PRUNE_RATIO_FIELD;
+import static org.opensearch.neuralsearch.processor.SparseEncodingProcessor.PRUNE_TYPE_FIELD;
+import static org.opensearch.neuralsearch.processor.SparseEncodingProcessor.QUANTIZATION_STEP_FIELD;
 
 import java.util.Map;
+import java.util.Objects;
 
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.env.Environment;
 import org.opensearch.ingest.Processor;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.SparseEncodingProcessor;
+import org.opensearch.neuralsearch.util.prune.PruneType;
 
 import lombok.extern.log4j.Log4j2;
 
@@ -28,11 +36,22 @@ public class SparseEncodingProcessorFactory implements Processor.Factory {
     private final MLCommonsClientAccessor clientAccessor;
     private final Environment environment;
     private final ClusterService clusterService;
+    private final InferenceResultCache<Object> inferenceResultCache;
 
     public SparseEncodingProcessorFactory(MLCommonsClientAccessor clientAccessor, Environment environment, ClusterService clusterService) {
+        this(clientAccessor, environment, clusterService, null);
+    }
+
+    public SparseEncodingProcessorFactory(
+        MLCommonsClientAccessor clientAccessor,
+        Environment environment,
+        ClusterService clusterService,
+        InferenceResultCache<Object> inferenceResultCache
+    ) {
         this.clientAccessor = clientAccessor;
         this.environment = environment;
         this.clusterService = clusterService;
+        this.inferenceResultCache = inferenceResultCache;
     }
 
     @Override
@@ -44,7 +63,37 @@ public class SparseEncodingProcessorFactory implements Processor.Factory {
     ) throws Exception {
         String modelId = readStringProperty(TYPE, processorTag, config, MODEL_ID_FIELD);
         Map<String, Object> fieldMap = readMap(TYPE, processorTag, config, FIELD_MAP_FIELD);
+        PruneType pruneType = PruneType.getPruneType(readOptionalStringProperty(TYPE, processorTag, config, PRUNE_TYPE_FIELD));
+        Float pruneRatio = readOptionalFloatProperty(processorTag, config, PRUNE_RATIO_FIELD);
+        if (pruneType != PruneType.NONE && Objects.isNull(pruneRatio)) {
+            throw newConfigurationException(TYPE, processorTag, PRUNE_RATIO_FIELD, "required property is missing");
+        }
+        Float quantizationStep = readOptionalFloatProperty(processorTag, config, QUANTIZATION_STEP_FIELD);
+
+        return new SparseEncodingProcessor(
+            processorTag,
+            description,
+            modelId,
+            fieldMap,
+            clientAccessor,
+            environment,
+            clusterService,
+            inferenceResultCache,
+            pruneType,
+            Objects.isNull(pruneRatio) ? 0f : pruneRatio,
+            Objects.isNull(quantizationStep) ? 0f : quantizationStep
+        );
+    }
 
-        return new SparseEncodingProcessor(processorTag, description, modelId, fieldMap, clientAccessor, environment, clusterService);
+    private static Float readOptionalFloatProperty(final String processorTag, final Map<String, Object> config, final String propertyName) {
+        Object value = config.remove(propertyName);
+        if (Objects.isNull(value)) {
+            return null;
+        }
+        try {
+            return Float.parseFloat(value.toString());
+        } catch (NumberFormatException e) {
+            throw newConfigurationException(TYPE, processorTag, propertyName, "property must be a number");
+        }
     }
 }
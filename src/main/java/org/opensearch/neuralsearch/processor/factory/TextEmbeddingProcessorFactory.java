@@ -15,6 +15,7 @@ import java.util.Map;
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.env.Environment;
 import org.opensearch.ingest.Processor;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.TextEmbeddingProcessor;
 
@@ -29,14 +30,26 @@ public class TextEmbeddingProcessorFactory implements Processor.Factory {
 
     private final ClusterService clusterService;
 
+    private final InferenceResultCache<Object> inferenceResultCache;
+
     public TextEmbeddingProcessorFactory(
         final MLCommonsClientAccessor clientAccessor,
         final Environment environment,
         final ClusterService clusterService
+    ) {
+        this(clientAccessor, environment, clusterService, null);
+    }
+
+    public TextEmbeddingProcessorFactory(
+        final MLCommonsClientAccessor clientAccessor,
+        final Environment environment,
+        final ClusterService clusterService,
+        final InferenceResultCache<Object> inferenceResultCache
     ) {
         this.clientAccessor = clientAccessor;
         this.environment = environment;
         this.clusterService = clusterService;
+        this.inferenceResultCache = inferenceResultCache;
     }
 
     @Override
@@ -48,6 +61,15 @@ public class TextEmbeddingProcessorFactory implements Processor.Factory {
     ) throws Exception {
         String modelId = readStringProperty(TYPE, processorTag, config, MODEL_ID_FIELD);
         Map<String, Object> filedMap = readMap(TYPE, processorTag, config, FIELD_MAP_FIELD);
-        return new TextEmbeddingProcessor(processorTag, description, modelId, filedMap, clientAccessor, environment, clusterService);
+        return new TextEmbeddingProcessor(
+            processorTag,
+            description,
+            modelId,
+            filedMap,
+            clientAccessor,
+            environment,
+            clusterService,
+            inferenceResultCache
+        );
     }
 }
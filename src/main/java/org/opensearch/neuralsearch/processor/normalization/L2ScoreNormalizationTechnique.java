@@ -4,7 +4,6 @@
  */
 package org.opensearch.neuralsearch.processor.normalization;
 
-import java.util.ArrayList;
 import java.util.List;
 import java.util.Objects;
 
@@ -33,7 +32,7 @@ public class L2ScoreNormalizationTechnique implements ScoreNormalizationTechniqu
     @Override
     public void normalize(final List<CompoundTopDocs> queryTopDocs) {
         // get l2 norms for each sub-query
-        List<Float> normsPerSubquery = getL2Norm(queryTopDocs);
+        float[] normsPerSubquery = getL2Norm(queryTopDocs);
 
         // do normalization using actual score and l2 norm
         for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
@@ -42,15 +41,15 @@ public class L2ScoreNormalizationTechnique implements ScoreNormalizationTechniqu
             }
             List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
             for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                TopDocs subQueryTopDoc = topDocsPerSubQuery.get(j);
-                for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
-                    scoreDoc.score = normalizeSingleScore(scoreDoc.score, normsPerSubquery.get(j));
+                float l2Norm = normsPerSubquery[j];
+                for (ScoreDoc scoreDoc : topDocsPerSubQuery.get(j).scoreDocs) {
+                    scoreDoc.score = normalizeSingleScore(scoreDoc.score, l2Norm);
                 }
             }
         }
     }
 
-    private List<Float> getL2Norm(final List<CompoundTopDocs> queryTopDocs) {
+    private float[] getL2Norm(final List<CompoundTopDocs> queryTopDocs) {
         // find any non-empty compound top docs, it's either empty if shard does not have any results for all of sub-queries,
         // or it has results for all the sub-queries. In edge case of shard having results only for one sub-query, there will be TopDocs for
         // rest of sub-queries with zero total hits
@@ -69,19 +68,17 @@ public class L2ScoreNormalizationTechnique implements ScoreNormalizationTechniqu
             List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
             int bound = topDocsPerSubQuery.size();
             for (int index = 0; index < bound; index++) {
+                float sumOfSquares = l2Norms[index];
                 for (ScoreDoc scoreDocs : topDocsPerSubQuery.get(index).scoreDocs) {
-                    l2Norms[index] += scoreDocs.score * scoreDocs.score;
+                    sumOfSquares += scoreDocs.score * scoreDocs.score;
                 }
+                l2Norms[index] = sumOfSquares;
             }
         }
         for (int index = 0; index < l2Norms.length; index++) {
             l2Norms[index] = (float) Math.sqrt(l2Norms[index]);
         }
-        List<Float> l2NormList = new ArrayList<>();
-        for (int index = 0; index < numOfSubqueries; index++) {
-            l2NormList.add(l2Norms[index]);
-        }
-        return l2NormList;
+        return l2Norms;
     }
 
     private float normalizeSingleScore(final float score, final float l2Norm) {
@@ -30,7 +30,7 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
      * Min-max normalization method.
      * nscore = (score - min_score)/(max_score - min_score)
      * Main algorithm steps:
-     * - calculate min and max scores for each sub query
+     * - calculate min and max scores for each sub query in one pass over all scores
      * - iterate over each result and update score as per formula above where "score" is raw score returned by Hybrid query
      */
     @Override
@@ -42,11 +42,10 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
             .get()
             .getTopDocs()
             .size();
-        // get min scores for each sub query
-        float[] minScoresPerSubquery = getMinScores(queryTopDocs, numOfSubqueries);
-
-        // get max scores for each sub query
-        float[] maxScoresPerSubquery = getMaxScores(queryTopDocs, numOfSubqueries);
+        // get min and max scores for each sub query in a single pass over all scores
+        float[] minScoresPerSubquery = new float[numOfSubqueries];
+        float[] maxScoresPerSubquery = new float[numOfSubqueries];
+        collectMinAndMaxScores(queryTopDocs, minScoresPerSubquery, maxScoresPerSubquery);
 
         // do normalization using actual score and min and max scores for corresponding sub query
         for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
@@ -55,54 +54,34 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
             }
             List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
             for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                TopDocs subQueryTopDoc = topDocsPerSubQuery.get(j);
-                for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
-                    scoreDoc.score = normalizeSingleScore(scoreDoc.score, minScoresPerSubquery[j], maxScoresPerSubquery[j]);
+                float minScore = minScoresPerSubquery[j];
+                float maxScore = maxScoresPerSubquery[j];
+                for (ScoreDoc scoreDoc : topDocsPerSubQuery.get(j).scoreDocs) {
+                    scoreDoc.score = normalizeSingleScore(scoreDoc.score, minScore, maxScore);
                 }
             }
         }
     }
 
-    private float[] getMaxScores(final List<CompoundTopDocs> queryTopDocs, final int numOfSubqueries) {
-        float[] maxScores = new float[numOfSubqueries];
-        Arrays.fill(maxScores, Float.MIN_VALUE);
-        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
-            if (Objects.isNull(compoundQueryTopDocs)) {
-                continue;
-            }
-            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                maxScores[j] = Math.max(
-                    maxScores[j],
-                    Arrays.stream(topDocsPerSubQuery.get(j).scoreDocs)
-                        .map(scoreDoc -> scoreDoc.score)
-                        .max(Float::compare)
-                        .orElse(Float.MIN_VALUE)
-                );
-            }
-        }
-        return maxScores;
-    }
-
-    private float[] getMinScores(final List<CompoundTopDocs> queryTopDocs, final int numOfScores) {
-        float[] minScores = new float[numOfScores];
+    private void collectMinAndMaxScores(final List<CompoundTopDocs> queryTopDocs, final float[] minScores, final float[] maxScores) {
         Arrays.fill(minScores, Float.MAX_VALUE);
+        Arrays.fill(maxScores, Float.MIN_VALUE);
         for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
             if (Objects.isNull(compoundQueryTopDocs)) {
                 continue;
             }
             List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
             for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                minScores[j] = Math.min(
-                    minScores[j],
-                    Arrays.stream(topDocsPerSubQuery.get(j).scoreDocs)
-                        .map(scoreDoc -> scoreDoc.score)
-                        .min(Float::compare)
-                        .orElse(Float.MAX_VALUE)
-                );
+                float minScore = minScores[j];
+                float maxScore = maxScores[j];
+                for (ScoreDoc scoreDoc : topDocsPerSubQuery.get(j).scoreDocs) {
+                    minScore = Math.min(minScore, scoreDoc.score);
+                    maxScore = Math.max(maxScore, scoreDoc.score);
+                }
+                minScores[j] = minScore;
+                maxScores[j] = maxScore;
             }
         }
-        return minScores;
     }
 
     private float normalizeSingleScore(final float score, final float minScore, final float maxScore) {
@@ -4,9 +4,13 @@
  */
 package org.opensearch.neuralsearch.processor.rerank;
 
+import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 import java.util.Locale;
 import java.util.Map;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.stream.Collectors;
 
 import org.opensearch.action.search.SearchResponse;
@@ -16,6 +20,7 @@ import org.opensearch.neuralsearch.processor.factory.RerankProcessorFactory;
 import org.opensearch.neuralsearch.processor.rerank.context.ContextSourceFetcher;
 import org.opensearch.neuralsearch.processor.rerank.context.DocumentContextSourceFetcher;
 import org.opensearch.neuralsearch.processor.rerank.context.QueryContextSourceFetcher;
+import org.opensearch.search.SearchHit;
 
 /**
  * Rescoring Rerank Processor that uses a TextSimilarity model in ml-commons to rescore
@@ -23,11 +28,24 @@ import org.opensearch.neuralsearch.processor.rerank.context.QueryContextSourceFe
 public class MLOpenSearchRerankProcessor extends RescoringRerankProcessor {
 
     public static final String MODEL_ID_FIELD = "model_id";
+    public static final String RERANK_WINDOW_FIELD = "rerank_window";
+    public static final String BATCH_SIZE_FIELD = "batch_size";
+    public static final String MAX_CONTEXT_CHARS_FIELD = "max_context_chars";
+    public static final int UNLIMITED = Integer.MAX_VALUE;
 
     protected final String modelId;
 
     protected final MLCommonsClientAccessor mlCommonsClientAccessor;
 
+    // number of top hits that get rescored by the model
+    private final int rerankWindow;
+    // max number of contexts in one similarity request, requests of one search response are sent in parallel
+    private final int batchSize;
+    // contexts are truncated to this number of chars before they are sent to the model
+    private final int maxContextChars;
+    // node level cache of scores, null if caching is disabled
+    private final RerankScoreCache scoreCache;
+
     /**
      * Constructor
      * @param description
@@ -44,10 +62,84 @@ public class MLOpenSearchRerankProcessor extends RescoringRerankProcessor {
         final String modelId,
         final List<ContextSourceFetcher> contextSourceFetchers,
         final MLCommonsClientAccessor mlCommonsClientAccessor
+    ) {
+        this(description, tag, ignoreFailure, modelId, contextSourceFetchers, mlCommonsClientAccessor, UNLIMITED, UNLIMITED, UNLIMITED);
+    }
+
+    /**
+     * Constructor
+     * @param description
+     * @param tag
+     * @param ignoreFailure
+     * @param modelId id of TEXT_SIMILARITY model
+     * @param contextSourceFetchers
+     * @param mlCommonsClientAccessor
+     * @param rerankWindow number of top hits to rescore
+     * @param batchSize max number of contexts in one similarity request
+     * @param maxContextChars max number of chars of one context sent to the model
+     */
+    public MLOpenSearchRerankProcessor(
+        final String description,
+        final String tag,
+        final boolean ignoreFailure,
+        final String modelId,
+        final List<ContextSourceFetcher> contextSourceFetchers,
+        final MLCommonsClientAccessor mlCommonsClientAccessor,
+        final int rerankWindow,
+        final int batchSize,
+        final int maxContextChars
+    ) {
+        this(
+            description,
+            tag,
+            ignoreFailure,
+            modelId,
+            contextSourceFetchers,
+            mlCommonsClientAccessor,
+            rerankWindow,
+            batchSize,
+            maxContextChars,
+            null
+        );
+    }
+
+    /**
+     * Constructor
+     * @param description
+     * @param tag
+     * @param ignoreFailure
+     * @param modelId id of TEXT_SIMILARITY model
+     * @param contextSourceFetchers
+     * @param mlCommonsClientAccessor
+     * @param rerankWindow number of top hits to rescore
+     * @param batchSize max number of contexts in one similarity request
+     * @param maxContextChars max number of chars of one context sent to the model
+     * @param scoreCache cache of scores, only cache misses are sent to the model. May be null
+     */
+    public MLOpenSearchRerankProcessor(
+        final String description,
+        final String tag,
+        final boolean ignoreFailure,
+        final String modelId,
+        final List<ContextSourceFetcher> contextSourceFetchers,
+        final MLCommonsClientAccessor mlCommonsClientAccessor,
+        final int rerankWindow,
+        final int batchSize,
+        final int maxContextChars,
+        final RerankScoreCache scoreCache
     ) {
         super(RerankType.ML_OPENSEARCH, description, tag, ignoreFailure, contextSourceFetchers);
         this.modelId = modelId;
         this.mlCommonsClientAccessor = mlCommonsClientAccessor;
+        this.rerankWindow = rerankWindow;
+        this.batchSize = batchSize;
+        this.maxContextChars = maxContextChars;
+        this.scoreCache = scoreCache;
+    }
+
+    @Override
+    protected int getRerankWindowSize(final int numberOfHits) {
+        return Math.min(rerankWindow, numberOfHits);
     }
 
     @Override
@@ -71,13 +163,106 @@ public class MLOpenSearchRerankProcessor extends RescoringRerankProcessor {
             return;
         }
         List<?> ctxList = (List<?>) ctxObj;
-        List<String> contexts = ctxList.stream().map(str -> (String) str).collect(Collectors.toList());
-        mlCommonsClientAccessor.inferenceSimilarity(
-            modelId,
-            (String) rerankingContext.get(QueryContextSourceFetcher.QUERY_TEXT_FIELD),
-            contexts,
-            listener
-        );
+        List<String> contexts = ctxList.subList(0, getRerankWindowSize(ctxList.size()))
+            .stream()
+            .map(str -> truncateContext((String) str))
+            .collect(Collectors.toList());
+        String queryText = (String) rerankingContext.get(QueryContextSourceFetcher.QUERY_TEXT_FIELD);
+        SearchHit[] hits = response.getHits().getHits();
+        if (scoreCache == null || hits.length < contexts.size()) {
+            inferenceSimilarity(queryText, contexts, listener);
+            return;
+        }
+        inferenceSimilarityWithCache(queryText, hits, contexts, listener);
+    }
+
+    private void inferenceSimilarity(final String queryText, final List<String> contexts, final ActionListener<List<Float>> listener) {
+        if (contexts.size() <= batchSize) {
+            mlCommonsClientAccessor.inferenceSimilarity(modelId, queryText, contexts, listener);
+            return;
+        }
+        inferenceSimilarityInBatches(queryText, contexts, listener);
+    }
+
+    private void inferenceSimilarityWithCache(
+        final String queryText,
+        final SearchHit[] hits,
+        final List<String> contexts,
+        final ActionListener<List<Float>> listener
+    ) {
+        Float[] scores = new Float[contexts.size()];
+        RerankScoreCacheKey[] keys = new RerankScoreCacheKey[contexts.size()];
+        List<Integer> missedPositions = new ArrayList<>();
+        List<String> missedContexts = new ArrayList<>();
+        for (int i = 0; i < contexts.size(); i++) {
+            keys[i] = RerankScoreCacheKey.of(modelId, queryText, hits[i], contexts.get(i));
+            scores[i] = scoreCache.get(keys[i]);
+            if (scores[i] == null) {
+                missedPositions.add(i);
+                missedContexts.add(contexts.get(i));
+            }
+        }
+        if (missedPositions.isEmpty()) {
+            listener.onResponse(Arrays.asList(scores));
+            return;
+        }
+        inferenceSimilarity(queryText, missedContexts, ActionListener.wrap(missedScores -> {
+            if (missedScores == null || missedScores.size() != missedPositions.size()) {
+                throw new IllegalStateException("scores and hits are not the same length");
+            }
+            for (int i = 0; i < missedPositions.size(); i++) {
+                int position = missedPositions.get(i);
+                scores[position] = missedScores.get(i);
+                if (scores[position] != null) {
+                    scoreCache.put(keys[position], scores[position]);
+                }
+            }
+            listener.onResponse(Arrays.asList(scores));
+        }, listener::onFailure));
+    }
+
+    private void inferenceSimilarityInBatches(
+        final String queryText,
+        final List<String> contexts,
+        final ActionListener<List<Float>> listener
+    ) {
+        int numberOfBatches = (contexts.size() + batchSize - 1) / batchSize;
+        Float[] scores = new Float[contexts.size()];
+        AtomicInteger pendingBatches = new AtomicInteger(numberOfBatches);
+        AtomicBoolean failed = new AtomicBoolean();
+        for (int batch = 0; batch < numberOfBatches; batch++) {
+            int start = batch * batchSize;
+            int end = Math.min(start + batchSize, contexts.size());
+            ActionListener<List<Float>> batchListener = ActionListener.wrap(batchScores -> {
+                if (batchScores == null || batchScores.size() != end - start) {
+                    throw new IllegalStateException("scores and hits are not the same length");
+                }
+                for (int i = start; i < end; i++) {
+                    scores[i] = batchScores.get(i - start);
+                }
+                // decrement publishes scores of this batch to the thread that completes the last batch
+                if (pendingBatches.decrementAndGet() == 0 && !failed.get()) {
+                    listener.onResponse(Arrays.asList(scores));
+                }
+            }, e -> {
+                if (failed.compareAndSet(false, true)) {
+                    listener.onFailure(e);
+                }
+            });
+            mlCommonsClientAccessor.inferenceSimilarity(modelId, queryText, contexts.subList(start, end), batchListener);
+        }
+    }
+
+    private String truncateContext(final String context) {
+        if (context.length() <= maxContextChars) {
+            return context;
+        }
+        int end = maxContextChars;
+        // don't split a surrogate pair
+        if (Character.isHighSurrogate(context.charAt(end - 1))) {
+            end--;
+        }
+        return context.substring(0, end);
     }
 
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.rerank;
+
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.common.cache.Cache;
+import org.opensearch.common.cache.CacheBuilder;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.common.unit.ByteSizeValue;
+
+/**
+ * Node level cache of cross encoder scores shared by all rerank processors. Entries are bounded by memory and expire
+ * after a configured time, scores of updated documents are never reused as their keys include document version.
+ */
+public class RerankScoreCache {
+
+    private static final long SCORE_SIZE = RamUsageEstimator.shallowSizeOfInstance(Float.class);
+
+    private final Cache<RerankScoreCacheKey, Float> cache;
+
+    public RerankScoreCache(final ByteSizeValue maxSize, final TimeValue expireAfterWrite) {
+        this.cache = CacheBuilder.<RerankScoreCacheKey, Float>builder()
+            .setMaximumWeight(maxSize.getBytes())
+            .weigher((key, value) -> key.ramBytesUsed() + SCORE_SIZE)
+            .setExpireAfterWrite(expireAfterWrite)
+            .build();
+    }
+
+    /**
+     * Returns cached score for the key
+     * @param key cache key
+     * @return cached score or null if there is no such entry
+     */
+    public Float get(final RerankScoreCacheKey key) {
+        return cache.get(key);
+    }
+
+    /**
+     * Adds score to the cache, replacing existing entry for the key
+     * @param key cache key
+     * @param score score returned by the model
+     */
+    public void put(final RerankScoreCacheKey key, final Float score) {
+        cache.put(key, score);
+    }
+
+    /**
+     * Removes all entries from the cache
+     */
+    public void invalidateAll() {
+        cache.invalidateAll();
+    }
+
+    /**
+     * Number of entries in the cache
+     * @return entries count
+     */
+    public int count() {
+        return cache.count();
+    }
+
+    /**
+     * Approximate memory used by cache entries
+     * @return memory in bytes
+     */
+    public long weight() {
+        return cache.weight();
+    }
+
+    /**
+     * Hits, misses and evictions recorded by the cache so far
+     * @return cache statistics
+     */
+    public Cache.CacheStats stats() {
+        return cache.stats();
+    }
+
+    /**
+     * Share of lookups that found a score in the cache
+     * @return hit rate between 0 and 1, 0 if there were no lookups
+     */
+    public double hitRate() {
+        Cache.CacheStats stats = cache.stats();
+        long lookups = stats.getHits() + stats.getMisses();
+        return lookups == 0 ? 0.0 : (double) stats.getHits() / lookups;
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.rerank;
+
+import java.nio.charset.StandardCharsets;
+import java.util.Objects;
+
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.common.hash.MessageDigests;
+import org.opensearch.search.SearchHit;
+
+/**
+ * Key of a cross encoder score kept in {@link RerankScoreCache}. Hits are identified by index, id and a digest of the
+ * context sent to the model, so pipelines that build different contexts for the same document never share a score.
+ * Hits that carry a version or a sequence number get a new key once the document is updated.
+ */
+public final class RerankScoreCacheKey {
+
+    private static final long SHALLOW_SIZE = RamUsageEstimator.shallowSizeOfInstance(RerankScoreCacheKey.class);
+
+    private final String modelId;
+    private final String queryText;
+    private final String index;
+    private final String id;
+    private final long version;
+    private final long seqNo;
+    private final long primaryTerm;
+    private final String contextDigest;
+    private final int hashCode;
+
+    private RerankScoreCacheKey(
+        final String modelId,
+        final String queryText,
+        final String index,
+        final String id,
+        final long version,
+        final long seqNo,
+        final long primaryTerm,
+        final String contextDigest
+    ) {
+        this.modelId = modelId;
+        this.queryText = queryText;
+        this.index = index;
+        this.id = id;
+        this.version = version;
+        this.seqNo = seqNo;
+        this.primaryTerm = primaryTerm;
+        this.contextDigest = contextDigest;
+        this.hashCode = Objects.hash(modelId, queryText, index, id, version, seqNo, primaryTerm, contextDigest);
+    }
+
+    /**
+     * Creates key for the score of one search hit
+     * @param modelId id of the text similarity model
+     * @param queryText query text the hit is scored against
+     * @param hit search hit
+     * @param context document context sent to the model for the hit
+     * @return new cache key
+     */
+    public static RerankScoreCacheKey of(final String modelId, final String queryText, final SearchHit hit, final String context) {
+        return new RerankScoreCacheKey(
+            modelId,
+            queryText,
+            hit.getIndex(),
+            hit.getId(),
+            hit.getVersion(),
+            hit.getSeqNo(),
+            hit.getPrimaryTerm(),
+            digestOf(context)
+        );
+    }
+
+    /**
+     * Approximate number of bytes taken by the key, used to weigh cache entries
+     * @return size of the key in bytes
+     */
+    public long ramBytesUsed() {
+        long size = SHALLOW_SIZE + RamUsageEstimator.sizeOf(modelId) + RamUsageEstimator.sizeOf(queryText);
+        size += RamUsageEstimator.sizeOf(index) + RamUsageEstimator.sizeOf(id) + RamUsageEstimator.sizeOf(contextDigest);
+        return size;
+    }
+
+    private static String digestOf(final String value) {
+        return MessageDigests.toHexString(MessageDigests.sha256().digest(value.getBytes(StandardCharsets.UTF_8)));
+    }
+
+    @Override
+    public boolean equals(Object o) {
+        if (this == o) return true;
+        if (o == null || getClass() != o.getClass()) return false;
+        RerankScoreCacheKey that = (RerankScoreCacheKey) o;
+        return hashCode == that.hashCode
+            && version == that.version
+            && seqNo == that.seqNo
+            && primaryTerm == that.primaryTerm
+            && Objects.equals(modelId, that.modelId)
+            && Objects.equals(queryText, that.queryText)
+            && Objects.equals(index, that.index)
+            && Objects.equals(id, that.id)
+            && Objects.equals(contextDigest, that.contextDigest);
+    }
+
+    @Override
+    public int hashCode() {
+        return hashCode;
+    }
+}
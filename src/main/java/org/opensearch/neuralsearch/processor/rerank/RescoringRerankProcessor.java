@@ -13,12 +13,13 @@ import org.opensearch.action.search.SearchResponse;
 import org.opensearch.action.search.SearchResponseSections;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.neuralsearch.processor.rerank.context.ContextSourceFetcher;
+import org.opensearch.neuralsearch.stats.NeuralStats;
 import org.opensearch.search.SearchHit;
 import org.opensearch.search.SearchHits;
 import org.opensearch.search.profile.SearchProfileShardResults;
 
 /**
- * RerankProcessor that rescores all the documents and re-sorts them using the new scores
+ * RerankProcessor that rescores the top documents and re-sorts them using the new scores
  */
 public abstract class RescoringRerankProcessor extends RerankProcessor {
 
@@ -52,6 +53,16 @@ public abstract class RescoringRerankProcessor extends RerankProcessor {
         final ActionListener<List<Float>> listener
     );
 
+    /**
+     * Number of top search hits that get new scores, the rest of the hits keep their scores and order.
+     * Scores of the hits past the window come from the original query and are not comparable to the new scores
+     * @param numberOfHits number of hits in the search response
+     * @return number of hits to rescore
+     */
+    protected int getRerankWindowSize(final int numberOfHits) {
+        return numberOfHits;
+    }
+
     @Override
     public void rerank(
         final SearchResponse searchResponse,
@@ -63,26 +74,32 @@ public abstract class RescoringRerankProcessor extends RerankProcessor {
                 listener.onResponse(searchResponse);
                 return;
             }
-            rescoreSearchResponse(searchResponse, rerankingContext, ActionListener.wrap(scores -> {
+            ActionListener<List<Float>> scoresListener = ActionListener.wrap(scores -> {
                 // Assign new scores
                 SearchHit[] hits = searchResponse.getHits().getHits();
                 if (scores == null) {
                     throw new IllegalStateException("scores cannot be null");
                 }
-                if (hits.length != scores.size()) {
+                int windowSize = getRerankWindowSize(hits.length);
+                if (windowSize != scores.size()) {
                     throw new IllegalStateException("scores and hits are not the same length");
                 }
                 // NOTE: Assumes that the new scores came back in the same order
-                for (int i = 0; i < hits.length; i++) {
+                for (int i = 0; i < windowSize; i++) {
                     hits[i].score(scores.get(i));
                 }
-                // Re-sort by the new scores. Backwards comparison for desc ordering
-                Collections.sort(Arrays.asList(hits), (hit1, hit2) -> Float.compare(hit2.getScore(), hit1.getScore()));
+                // Re-sort hits of the window by the new scores. Backwards comparison for desc ordering
+                Collections.sort(
+                    Arrays.asList(hits).subList(0, windowSize),
+                    (hit1, hit2) -> Float.compare(hit2.getScore(), hit1.getScore())
+                );
+                // Max score is taken from the reranked window only, hits past the window keep scores on another scale
+                float maxScore = windowSize > 0 ? hits[0].getScore() : searchResponse.getHits().getMaxScore();
                 // Reconstruct the search response, replacing the max score
                 SearchHits newHits = new SearchHits(
                     hits,
                     searchResponse.getHits().getTotalHits(),
-                    hits[0].getScore(),
+                    maxScore,
                     searchResponse.getHits().getSortFields(),
                     searchResponse.getHits().getCollapseField(),
                     searchResponse.getHits().getCollapseValues()
@@ -110,7 +127,13 @@ public abstract class RescoringRerankProcessor extends RerankProcessor {
                     searchResponse.pointInTimeId()
                 );
                 listener.onResponse(newResponse);
-            }, e -> { listener.onFailure(e); }));
+            }, e -> { listener.onFailure(e); });
+            // time of the model call, hits are re-sorted after the time is recorded
+            rescoreSearchResponse(
+                searchResponse,
+                rerankingContext,
+                NeuralStats.instance().timedListener(NeuralStats.RERANK_TIME, scoresListener)
+            );
         } catch (Exception e) {
             listener.onFailure(e);
         }
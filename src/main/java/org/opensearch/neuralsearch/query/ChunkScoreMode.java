@@ -0,0 +1,50 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.query;
+
+import java.util.Arrays;
+import java.util.Locale;
+import java.util.stream.Collectors;
+
+import lombok.Getter;
+
+/**
+ * Aggregation of scores of chunks of one parent document when a neural query runs on a vector field of nested chunks
+ */
+public enum ChunkScoreMode {
+
+    // score of the best matching chunk
+    MAX("max"),
+    // sum of scores of matching chunks
+    SUM("sum");
+
+    @Getter
+    private final String label;
+
+    ChunkScoreMode(final String label) {
+        this.label = label;
+    }
+
+    /**
+     * Construct a ChunkScoreMode from the label
+     * @param label label of a ChunkScoreMode
+     * @return ChunkScoreMode represented by the label
+     */
+    public static ChunkScoreMode from(final String label) {
+        for (ChunkScoreMode mode : values()) {
+            if (mode.label.equals(label)) {
+                return mode;
+            }
+        }
+        throw new IllegalArgumentException(
+            String.format(
+                Locale.ROOT,
+                "unsupported chunk score mode [%s], supported modes are %s",
+                label,
+                Arrays.stream(values()).map(ChunkScoreMode::getLabel).collect(Collectors.toList())
+            )
+        );
+    }
+}
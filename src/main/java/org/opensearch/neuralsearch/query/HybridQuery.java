@@ -121,7 +121,7 @@ public final class HybridQuery extends Query implements Iterable<Query> {
             queryRewriteTasks.add(() -> rewriteQuery(subQuery, collector));
         }
 
-        HybridQueryExecutor.getExecutor().invokeAll(queryRewriteTasks);
+        HybridQueryExecutor.invokeAll(queryRewriteTasks);
 
         final boolean isAnyQueryRewritten = manager.anyQueryRewrite(collectors);
         if (isAnyQueryRewritten == false) {
@@ -19,6 +19,7 @@ import org.opensearch.neuralsearch.search.HybridDisiWrapper;
 
 import java.io.IOException;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.List;
@@ -41,7 +42,9 @@ public final class HybridQueryScorer extends Scorer {
     private final DocIdSetIterator approximation;
     private final HybridScoreBlockBoundaryPropagator disjunctionBlockPropagator;
     private final TwoPhase twoPhase;
+    @Getter
     private final int numSubqueries;
+    private final ScoreMode scoreMode;
 
     public HybridQueryScorer(final Weight weight, final List<Scorer> subScorers) throws IOException {
         this(weight, subScorers, ScoreMode.TOP_SCORES);
@@ -51,6 +54,7 @@ public final class HybridQueryScorer extends Scorer {
         super(weight);
         this.subScorers = Collections.unmodifiableList(subScorers);
         this.numSubqueries = subScorers.size();
+        this.scoreMode = scoreMode;
         this.subScorersPQ = initializeSubScorersPQ();
         boolean needsScores = scoreMode != ScoreMode.COMPLETE_NO_SCORES;
 
@@ -163,6 +167,48 @@ public final class HybridQueryScorer extends Scorer {
         }
     }
 
+    /**
+     * Set minimum competitive score for a single sub-query. Scorer of that sub-query may skip docs and blocks of docs that
+     * score less than this value, other sub-queries are not affected. Used by collectors that keep separate top hits per sub-query.
+     * @param subQueryIndex index of the sub-query in hybrid query
+     * @param minScore minimum competitive score of the sub-query
+     * @throws IOException
+     */
+    public void setMinCompetitiveScore(final int subQueryIndex, final float minScore) throws IOException {
+        Scorer scorer = subScorers.get(subQueryIndex);
+        if (Objects.isNull(scorer)) {
+            return;
+        }
+        if (disjunctionBlockPropagator != null) {
+            disjunctionBlockPropagator.setMinCompetitiveScore(subQueryIndex, minScore);
+        }
+        scorer.setMinCompetitiveScore(minScore);
+    }
+
+    /**
+     * Check if scorers of sub-queries can skip non-competitive docs. That's only possible when scorer is created for top scores,
+     * in other modes collectors may need every matching doc.
+     * @return true if min competitive scores can be set for sub-queries
+     */
+    public boolean isMinCompetitiveScoreSupported() {
+        return scoreMode == ScoreMode.TOP_SCORES;
+    }
+
+    /**
+     * Check if a single sub-query may still match docs of the segment with score above given one
+     * @param subQueryIndex index of the sub-query in hybrid query
+     * @param minScore score that matched docs must exceed
+     * @return false if sub-query doesn't match any of remaining docs of the segment, or their max score is not above minScore
+     * @throws IOException
+     */
+    public boolean hasCompetitiveDocs(final int subQueryIndex, final float minScore) throws IOException {
+        Scorer scorer = subScorers.get(subQueryIndex);
+        if (Objects.isNull(scorer) || scorer.docID() == DocIdSetIterator.NO_MORE_DOCS) {
+            return false;
+        }
+        return scorer.getMaxScore(DocIdSetIterator.NO_MORE_DOCS) > minScore;
+    }
+
     /**
      * Returns the doc ID that is currently being scored.
      * @return document id
@@ -182,6 +228,18 @@ public final class HybridQueryScorer extends Scorer {
      */
     public float[] hybridScores() throws IOException {
         float[] scores = new float[numSubqueries];
+        hybridScores(scores);
+        return scores;
+    }
+
+    /**
+     * Fill provided array with scores per sub-query for doc id that is defined by current iterator position. Allows to reuse
+     * the same array for every collected doc
+     * @param scores array with length of at least number of sub-queries, sub-queries without match get score 0.0
+     * @throws IOException
+     */
+    public void hybridScores(final float[] scores) throws IOException {
+        Arrays.fill(scores, 0, numSubqueries, 0.0f);
         DisiWrapper topList = subScorersPQ.topList();
         for (HybridDisiWrapper disiWrapper = (HybridDisiWrapper) topList; disiWrapper != null; disiWrapper =
             (HybridDisiWrapper) disiWrapper.next) {
@@ -192,7 +250,6 @@ public final class HybridQueryScorer extends Scorer {
             }
             scores[disiWrapper.getSubQueryIndex()] = scorer.score();
         }
-        return scores;
     }
 
     private DisiPriorityQueue initializeSubScorersPQ() {
@@ -87,7 +87,7 @@ public final class HybridQueryWeight extends Weight {
             collectors.add(collector);
             scoreSupplierTasks.add(() -> addScoreSupplier(weight, collector));
         }
-        HybridQueryExecutor.getExecutor().invokeAll(scoreSupplierTasks);
+        HybridQueryExecutor.invokeAll(scoreSupplierTasks);
         final List<ScorerSupplier> scorerSuppliers = manager.mergeScoreSuppliers(collectors);
         if (scorerSuppliers.isEmpty()) {
             return null;
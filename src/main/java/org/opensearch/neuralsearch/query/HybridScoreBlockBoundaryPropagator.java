@@ -9,9 +9,10 @@ import org.apache.lucene.search.Scorer;
 
 import java.io.IOException;
 import java.util.Arrays;
-import java.util.Collection;
 import java.util.Comparator;
+import java.util.List;
 import java.util.Objects;
+import java.util.stream.IntStream;
 
 /**
  * This class functions as a utility for propagating block boundaries within disjunctions.
@@ -20,7 +21,8 @@ import java.util.Objects;
  * particularly when dealing with high minimum competitive scores and clauses with low scores that no longer
  * significantly contribute to the iteration process. Therefore, this class computes block boundaries solely for clauses
  * with a maximum score equal to or exceeding the minimum competitive score, or for the clause with the maximum
- * score if such a clause is absent.
+ * score if such a clause is absent. Clauses that got minimum competitive score of their own sub-query above their maximum
+ * score are not considered either, as they can't produce competitive hits for that sub-query.
  */
 public class HybridScoreBlockBoundaryPropagator {
 
@@ -34,25 +36,44 @@ public class HybridScoreBlockBoundaryPropagator {
 
     private final Scorer[] scorers;
     private final float[] maxScores;
+    // position in the sorted array of scorers for each sub-query, -1 if there is no scorer for the sub-query
+    private final int[] positionBySubQueryIndex;
+    private final boolean[] nonCompetitive;
     private int leadIndex = 0;
 
-    HybridScoreBlockBoundaryPropagator(final Collection<Scorer> scorers) throws IOException {
-        this.scorers = scorers.stream().filter(Objects::nonNull).toArray(Scorer[]::new);
-        for (Scorer scorer : this.scorers) {
-            scorer.advanceShallow(0);
+    HybridScoreBlockBoundaryPropagator(final List<Scorer> scorers) throws IOException {
+        Integer[] subQueryIndexes = IntStream.range(0, scorers.size())
+            .filter(subQueryIndex -> Objects.nonNull(scorers.get(subQueryIndex)))
+            .boxed()
+            .toArray(Integer[]::new);
+        for (int subQueryIndex : subQueryIndexes) {
+            scorers.get(subQueryIndex).advanceShallow(0);
+        }
+        Arrays.sort(subQueryIndexes, Comparator.comparing(scorers::get, MAX_SCORE_COMPARATOR));
+
+        this.scorers = new Scorer[subQueryIndexes.length];
+        this.positionBySubQueryIndex = new int[scorers.size()];
+        Arrays.fill(positionBySubQueryIndex, -1);
+        for (int i = 0; i < subQueryIndexes.length; ++i) {
+            this.scorers[i] = scorers.get(subQueryIndexes[i]);
+            positionBySubQueryIndex[subQueryIndexes[i]] = i;
         }
-        Arrays.sort(this.scorers, MAX_SCORE_COMPARATOR);
 
         maxScores = new float[this.scorers.length];
         for (int i = 0; i < this.scorers.length; ++i) {
             maxScores[i] = this.scorers[i].getMaxScore(DocIdSetIterator.NO_MORE_DOCS);
         }
+        nonCompetitive = new boolean[this.scorers.length];
     }
 
     /** See {@link Scorer#advanceShallow(int)}. */
     int advanceShallow(int target) throws IOException {
-        // For scorers that are below the lead index, just propagate.
-        for (int i = 0; i < leadIndex; ++i) {
+        int lead = leadPosition();
+        // For scorers that are below the lead index or can't compete for their sub-query, just propagate.
+        for (int i = 0; i < scorers.length; ++i) {
+            if (i == lead || (i > leadIndex && !nonCompetitive[i])) {
+                continue;
+            }
             Scorer s = scorers[i];
             if (s.docID() < target) {
                 s.advanceShallow(target);
@@ -61,12 +82,12 @@ public class HybridScoreBlockBoundaryPropagator {
 
         // For scorers above the lead index, we take the minimum
         // boundary.
-        Scorer leadScorer = scorers[leadIndex];
+        Scorer leadScorer = scorers[lead];
         int upTo = leadScorer.advanceShallow(Math.max(leadScorer.docID(), target));
 
-        for (int i = leadIndex + 1; i < scorers.length; ++i) {
+        for (int i = lead + 1; i < scorers.length; ++i) {
             Scorer scorer = scorers[i];
-            if (scorer.docID() <= target) {
+            if (!nonCompetitive[i] && scorer.docID() <= target) {
                 upTo = Math.min(scorer.advanceShallow(target), upTo);
             }
         }
@@ -74,7 +95,10 @@ public class HybridScoreBlockBoundaryPropagator {
         // If the maximum scoring clauses are beyond `target`, then we use their
         // docID as a boundary. It helps not consider them when computing the
         // maximum score and get a lower score upper bound.
-        for (int i = scorers.length - 1; i > leadIndex; --i) {
+        for (int i = scorers.length - 1; i > lead; --i) {
+            if (nonCompetitive[i]) {
+                continue;
+            }
             Scorer scorer = scorers[i];
             if (scorer.docID() > target) {
                 upTo = Math.min(upTo, scorer.docID() - 1);
@@ -96,4 +120,28 @@ public class HybridScoreBlockBoundaryPropagator {
             leadIndex++;
         }
     }
+
+    /**
+     * Set the minimum competitive score of one sub-query, clause of that sub-query is not considered for block boundaries
+     * once the threshold is above its maximum score.
+     *
+     * @param subQueryIndex index of the sub-query
+     * @param minScore minimum competitive score of the sub-query
+     */
+    void setMinCompetitiveScore(final int subQueryIndex, final float minScore) {
+        int position = positionBySubQueryIndex[subQueryIndex];
+        if (position >= 0 && minScore > maxScores[position]) {
+            nonCompetitive[position] = true;
+        }
+    }
+
+    private int leadPosition() {
+        for (int i = leadIndex; i < scorers.length; ++i) {
+            if (!nonCompetitive[i]) {
+                return i;
+            }
+        }
+        // none of the clauses is competitive, use the one with the maximum score
+        return scorers.length - 1;
+    }
 }
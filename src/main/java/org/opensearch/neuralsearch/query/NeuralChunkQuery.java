@@ -0,0 +1,369 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.query;
+
+import java.io.IOException;
+import java.util.Arrays;
+import java.util.Locale;
+import java.util.Objects;
+
+import org.apache.lucene.index.LeafReaderContext;
+import org.apache.lucene.search.BooleanClause;
+import org.apache.lucene.search.DocIdSetIterator;
+import org.apache.lucene.search.Explanation;
+import org.apache.lucene.search.IndexSearcher;
+import org.apache.lucene.search.MatchNoDocsQuery;
+import org.apache.lucene.search.Query;
+import org.apache.lucene.search.QueryVisitor;
+import org.apache.lucene.search.ScoreMode;
+import org.apache.lucene.search.Scorer;
+import org.apache.lucene.search.Weight;
+import org.apache.lucene.search.join.BitSetProducer;
+import org.apache.lucene.util.ArrayUtil;
+import org.apache.lucene.util.BitSet;
+import org.apache.lucene.util.Bits;
+import org.apache.lucene.util.IntroSorter;
+
+import lombok.AllArgsConstructor;
+import lombok.Getter;
+
+/**
+ * Scores parent documents by k-NN scores of their nested chunks. On rewrite the chunk query is executed once and chunk
+ * scores are aggregated per parent, the best chunk score for max mode and the sum of scores of all retrieved chunks for
+ * sum mode. Parents with the highest aggregated scores are selected. Result is a query over a fixed set of parent
+ * documents and their scores, it can be a sub-query of hybrid query like any other query.
+ */
+@AllArgsConstructor
+@Getter
+public final class NeuralChunkQuery extends Query {
+
+    private final Query chunkQuery;
+    private final BitSetProducer parentFilter;
+    private final ChunkScoreMode chunkScoreMode;
+    private final int maxParents;
+
+    @Override
+    public Query rewrite(final IndexSearcher indexSearcher) throws IOException {
+        Weight chunkWeight = indexSearcher.createWeight(indexSearcher.rewrite(chunkQuery), ScoreMode.COMPLETE, 1.0f);
+        int numberOfChunks = 0;
+        int[] chunkParents = new int[16];
+        float[] chunkScores = new float[16];
+        for (LeafReaderContext leafReaderContext : indexSearcher.getIndexReader().leaves()) {
+            Scorer scorer = chunkWeight.scorer(leafReaderContext);
+            BitSet parents = parentFilter.getBitSet(leafReaderContext);
+            if (Objects.isNull(scorer) || Objects.isNull(parents)) {
+                continue;
+            }
+            Bits liveDocs = leafReaderContext.reader().getLiveDocs();
+            DocIdSetIterator iterator = scorer.iterator();
+            for (int doc = iterator.nextDoc(); doc != DocIdSetIterator.NO_MORE_DOCS; doc = iterator.nextDoc()) {
+                if (Objects.nonNull(liveDocs) && !liveDocs.get(doc)) {
+                    continue;
+                }
+                // parent document of a block is indexed right after its nested documents
+                int parent = parents.nextSetBit(doc);
+                if (parent == DocIdSetIterator.NO_MORE_DOCS) {
+                    continue;
+                }
+                chunkParents = ArrayUtil.grow(chunkParents, numberOfChunks + 1);
+                chunkScores = ArrayUtil.grow(chunkScores, numberOfChunks + 1);
+                chunkParents[numberOfChunks] = leafReaderContext.docBase + parent;
+                chunkScores[numberOfChunks] = scorer.score();
+                numberOfChunks++;
+            }
+        }
+        if (numberOfChunks == 0) {
+            return new MatchNoDocsQuery("no chunks matched the neural query");
+        }
+        // chunks are visited in doc id order and chunks of a parent are indexed in one block before the parent, so
+        // chunks of every parent form one run of adjacent entries
+        int numberOfParents = 0;
+        int[] parentDocs = new int[numberOfChunks];
+        float[] parentScores = new float[numberOfChunks];
+        for (int i = 0; i < numberOfChunks; i++) {
+            if (numberOfParents > 0 && parentDocs[numberOfParents - 1] == chunkParents[i]) {
+                int slot = numberOfParents - 1;
+                parentScores[slot] = chunkScoreMode == ChunkScoreMode.SUM
+                    ? parentScores[slot] + chunkScores[i]
+                    : Math.max(parentScores[slot], chunkScores[i]);
+                continue;
+            }
+            parentDocs[numberOfParents] = chunkParents[i];
+            parentScores[numberOfParents] = chunkScores[i];
+            numberOfParents++;
+        }
+        if (numberOfParents > maxParents) {
+            // parents with highest aggregated scores
+            sortByScoreDescending(parentDocs, parentScores, numberOfParents);
+            numberOfParents = maxParents;
+        }
+        return ParentScoreQuery.create(
+            Arrays.copyOf(parentDocs, numberOfParents),
+            Arrays.copyOf(parentScores, numberOfParents),
+            chunkScoreMode,
+            indexSearcher.getIndexReader().getContext().id()
+        );
+    }
+
+    private static void sortByScoreDescending(final int[] docs, final float[] scores, final int length) {
+        new IntroSorter() {
+            private float pivotScore;
+
+            @Override
+            protected void swap(final int i, final int j) {
+                int doc = docs[i];
+                docs[i] = docs[j];
+                docs[j] = doc;
+                float score = scores[i];
+                scores[i] = scores[j];
+                scores[j] = score;
+            }
+
+            @Override
+            protected int compare(final int i, final int j) {
+                return Float.compare(scores[j], scores[i]);
+            }
+
+            @Override
+            protected void setPivot(final int i) {
+                pivotScore = scores[i];
+            }
+
+            @Override
+            protected int comparePivot(final int j) {
+                return Float.compare(scores[j], pivotScore);
+            }
+        }.sort(0, length);
+    }
+
+    @Override
+    public String toString(final String field) {
+        return String.format(
+            Locale.ROOT,
+            "NeuralChunkQuery(%s, mode=%s, k=%d)",
+            chunkQuery.toString(field),
+            chunkScoreMode.getLabel(),
+            maxParents
+        );
+    }
+
+    @Override
+    public void visit(final QueryVisitor queryVisitor) {
+        chunkQuery.visit(queryVisitor.getSubVisitor(BooleanClause.Occur.MUST, this));
+    }
+
+    @Override
+    public boolean equals(final Object other) {
+        if (!sameClassAs(other)) {
+            return false;
+        }
+        NeuralChunkQuery otherQuery = (NeuralChunkQuery) other;
+        return chunkQuery.equals(otherQuery.chunkQuery)
+            && parentFilter.equals(otherQuery.parentFilter)
+            && chunkScoreMode == otherQuery.chunkScoreMode
+            && maxParents == otherQuery.maxParents;
+    }
+
+    @Override
+    public int hashCode() {
+        return Objects.hash(classHash(), chunkQuery, parentFilter, chunkScoreMode, maxParents);
+    }
+
+    /**
+     * Matches parent documents selected on rewrite of {@link NeuralChunkQuery} with their aggregated scores
+     */
+    static final class ParentScoreQuery extends Query {
+        // global doc ids sorted in ascending order
+        private final int[] docs;
+        private final float[] scores;
+        private final ChunkScoreMode chunkScoreMode;
+        // reader the query was rewritten with, doc ids are valid only for it
+        private final Object contextIdentity;
+
+        private ParentScoreQuery(
+            final int[] docs,
+            final float[] scores,
+            final ChunkScoreMode chunkScoreMode,
+            final Object contextIdentity
+        ) {
+            this.docs = docs;
+            this.scores = scores;
+            this.chunkScoreMode = chunkScoreMode;
+            this.contextIdentity = contextIdentity;
+        }
+
+        static ParentScoreQuery create(
+            final int[] docs,
+            final float[] scores,
+            final ChunkScoreMode chunkScoreMode,
+            final Object contextIdentity
+        ) {
+            // scorer iterates in doc id order, sort parents by doc id keeping scores aligned
+            new IntroSorter() {
+                private int pivotDoc;
+
+                @Override
+                protected void swap(final int i, final int j) {
+                    int doc = docs[i];
+                    docs[i] = docs[j];
+                    docs[j] = doc;
+                    float score = scores[i];
+                    scores[i] = scores[j];
+                    scores[j] = score;
+                }
+
+                @Override
+                protected int compare(final int i, final int j) {
+                    return Integer.compare(docs[i], docs[j]);
+                }
+
+                @Override
+                protected void setPivot(final int i) {
+                    pivotDoc = docs[i];
+                }
+
+                @Override
+                protected int comparePivot(final int j) {
+                    return Integer.compare(pivotDoc, docs[j]);
+                }
+            }.sort(0, docs.length);
+            return new ParentScoreQuery(docs, scores, chunkScoreMode, contextIdentity);
+        }
+
+        @Override
+        public Weight createWeight(final IndexSearcher searcher, final ScoreMode scoreMode, final float boost) {
+            if (searcher.getIndexReader().getContext().id() != contextIdentity) {
+                throw new IllegalStateException("neural chunk query was rewritten using a different reader");
+            }
+            return new Weight(this) {
+                @Override
+                public Explanation explain(final LeafReaderContext context, final int doc) {
+                    int index = Arrays.binarySearch(docs, context.docBase + doc);
+                    if (index < 0) {
+                        return Explanation.noMatch("not in top parent documents of neural chunk query");
+                    }
+                    return Explanation.match(scores[index] * boost, chunkScoreMode.getLabel() + " of scores of matching chunks");
+                }
+
+                @Override
+                public Scorer scorer(final LeafReaderContext context) {
+                    int start = lowerBound(context.docBase);
+                    int end = lowerBound(context.docBase + context.reader().maxDoc());
+                    if (start == end) {
+                        return null;
+                    }
+                    return new ParentScorer(this, context.docBase, start, end, boost);
+                }
+
+                @Override
+                public boolean isCacheable(final LeafReaderContext context) {
+                    return true;
+                }
+            };
+        }
+
+        private int lowerBound(final int doc) {
+            int index = Arrays.binarySearch(docs, doc);
+            return index < 0 ? -index - 1 : index;
+        }
+
+        @Override
+        public String toString(final String field) {
+            return String.format(Locale.ROOT, "ParentScoreQuery(parents=%d, mode=%s)", docs.length, chunkScoreMode);
+        }
+
+        @Override
+        public void visit(final QueryVisitor queryVisitor) {
+            queryVisitor.visitLeaf(this);
+        }
+
+        @Override
+        public boolean equals(final Object other) {
+            if (!sameClassAs(other)) {
+                return false;
+            }
+            ParentScoreQuery otherQuery = (ParentScoreQuery) other;
+            return contextIdentity == otherQuery.contextIdentity
+                && Arrays.equals(docs, otherQuery.docs)
+                && Arrays.equals(scores, otherQuery.scores);
+        }
+
+        @Override
+        public int hashCode() {
+            return Objects.hash(classHash(), contextIdentity, Arrays.hashCode(docs), Arrays.hashCode(scores));
+        }
+
+        /**
+         * Iterates over parents of one segment, positions are indexes in the global arrays of the query
+         */
+        private final class ParentScorer extends Scorer {
+            private final int docBase;
+            private final int start;
+            private final int end;
+            private final float boost;
+            private int index;
+
+            private ParentScorer(final Weight weight, final int docBase, final int start, final int end, final float boost) {
+                super(weight);
+                this.docBase = docBase;
+                this.start = start;
+                this.end = end;
+                this.boost = boost;
+                this.index = start - 1;
+            }
+
+            @Override
+            public int docID() {
+                if (index < start) {
+                    return -1;
+                }
+                return index < end ? docs[index] - docBase : DocIdSetIterator.NO_MORE_DOCS;
+            }
+
+            @Override
+            public float score() {
+                return scores[index] * boost;
+            }
+
+            @Override
+            public float getMaxScore(final int upTo) {
+                float maxScore = 0.0f;
+                for (int i = Math.max(index, start); i < end && docs[i] - docBase <= upTo; i++) {
+                    maxScore = Math.max(maxScore, scores[i] * boost);
+                }
+                return maxScore;
+            }
+
+            @Override
+            public DocIdSetIterator iterator() {
+                return new DocIdSetIterator() {
+                    @Override
+                    public int docID() {
+                        return ParentScorer.this.docID();
+                    }
+
+                    @Override
+                    public int nextDoc() {
+                        index++;
+                        return docID();
+                    }
+
+                    @Override
+                    public int advance(final int target) {
+                        int from = Math.min(Math.max(index + 1, start), end);
+                        int found = Arrays.binarySearch(docs, from, end, target + docBase);
+                        index = found < 0 ? -found - 1 : found;
+                        return docID();
+                    }
+
+                    @Override
+                    public long cost() {
+                        return end - start;
+                    }
+                };
+            }
+        }
+    }
+}
@@ -6,11 +6,15 @@ package org.opensearch.neuralsearch.query;
 
 import static org.opensearch.knn.index.query.KNNQueryBuilder.FILTER_FIELD;
 import static org.opensearch.neuralsearch.common.VectorUtil.vectorAsListToArray;
+import static org.opensearch.neuralsearch.ml.MLCommonsClientAccessor.TARGET_RESPONSE_FILTERS;
 import static org.opensearch.neuralsearch.processor.TextImageEmbeddingProcessor.INPUT_IMAGE;
 import static org.opensearch.neuralsearch.processor.TextImageEmbeddingProcessor.INPUT_TEXT;
 
 import java.io.IOException;
+import java.util.Arrays;
 import java.util.HashMap;
+import java.util.List;
+import java.util.Locale;
 import java.util.Map;
 import java.util.Objects;
 import java.util.function.Supplier;
@@ -19,8 +23,10 @@ import org.apache.commons.lang.StringUtils;
 import org.apache.commons.lang.builder.EqualsBuilder;
 import org.apache.commons.lang.builder.HashCodeBuilder;
 import org.apache.lucene.search.Query;
+import org.apache.lucene.search.join.BitSetProducer;
 import org.opensearch.Version;
 import org.opensearch.common.SetOnce;
+import org.opensearch.common.lucene.search.Queries;
 import org.opensearch.core.ParseField;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.core.common.ParsingException;
@@ -29,12 +35,18 @@ import org.opensearch.core.common.io.stream.StreamOutput;
 import org.opensearch.core.xcontent.XContentBuilder;
 import org.opensearch.core.xcontent.XContentParser;
 import org.opensearch.index.mapper.NumberFieldMapper;
+import org.opensearch.index.mapper.ObjectMapper;
 import org.opensearch.index.query.AbstractQueryBuilder;
 import org.opensearch.index.query.QueryBuilder;
 import org.opensearch.index.query.QueryRewriteContext;
 import org.opensearch.index.query.QueryShardContext;
+import org.opensearch.index.query.Rewriteable;
 import org.opensearch.knn.index.query.KNNQueryBuilder;
+import org.opensearch.neuralsearch.ml.InferenceBatchDispatcher;
+import org.opensearch.neuralsearch.ml.InferenceCacheKey;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
+import org.opensearch.neuralsearch.stats.NeuralStats;
 import org.opensearch.neuralsearch.util.NeuralSearchClusterUtil;
 
 import com.google.common.annotations.VisibleForTesting;
@@ -81,12 +93,34 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
     @VisibleForTesting
     static final ParseField MIN_SCORE_FIELD = new ParseField("min_score");
 
+    @VisibleForTesting
+    static final ParseField CHUNK_SCORE_MODE_FIELD = new ParseField("chunk_score_mode");
+
     private static final int DEFAULT_K = 10;
+    // sum of chunk scores needs several chunks of every parent, k-NN retrieves this many chunks per requested parent
+    @VisibleForTesting
+    static final int SUM_CHUNKS_PER_PARENT = 5;
 
     private static MLCommonsClientAccessor ML_CLIENT;
+    private static InferenceResultCache<float[]> INFERENCE_CACHE;
+    private static InferenceBatchDispatcher BATCH_DISPATCHER;
 
     public static void initialize(MLCommonsClientAccessor mlClient) {
+        initialize(mlClient, null);
+    }
+
+    public static void initialize(MLCommonsClientAccessor mlClient, InferenceResultCache<float[]> inferenceCache) {
+        initialize(mlClient, inferenceCache, null);
+    }
+
+    public static void initialize(
+        MLCommonsClientAccessor mlClient,
+        InferenceResultCache<float[]> inferenceCache,
+        InferenceBatchDispatcher batchDispatcher
+    ) {
         NeuralQueryBuilder.ML_CLIENT = mlClient;
+        NeuralQueryBuilder.INFERENCE_CACHE = inferenceCache;
+        NeuralQueryBuilder.BATCH_DISPATCHER = batchDispatcher;
     }
 
     private String fieldName;
@@ -101,8 +135,25 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
     @Setter(AccessLevel.PACKAGE)
     private Supplier<float[]> vectorSupplier;
     private QueryBuilder filter;
+    // set for a vector field of nested chunks, then parent documents are scored by scores of their chunks
+    private ChunkScoreMode chunkScoreMode;
     private static final Version MINIMAL_SUPPORTED_VERSION_DEFAULT_MODEL_ID = Version.V_2_11_0;
     private static final Version MINIMAL_SUPPORTED_VERSION_RADIAL_SEARCH = Version.V_2_14_0;
+    private static final Version MINIMAL_SUPPORTED_VERSION_CHUNK_SCORE_MODE = Version.V_3_0_0;
+
+    public NeuralQueryBuilder(
+        final String fieldName,
+        final String queryText,
+        final String queryImage,
+        final String modelId,
+        final Integer k,
+        final Float maxDistance,
+        final Float minScore,
+        final Supplier<float[]> vectorSupplier,
+        final QueryBuilder filter
+    ) {
+        this(fieldName, queryText, queryImage, modelId, k, maxDistance, minScore, vectorSupplier, filter, null);
+    }
 
     /**
      * Constructor from stream input
@@ -130,6 +181,15 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
             this.maxDistance = in.readOptionalFloat();
             this.minScore = in.readOptionalFloat();
         }
+        if (isClusterOnOrAfterMinReqVersionForChunkScoreMode()) {
+            String chunkScoreModeLabel = in.readOptionalString();
+            this.chunkScoreMode = Objects.isNull(chunkScoreModeLabel) ? null : ChunkScoreMode.from(chunkScoreModeLabel);
+            // chunk scores are aggregated on shards, query vector is sent there with the query
+            if (in.readBoolean()) {
+                float[] vector = in.readFloatArray();
+                this.vectorSupplier = () -> vector;
+            }
+        }
     }
 
     @Override
@@ -152,6 +212,14 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
             out.writeOptionalFloat(this.maxDistance);
             out.writeOptionalFloat(this.minScore);
         }
+        if (isClusterOnOrAfterMinReqVersionForChunkScoreMode()) {
+            out.writeOptionalString(Objects.isNull(chunkScoreMode) ? null : chunkScoreMode.getLabel());
+            float[] vector = Objects.isNull(chunkScoreMode) || Objects.isNull(vectorSupplier) ? null : vectorSupplier.get();
+            out.writeBoolean(Objects.nonNull(vector));
+            if (Objects.nonNull(vector)) {
+                out.writeFloatArray(vector);
+            }
+        }
     }
 
     @Override
@@ -174,6 +242,9 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
         if (Objects.nonNull(minScore)) {
             xContentBuilder.field(MIN_SCORE_FIELD.getPreferredName(), minScore);
         }
+        if (Objects.nonNull(chunkScoreMode)) {
+            xContentBuilder.field(CHUNK_SCORE_MODE_FIELD.getPreferredName(), chunkScoreMode.getLabel());
+        }
         printBoostAndQueryName(xContentBuilder);
         xContentBuilder.endObject();
         xContentBuilder.endObject();
@@ -190,7 +261,8 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
      *    "k": int,
      *    "name": "string", (optional)
      *    "boost": float (optional),
-     *    "filter": map (optional)
+     *    "filter": map (optional),
+     *    "chunk_score_mode": "max" or "sum" (optional, for a vector field of nested chunks)
      *  }
      * }
      *
@@ -227,6 +299,20 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
             requireValue(neuralQueryBuilder.modelId(), "Model ID must be provided for neural query");
         }
 
+        if (Objects.nonNull(neuralQueryBuilder.chunkScoreMode())) {
+            validateChunkScoreModeSupported();
+        }
+        if (Objects.nonNull(neuralQueryBuilder.chunkScoreMode()) && !neuralQueryBuilder.fieldName().contains(".")) {
+            throw new IllegalArgumentException(
+                String.format(
+                    Locale.ROOT,
+                    "[%s] requires a vector field inside a nested object, e.g. \"chunks.embedding\", got [%s]",
+                    CHUNK_SCORE_MODE_FIELD.getPreferredName(),
+                    neuralQueryBuilder.fieldName()
+                )
+            );
+        }
+
         boolean queryTypeIsProvided = validateKNNQueryType(neuralQueryBuilder);
         if (queryTypeIsProvided == false) {
             neuralQueryBuilder.k(DEFAULT_K);
@@ -258,6 +344,8 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
                     neuralQueryBuilder.maxDistance(parser.floatValue());
                 } else if (MIN_SCORE_FIELD.match(currentFieldName, parser.getDeprecationHandler())) {
                     neuralQueryBuilder.minScore(parser.floatValue());
+                } else if (CHUNK_SCORE_MODE_FIELD.match(currentFieldName, parser.getDeprecationHandler())) {
+                    neuralQueryBuilder.chunkScoreMode(ChunkScoreMode.from(parser.text()));
                 } else {
                     throw new ParsingException(
                         parser.getTokenLocation(),
@@ -278,7 +366,7 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
     }
 
     @Override
-    protected QueryBuilder doRewrite(QueryRewriteContext queryRewriteContext) {
+    protected QueryBuilder doRewrite(QueryRewriteContext queryRewriteContext) throws IOException {
         // When re-writing a QueryBuilder, if the QueryBuilder is not changed, doRewrite should return itself
         // (see
         // https://github.com/opensearch-project/OpenSearch/blob/main/server/src/main/java/org/opensearch/index/query/QueryBuilder.java#L90-L98).
@@ -288,19 +376,35 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
         // vector supplier that will get populated once the asynchronous call finishes and pass this supplier in to
         // create a new builder. Once the supplier's value gets set, we return a KNNQueryBuilder. Otherwise, we just
         // return the current unmodified query builder.
+        if (Objects.nonNull(chunkScoreMode)) {
+            // shards of older versions can't read the mode and the vector, query would fail there
+            validateChunkScoreModeSupported();
+        }
         if (vectorSupplier() != null) {
             if (vectorSupplier().get() == null) {
                 return this;
             }
-            KNNQueryBuilder knnQueryBuilder = new KNNQueryBuilder(fieldName(), vectorSupplier.get()).filter(filter());
-            if (maxDistance != null) {
-                knnQueryBuilder.maxDistance(maxDistance);
-            } else if (minScore != null) {
-                knnQueryBuilder.minScore(minScore);
-            } else {
-                knnQueryBuilder.k(k);
+            if (Objects.nonNull(chunkScoreMode)) {
+                // scores of chunks are aggregated per parent document on shards, see doToQuery. Builder isn't replaced by
+                // the k-NN one, so the filter has to be rewritten here
+                QueryBuilder rewrittenFilter = Objects.isNull(filter) ? null : Rewriteable.rewrite(filter, queryRewriteContext);
+                if (rewrittenFilter == filter) {
+                    return this;
+                }
+                return new NeuralQueryBuilder(
+                    fieldName(),
+                    queryText(),
+                    queryImage(),
+                    modelId(),
+                    k(),
+                    maxDistance(),
+                    minScore(),
+                    vectorSupplier(),
+                    rewrittenFilter,
+                    chunkScoreMode()
+                ).boost(boost()).queryName(queryName());
             }
-            return knnQueryBuilder;
+            return createKNNQueryBuilder(vectorSupplier.get(), k);
         }
 
         SetOnce<float[]> vectorSetOnce = new SetOnce<>();
@@ -311,12 +415,38 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
         if (StringUtils.isNotBlank(queryImage())) {
             inferenceInput.put(INPUT_IMAGE, queryImage());
         }
-        queryRewriteContext.registerAsyncAction(
-            ((client, actionListener) -> ML_CLIENT.inferenceSentences(modelId(), inferenceInput, ActionListener.wrap(floatList -> {
-                vectorSetOnce.set(vectorAsListToArray(floatList));
-                actionListener.onResponse(null);
-            }, actionListener::onFailure)))
-        );
+        if (Objects.isNull(INFERENCE_CACHE)) {
+            queryRewriteContext.registerAsyncAction(
+                ((client, actionListener) -> inference(inferenceInput, ActionListener.wrap(floatList -> {
+                    vectorSetOnce.set(vectorAsListToArray(floatList));
+                    actionListener.onResponse(null);
+                }, actionListener::onFailure)))
+            );
+        } else {
+            // cached vector is shared between queries, every query gets its own copy so k-NN can't modify the cached one
+            InferenceCacheKey cacheKey = InferenceCacheKey.of(modelId(), queryText(), queryImage(), TARGET_RESPONSE_FILTERS);
+            float[] cachedVector = INFERENCE_CACHE.get(cacheKey);
+            if (Objects.nonNull(cachedVector)) {
+                vectorSetOnce.set(Arrays.copyOf(cachedVector, cachedVector.length));
+            } else {
+                queryRewriteContext.registerAsyncAction(
+                    ((client, actionListener) -> INFERENCE_CACHE.getOrLoad(
+                        cacheKey,
+                        loadListener -> inference(
+                            inferenceInput,
+                            ActionListener.wrap(
+                                floatList -> loadListener.onResponse(vectorAsListToArray(floatList)),
+                                loadListener::onFailure
+                            )
+                        ),
+                        ActionListener.wrap(vector -> {
+                            vectorSetOnce.set(Arrays.copyOf(vector, vector.length));
+                            actionListener.onResponse(null);
+                        }, actionListener::onFailure)
+                    ))
+                );
+            }
+        }
         return new NeuralQueryBuilder(
             fieldName(),
             queryText(),
@@ -326,14 +456,76 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
             maxDistance(),
             minScore(),
             vectorSetOnce::get,
-            filter()
+            filter(),
+            chunkScoreMode()
         );
     }
 
+    private KNNQueryBuilder createKNNQueryBuilder(final float[] vector, final Integer knnK) {
+        KNNQueryBuilder knnQueryBuilder = new KNNQueryBuilder(fieldName(), vector).filter(filter());
+        if (maxDistance != null) {
+            knnQueryBuilder.maxDistance(maxDistance);
+        } else if (minScore != null) {
+            knnQueryBuilder.minScore(minScore);
+        } else {
+            knnQueryBuilder.k(knnK);
+        }
+        return knnQueryBuilder;
+    }
+
+    private void inference(Map<String, String> inferenceInput, ActionListener<List<Float>> actionListener) {
+        ActionListener<List<Float>> listener = NeuralStats.instance()
+            .timedListener(NeuralStats.NEURAL_QUERY_INFERENCE_TIME, actionListener);
+        // batching is done only for text, multimodal models expect text and image of one query in the same request
+        if (Objects.nonNull(BATCH_DISPATCHER) && StringUtils.isBlank(queryImage())) {
+            BATCH_DISPATCHER.inferenceSentence(modelId(), queryText(), listener);
+            return;
+        }
+        ML_CLIENT.inferenceSentences(modelId(), inferenceInput, listener);
+    }
+
     @Override
-    protected Query doToQuery(QueryShardContext queryShardContext) {
-        // All queries should be generated by the k-NN Query Builder
-        throw new UnsupportedOperationException("Query cannot be created by NeuralQueryBuilder directly");
+    protected Query doToQuery(QueryShardContext queryShardContext) throws IOException {
+        if (Objects.isNull(chunkScoreMode) || Objects.isNull(vectorSupplier) || Objects.isNull(vectorSupplier.get())) {
+            // All queries should be generated by the k-NN Query Builder
+            throw new UnsupportedOperationException("Query cannot be created by NeuralQueryBuilder directly");
+        }
+        String path = fieldName.substring(0, fieldName.lastIndexOf('.'));
+        ObjectMapper nestedObjectMapper = queryShardContext.getObjectMapper(path);
+        if (Objects.isNull(nestedObjectMapper) || !nestedObjectMapper.nested().isNested()) {
+            throw new IllegalArgumentException(
+                String.format(
+                    Locale.ROOT,
+                    "[%s] requires field [%s] to be inside a nested object, [%s] is not of nested type",
+                    CHUNK_SCORE_MODE_FIELD.getPreferredName(),
+                    fieldName,
+                    path
+                )
+            );
+        }
+        ObjectMapper parentObjectMapper = queryShardContext.nestedScope().nextLevel(nestedObjectMapper);
+        try {
+            Query parentQuery = Objects.isNull(parentObjectMapper) ? Queries.newNonNestedFilter() : parentObjectMapper.nestedTypeFilter();
+            BitSetProducer parentFilter = queryShardContext.bitsetFilter(parentQuery);
+            Query chunkQuery;
+            BitSetProducer previousParentFilter = queryShardContext.getParentFilter();
+            try {
+                if (chunkScoreMode == ChunkScoreMode.MAX) {
+                    // with parent filter k-NN returns the best chunk of k distinct parents, no need to over-fetch chunks
+                    queryShardContext.setParentFilter(parentFilter);
+                    chunkQuery = createKNNQueryBuilder(vectorSupplier.get(), k).toQuery(queryShardContext);
+                } else {
+                    queryShardContext.setParentFilter(null);
+                    Integer chunkK = Objects.isNull(k) ? null : k * SUM_CHUNKS_PER_PARENT;
+                    chunkQuery = createKNNQueryBuilder(vectorSupplier.get(), chunkK).toQuery(queryShardContext);
+                }
+            } finally {
+                queryShardContext.setParentFilter(previousParentFilter);
+            }
+            return new NeuralChunkQuery(chunkQuery, parentFilter, chunkScoreMode, Objects.isNull(k) ? Integer.MAX_VALUE : k);
+        } finally {
+            queryShardContext.nestedScope().previousLevel();
+        }
     }
 
     @Override
@@ -346,12 +538,13 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
         equalsBuilder.append(modelId, obj.modelId);
         equalsBuilder.append(k, obj.k);
         equalsBuilder.append(filter, obj.filter);
+        equalsBuilder.append(chunkScoreMode, obj.chunkScoreMode);
         return equalsBuilder.isEquals();
     }
 
     @Override
     protected int doHashCode() {
-        return new HashCodeBuilder().append(fieldName).append(queryText).append(modelId).append(k).toHashCode();
+        return new HashCodeBuilder().append(fieldName).append(queryText).append(modelId).append(k).append(chunkScoreMode).toHashCode();
     }
 
     @Override
@@ -367,6 +560,25 @@ public class NeuralQueryBuilder extends AbstractQueryBuilder<NeuralQueryBuilder>
         return NeuralSearchClusterUtil.instance().getClusterMinVersion().onOrAfter(MINIMAL_SUPPORTED_VERSION_RADIAL_SEARCH);
     }
 
+    private static boolean isClusterOnOrAfterMinReqVersionForChunkScoreMode() {
+        return NeuralSearchClusterUtil.instance().getClusterMinVersion().onOrAfter(MINIMAL_SUPPORTED_VERSION_CHUNK_SCORE_MODE);
+    }
+
+    private static void validateChunkScoreModeSupported() {
+        Version clusterMinVersion = NeuralSearchClusterUtil.instance().getClusterMinVersion();
+        if (!clusterMinVersion.onOrAfter(MINIMAL_SUPPORTED_VERSION_CHUNK_SCORE_MODE)) {
+            throw new IllegalArgumentException(
+                String.format(
+                    Locale.ROOT,
+                    "[%s] requires all nodes of the cluster to be on version [%s] or later, minimal node version is [%s]",
+                    CHUNK_SCORE_MODE_FIELD.getPreferredName(),
+                    MINIMAL_SUPPORTED_VERSION_CHUNK_SCORE_MODE,
+                    clusterMinVersion
+                )
+            );
+        }
+    }
+
     private static boolean validateKNNQueryType(NeuralQueryBuilder neuralQueryBuilder) {
         int queryCount = 0;
         if (neuralQueryBuilder.k() != null) {
@@ -5,11 +5,14 @@
 package org.opensearch.neuralsearch.query;
 
 import java.io.IOException;
+import java.util.ArrayList;
+import java.util.Collections;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Locale;
 import java.util.Map;
 import java.util.Objects;
+import java.util.TreeMap;
 import java.util.function.BiConsumer;
 import java.util.function.Supplier;
 
@@ -19,6 +22,7 @@ import org.apache.commons.lang.builder.HashCodeBuilder;
 import org.apache.lucene.document.FeatureField;
 import org.apache.lucene.search.BooleanClause;
 import org.apache.lucene.search.BooleanQuery;
+import org.apache.lucene.search.IndexSearcher;
 import org.apache.lucene.search.Query;
 import org.opensearch.Version;
 import org.opensearch.client.Client;
@@ -33,10 +37,14 @@ import org.opensearch.core.xcontent.XContentBuilder;
 import org.opensearch.core.xcontent.XContentParser;
 import org.opensearch.index.mapper.MappedFieldType;
 import org.opensearch.index.query.AbstractQueryBuilder;
+import org.opensearch.index.query.BoolQueryBuilder;
 import org.opensearch.index.query.QueryBuilder;
 import org.opensearch.index.query.QueryRewriteContext;
 import org.opensearch.index.query.QueryShardContext;
+import org.opensearch.neuralsearch.ml.InferenceCacheKey;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
+import org.opensearch.neuralsearch.stats.NeuralStats;
 import org.opensearch.neuralsearch.util.NeuralSearchClusterUtil;
 import org.opensearch.neuralsearch.util.TokenWeightUtil;
 
@@ -47,6 +55,7 @@ import lombok.Getter;
 import lombok.NoArgsConstructor;
 import lombok.Setter;
 import lombok.experimental.Accessors;
+import lombok.extern.log4j.Log4j2;
 
 import static org.opensearch.neuralsearch.processor.NeuralSparseTwoPhaseProcessor.splitQueryTokensByRatioedMaxScoreAsThreshold;
 
@@ -56,6 +65,7 @@ import static org.opensearch.neuralsearch.processor.NeuralSparseTwoPhaseProcesso
  * to Lucene FeatureQuery wrapped by Lucene BooleanQuery.
  */
 
+@Log4j2
 @Getter
 @Setter
 @Accessors(chain = true, fluent = true)
@@ -74,7 +84,11 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
     @VisibleForTesting
     @Deprecated
     static final ParseField MAX_TOKEN_SCORE_FIELD = new ParseField("max_token_score").withAllDeprecated();
+    // max weight accepted by FeatureField linear queries
+    @VisibleForTesting
+    static final float MAX_QUERY_TOKEN_WEIGHT = 64.f;
     private static MLCommonsClientAccessor ML_CLIENT;
+    private static InferenceResultCache<Map<String, Float>> INFERENCE_CACHE;
     private String fieldName;
     private String queryText;
     private String modelId;
@@ -90,11 +104,20 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
     // 2. If it's the sub query only build for two-phase, the value will be set to -1 * ratio of processor.
     // Then in the DoToQuery, we can use this to determine which type are this queryBuilder.
     private float twoPhasePruneRatio = 0F;
+    // Ratio of neural_sparse_two_phase_processor for queries that can't be rescored at top level, e.g. inside hybrid query.
+    // If it's positive, after inference the query is rewritten to a bool query where high score tokens must match and
+    // low score tokens only add their scores to docs matched by high score tokens.
+    private float inlineTwoPhasePruneRatio = 0F;
 
     private static final Version MINIMAL_SUPPORTED_VERSION_DEFAULT_MODEL_ID = Version.V_2_13_0;
 
     public static void initialize(MLCommonsClientAccessor mlClient) {
+        initialize(mlClient, null);
+    }
+
+    public static void initialize(MLCommonsClientAccessor mlClient, InferenceResultCache<Map<String, Float>> inferenceCache) {
         NeuralSparseQueryBuilder.ML_CLIENT = mlClient;
+        NeuralSparseQueryBuilder.INFERENCE_CACHE = inferenceCache;
     }
 
     /**
@@ -168,7 +191,9 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
         out.writeOptionalFloat(maxTokenScore);
         if (!Objects.isNull(this.queryTokensSupplier) && !Objects.isNull(this.queryTokensSupplier.get())) {
             out.writeBoolean(true);
-            out.writeMap(this.queryTokensSupplier.get(), StreamOutput::writeString, StreamOutput::writeFloat);
+            // tokens are written in a fixed order, so the same query has the same shard request cache key, regardless of the
+            // order of tokens in the model response
+            out.writeMap(new TreeMap<>(this.queryTokensSupplier.get()), StreamOutput::writeString, StreamOutput::writeFloat);
         } else {
             out.writeBoolean(false);
         }
@@ -302,6 +327,7 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
                 }
             } else if (QUERY_TOKENS_FIELD.match(currentFieldName, parser.getDeprecationHandler())) {
                 Map<String, Float> queryTokens = parser.map(HashMap::new, XContentParser::floatValue);
+                queryTokens.forEach(NeuralSparseQueryBuilder::validateQueryTokenWeight);
                 sparseEncodingQueryBuilder.queryTokensSupplier(() -> queryTokens);
             } else {
                 throw new ParsingException(
@@ -320,44 +346,108 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
         // 1. It's the queryBuilder built for two-phase, doesn't need any rewrite.
         // 2. It's registerAsyncAction has been registered successful.
         if (Objects.nonNull(queryTokensSupplier)) {
+            if (inlineTwoPhasePruneRatio > 0 && Objects.nonNull(queryTokensSupplier.get())) {
+                return rewriteToInlineTwoPhaseQuery();
+            }
             return this;
         }
         validateForRewrite(queryText, modelId);
         SetOnce<Map<String, Float>> queryTokensSetOnce = new SetOnce<>();
-        queryRewriteContext.registerAsyncAction(getModelInferenceAsync(queryTokensSetOnce));
+        Map<String, Float> cachedQueryTokens = Objects.isNull(INFERENCE_CACHE) ? null : INFERENCE_CACHE.get(getInferenceCacheKey());
+        if (Objects.nonNull(cachedQueryTokens)) {
+            setQueryTokens(queryTokensSetOnce, cachedQueryTokens);
+        } else {
+            queryRewriteContext.registerAsyncAction(getModelInferenceAsync(queryTokensSetOnce));
+        }
         return new NeuralSparseQueryBuilder().fieldName(fieldName)
             .queryText(queryText)
             .modelId(modelId)
             .maxTokenScore(maxTokenScore)
             .queryTokensSupplier(queryTokensSetOnce::get)
             .twoPhaseSharedQueryToken(twoPhaseSharedQueryToken)
-            .twoPhasePruneRatio(twoPhasePruneRatio);
+            .twoPhasePruneRatio(twoPhasePruneRatio)
+            .inlineTwoPhasePruneRatio(inlineTwoPhasePruneRatio);
+    }
+
+    /**
+     * Split query tokens by ratio of the max token score. High score tokens drive matching, so only their postings are
+     * iterated over all docs, and low score tokens are scored only for docs already matched by high score tokens.
+     * @return query builder that scores high and low score tokens in two clauses
+     */
+    private QueryBuilder rewriteToInlineTwoPhaseQuery() {
+        Tuple<Map<String, Float>, Map<String, Float>> splitQueryTokens = splitQueryTokensByRatioedMaxScoreAsThreshold(
+            queryTokensSupplier.get(),
+            inlineTwoPhasePruneRatio
+        );
+        if (splitQueryTokens.v1().isEmpty() || splitQueryTokens.v2().isEmpty()) {
+            return copyWithQueryTokens(queryTokensSupplier.get()).boost(boost()).queryName(queryName());
+        }
+        return new BoolQueryBuilder().must(copyWithQueryTokens(splitQueryTokens.v1()))
+            .should(copyWithQueryTokens(splitQueryTokens.v2()))
+            .boost(boost())
+            .queryName(queryName());
+    }
+
+    private NeuralSparseQueryBuilder copyWithQueryTokens(final Map<String, Float> queryTokens) {
+        return new NeuralSparseQueryBuilder().fieldName(fieldName)
+            .queryText(queryText)
+            .modelId(modelId)
+            .maxTokenScore(maxTokenScore)
+            .queryTokensSupplier(() -> queryTokens);
     }
 
     private BiConsumer<Client, ActionListener<?>> getModelInferenceAsync(SetOnce<Map<String, Float>> setOnce) {
+        if (Objects.isNull(INFERENCE_CACHE)) {
+            return ((client, actionListener) -> inferenceQueryTokens(ActionListener.wrap(queryTokens -> {
+                setQueryTokens(setOnce, queryTokens);
+                actionListener.onResponse(null);
+            }, actionListener::onFailure)));
+        }
+        return ((client, actionListener) -> INFERENCE_CACHE.getOrLoad(
+            getInferenceCacheKey(),
+            this::inferenceQueryTokens,
+            ActionListener.wrap(queryTokens -> {
+                setQueryTokens(setOnce, queryTokens);
+                actionListener.onResponse(null);
+            }, actionListener::onFailure)
+        ));
+    }
+
+    private void inferenceQueryTokens(ActionListener<Map<String, Float>> actionListener) {
+        ActionListener<Map<String, Float>> listener = NeuralStats.instance()
+            .timedListener(NeuralStats.NEURAL_SPARSE_QUERY_INFERENCE_TIME, actionListener);
+        ML_CLIENT.inferenceSentencesWithMapResult(
+            modelId(),
+            List.of(queryText),
+            ActionListener.wrap(
+                mapResultList -> listener.onResponse(
+                    Collections.unmodifiableMap(TokenWeightUtil.fetchListOfTokenWeightMap(mapResultList).get(0))
+                ),
+                listener::onFailure
+            )
+        );
+    }
+
+    private void setQueryTokens(SetOnce<Map<String, Float>> setOnce, Map<String, Float> queryTokens) {
         // When Two-phase shared query tokens is null,
         // it set queryTokensSupplier to the inference result which has all query tokens with score.
         // When Two-phase shared query tokens exist,
         // it splits the tokens using a threshold defined by a ratio of the maximum score of tokens, updating the token set
         // accordingly.
-        return ((client, actionListener) -> ML_CLIENT.inferenceSentencesWithMapResult(
-            modelId(),
-            List.of(queryText),
-            ActionListener.wrap(mapResultList -> {
-                Map<String, Float> queryTokens = TokenWeightUtil.fetchListOfTokenWeightMap(mapResultList).get(0);
-                if (Objects.nonNull(twoPhaseSharedQueryToken)) {
-                    Tuple<Map<String, Float>, Map<String, Float>> splitQueryTokens = splitQueryTokensByRatioedMaxScoreAsThreshold(
-                        queryTokens,
-                        twoPhasePruneRatio
-                    );
-                    setOnce.set(splitQueryTokens.v1());
-                    twoPhaseSharedQueryToken = splitQueryTokens.v2();
-                } else {
-                    setOnce.set(queryTokens);
-                }
-                actionListener.onResponse(null);
-            }, actionListener::onFailure)
-        ));
+        if (Objects.nonNull(twoPhaseSharedQueryToken)) {
+            Tuple<Map<String, Float>, Map<String, Float>> splitQueryTokens = splitQueryTokensByRatioedMaxScoreAsThreshold(
+                queryTokens,
+                twoPhasePruneRatio
+            );
+            setOnce.set(splitQueryTokens.v1());
+            twoPhaseSharedQueryToken = splitQueryTokens.v2();
+        } else {
+            setOnce.set(queryTokens);
+        }
+    }
+
+    private InferenceCacheKey getInferenceCacheKey() {
+        return InferenceCacheKey.of(modelId(), queryText, null, List.of());
     }
 
     @Override
@@ -369,12 +459,61 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
             throw new IllegalArgumentException("Query tokens cannot be null.");
         }
         BooleanQuery.Builder builder = new BooleanQuery.Builder();
-        for (Map.Entry<String, Float> entry : queryTokens.entrySet()) {
+        for (Map.Entry<String, Float> entry : getScoringQueryTokens(queryTokens, IndexSearcher.getMaxClauseCount())) {
             builder.add(FeatureField.newLinearQuery(fieldName, entry.getKey(), entry.getValue()), BooleanClause.Occur.SHOULD);
         }
         return builder.build();
     }
 
+    /**
+     * Select tokens that are scored by the query. Tokens with weight that is not positive can't change the score and are
+     * skipped. If there are more tokens than allowed number of boolean clauses only tokens with the highest weights are kept,
+     * they contribute most of the dot product.
+     * @param queryTokens tokens with weights from the model
+     * @param maxNumOfTokens maximum number of tokens in the query
+     * @return tokens with weights that are added to the query
+     * @throws IllegalArgumentException if a token has a weight that can't be scored by FeatureField
+     */
+    @VisibleForTesting
+    static List<Map.Entry<String, Float>> getScoringQueryTokens(final Map<String, Float> queryTokens, final int maxNumOfTokens) {
+        List<Map.Entry<String, Float>> scoringQueryTokens = new ArrayList<>(queryTokens.size());
+        for (Map.Entry<String, Float> entry : queryTokens.entrySet()) {
+            Float weight = entry.getValue();
+            if (Objects.isNull(weight) || weight <= 0) {
+                continue;
+            }
+            validateQueryTokenWeight(entry.getKey(), weight);
+            scoringQueryTokens.add(entry);
+        }
+        if (scoringQueryTokens.size() > maxNumOfTokens) {
+            log.debug(
+                "[{}] query has {} tokens with positive weight, only {} tokens with the highest weights are kept",
+                NAME,
+                scoringQueryTokens.size(),
+                maxNumOfTokens
+            );
+            scoringQueryTokens.sort(Map.Entry.<String, Float>comparingByValue().reversed());
+            return scoringQueryTokens.subList(0, maxNumOfTokens);
+        }
+        return scoringQueryTokens;
+    }
+
+    private static void validateQueryTokenWeight(final String token, final float weight) {
+        // comparison is false for NaN as well
+        if (!(weight <= MAX_QUERY_TOKEN_WEIGHT)) {
+            throw new IllegalArgumentException(
+                String.format(
+                    Locale.ROOT,
+                    "weight of token [%s] in [%s] query is [%s], it must not be greater than [%s]",
+                    token,
+                    NAME,
+                    weight,
+                    MAX_QUERY_TOKEN_WEIGHT
+                )
+            );
+        }
+    }
+
     private static void validateForRewrite(String queryText, String modelId) {
         if (StringUtils.isBlank(queryText) || StringUtils.isBlank(modelId)) {
             throw new IllegalArgumentException(
@@ -414,6 +553,7 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
             .append(modelId, obj.modelId)
             .append(maxTokenScore, obj.maxTokenScore)
             .append(twoPhasePruneRatio, obj.twoPhasePruneRatio)
+            .append(inlineTwoPhasePruneRatio, obj.inlineTwoPhasePruneRatio)
             .append(twoPhaseSharedQueryToken, obj.twoPhaseSharedQueryToken);
         if (Objects.nonNull(queryTokensSupplier)) {
             equalsBuilder.append(queryTokensSupplier.get(), obj.queryTokensSupplier.get());
@@ -428,6 +568,7 @@ public class NeuralSparseQueryBuilder extends AbstractQueryBuilder<NeuralSparseQ
             .append(modelId)
             .append(maxTokenScore)
             .append(twoPhasePruneRatio)
+            .append(inlineTwoPhasePruneRatio)
             .append(twoPhaseSharedQueryToken);
         if (Objects.nonNull(queryTokensSupplier)) {
             builder.append(queryTokensSupplier.get());
@@ -0,0 +1,52 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.rest;
+
+import java.util.List;
+import java.util.Map;
+
+import org.opensearch.client.node.NodeClient;
+import org.opensearch.core.rest.RestStatus;
+import org.opensearch.core.xcontent.XContentBuilder;
+import org.opensearch.neuralsearch.ml.ModelWarmup;
+import org.opensearch.rest.BaseRestHandler;
+import org.opensearch.rest.BytesRestResponse;
+import org.opensearch.rest.RestRequest;
+
+import lombok.AllArgsConstructor;
+
+/**
+ * Reports warm-up state of models on the node that receives the request, e.g. GET /_plugins/_neural/warmup. Status is
+ * 200 when the node is ready and 503 while models are being warmed up, so the API can be used as a readiness check.
+ */
+@AllArgsConstructor
+public class RestModelWarmupHandler extends BaseRestHandler {
+
+    private static final String NAME = "neural_model_warmup_action";
+
+    private final ModelWarmup modelWarmup;
+
+    @Override
+    public String getName() {
+        return NAME;
+    }
+
+    @Override
+    public List<Route> routes() {
+        return List.of(new Route(RestRequest.Method.GET, "/_plugins/_neural/warmup"));
+    }
+
+    @Override
+    protected RestChannelConsumer prepareRequest(final RestRequest request, final NodeClient client) {
+        return channel -> {
+            Map<String, Object> warmupState = modelWarmup.toMap();
+            boolean ready = Boolean.TRUE.equals(warmupState.get(ModelWarmup.READY_FIELD));
+            RestStatus status = ready ? RestStatus.OK : RestStatus.SERVICE_UNAVAILABLE;
+            XContentBuilder builder = channel.newBuilder();
+            builder.map(warmupState);
+            channel.sendResponse(new BytesRestResponse(status, builder));
+        };
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.rest;
+
+import java.util.List;
+
+import org.opensearch.client.node.NodeClient;
+import org.opensearch.core.common.Strings;
+import org.opensearch.neuralsearch.transport.NeuralStatsAction;
+import org.opensearch.neuralsearch.transport.NeuralStatsRequest;
+import org.opensearch.rest.BaseRestHandler;
+import org.opensearch.rest.RestRequest;
+import org.opensearch.rest.action.RestActions;
+
+/**
+ * Returns neural search stats of all nodes or of the nodes given in the path, e.g. GET /_plugins/_neural/node_1,node_2/stats
+ */
+public class RestNeuralStatsHandler extends BaseRestHandler {
+
+    private static final String NAME = "neural_stats_action";
+    private static final String NODE_ID_PARAM = "nodeId";
+
+    @Override
+    public String getName() {
+        return NAME;
+    }
+
+    @Override
+    public List<Route> routes() {
+        return List.of(
+            new Route(RestRequest.Method.GET, "/_plugins/_neural/stats"),
+            new Route(RestRequest.Method.GET, "/_plugins/_neural/{" + NODE_ID_PARAM + "}/stats")
+        );
+    }
+
+    @Override
+    protected RestChannelConsumer prepareRequest(final RestRequest request, final NodeClient client) {
+        NeuralStatsRequest neuralStatsRequest = new NeuralStatsRequest(Strings.splitStringByCommaToArray(request.param(NODE_ID_PARAM)));
+        neuralStatsRequest.timeout(request.param("timeout"));
+        return channel -> client.execute(
+            NeuralStatsAction.INSTANCE,
+            neuralStatsRequest,
+            new RestActions.NodesResponseRestListener<>(channel)
+        );
+    }
+}
@@ -5,6 +5,7 @@
 package org.opensearch.neuralsearch.search;
 
 import java.util.Locale;
+import java.util.concurrent.atomic.LongAdder;
 
 import org.apache.lucene.search.ScoreMode;
 
@@ -12,10 +13,11 @@ import lombok.Getter;
 
 /**
  *  Abstracts algorithm that allows early termination for the search flow if number of hits reached
- *  certain treshold
+ *  certain treshold. One checker is shared by collectors of all slices of the shard with concurrent segment search,
+ *  so hits are counted the same way as by shared threshold checker of Lucene
  */
 public class HitsThresholdChecker {
-    private int hitCount;
+    private final LongAdder hitCount = new LongAdder();
     @Getter
     private final int totalHitsThreshold;
 
@@ -27,11 +29,11 @@ public class HitsThresholdChecker {
     }
 
     protected void incrementHitCount() {
-        ++hitCount;
+        hitCount.increment();
     }
 
     protected boolean isThresholdReached() {
-        return hitCount >= getTotalHitsThreshold();
+        return hitCount.longValue() >= getTotalHitsThreshold();
     }
 
     protected ScoreMode scoreMode() {
@@ -12,6 +12,7 @@ import java.util.Objects;
 
 import lombok.Getter;
 import org.apache.lucene.index.LeafReaderContext;
+import org.apache.lucene.search.CollectionTerminatedException;
 import org.apache.lucene.search.Collector;
 import org.apache.lucene.search.HitQueue;
 import org.apache.lucene.search.LeafCollector;
@@ -33,6 +34,7 @@ public class HybridTopScoreDocCollector implements Collector {
     private static final TopDocs EMPTY_TOPDOCS = new TopDocs(new TotalHits(0, TotalHits.Relation.EQUAL_TO), new ScoreDoc[0]);
     private int docBase;
     private final HitsThresholdChecker hitsThresholdChecker;
+    @Getter
     private TotalHits.Relation totalHitsRelation = TotalHits.Relation.EQUAL_TO;
     @Getter
     private int totalHits;
@@ -53,6 +55,11 @@ public class HybridTopScoreDocCollector implements Collector {
 
         return new LeafCollector() {
             HybridQueryScorer compoundQueryScorer;
+            // scores of the current doc per sub-query, the same array is reused for every doc of the segment
+            float[] subScoresByQuery;
+            // min competitive scores that are set to sub-query scorers of the segment
+            float[] minCompetitiveScores;
+            boolean minCompetitiveScoresEnabled;
 
             @Override
             public void setScorer(Scorable scorer) throws IOException {
@@ -67,6 +74,13 @@ public class HybridTopScoreDocCollector implements Collector {
                         );
                     }
                 }
+                if (Objects.nonNull(compoundQueryScorer)) {
+                    subScoresByQuery = new float[compoundQueryScorer.getNumSubqueries()];
+                    minCompetitiveScores = new float[compoundQueryScorer.getNumSubqueries()];
+                    minCompetitiveScoresEnabled = false;
+                    // bottoms of queues filled by previous segments are already competitive thresholds for this segment
+                    enableMinCompetitiveScoresIfThresholdReached();
+                }
             }
 
             private HybridQueryScorer getHybridQueryScorer(final Scorable scorer) throws IOException {
@@ -97,17 +111,21 @@ public class HybridTopScoreDocCollector implements Collector {
                 if (Objects.isNull(compoundQueryScorer)) {
                     throw new IllegalArgumentException("scorers are null for all sub-queries in hybrid query");
                 }
-                float[] subScoresByQuery = compoundQueryScorer.hybridScores();
+                compoundQueryScorer.hybridScores(subScoresByQuery);
                 // iterate over results for each query
                 if (compoundScores == null) {
                     compoundScores = new PriorityQueue[subScoresByQuery.length];
                     for (int i = 0; i < subScoresByQuery.length; i++) {
-                        compoundScores[i] = new HitQueue(numOfHits, false);
+                        // queue is pre-populated with sentinel docs that have score of negative infinity
+                        compoundScores[i] = new HitQueue(numOfHits, true);
                     }
                     collectedHitsPerSubQuery = new int[subScoresByQuery.length];
                 }
                 // Increment total hit count which represents unique doc found on the shard
                 totalHits++;
+                hitsThresholdChecker.incrementHitCount();
+                enableMinCompetitiveScoresIfThresholdReached();
+                boolean queuesUpdated = false;
                 for (int i = 0; i < subScoresByQuery.length; i++) {
                     float score = subScoresByQuery[i];
                     // if score is 0.0 there is no hits for that sub-query
@@ -115,13 +133,74 @@ public class HybridTopScoreDocCollector implements Collector {
                         continue;
                     }
                     collectedHitsPerSubQuery[i]++;
+                    maxScore = Math.max(score, maxScore);
+                    if (numOfHits == 0) {
+                        continue;
+                    }
                     PriorityQueue<ScoreDoc> pq = compoundScores[i];
-                    ScoreDoc currentDoc = new ScoreDoc(doc + docBase, score);
-                    maxScore = Math.max(currentDoc.score, maxScore);
-                    // this way we're inserting into heap and do nothing else unless we reach the capacity
-                    // after that we pull out the lowest score element on each insert
-                    pq.insertWithOverflow(currentDoc);
+                    ScoreDoc bottom = pq.top();
+                    // docs are collected in order of doc id, so a doc with the same score as the bottom one is not competitive
+                    if (score <= bottom.score) {
+                        continue;
+                    }
+                    // reuse the bottom element instead of creating new ScoreDoc and re-heapify the queue
+                    bottom.doc = doc + docBase;
+                    bottom.score = score;
+                    pq.updateTop();
+                    if (minCompetitiveScoresEnabled) {
+                        updateMinCompetitiveScore(i);
+                        queuesUpdated = true;
+                    }
+                }
+                if (queuesUpdated) {
+                    terminateIfNoCompetitiveDocsLeft();
+                }
+            }
+
+            private void enableMinCompetitiveScoresIfThresholdReached() throws IOException {
+                if (minCompetitiveScoresEnabled
+                    || compoundScores == null
+                    || numOfHits == 0
+                    || scoreMode() != ScoreMode.TOP_SCORES
+                    || !compoundQueryScorer.isMinCompetitiveScoreSupported()
+                    || !hitsThresholdChecker.isThresholdReached()) {
+                    return;
+                }
+                minCompetitiveScoresEnabled = true;
+                for (int i = 0; i < compoundScores.length; i++) {
+                    updateMinCompetitiveScore(i);
+                }
+            }
+
+            /**
+             * Each sub-query keeps its own top hits, so the bottom of the sub-query queue is a competitive threshold for
+             * scorer of that sub-query only. Docs that are skipped by such scorer are still collected if other sub-queries match them.
+             */
+            private void updateMinCompetitiveScore(final int subQueryIndex) throws IOException {
+                // while queue is not full its bottom is a sentinel with negative infinity score
+                float bottomScore = compoundScores[subQueryIndex].top().score;
+                if (bottomScore <= minCompetitiveScores[subQueryIndex]) {
+                    return;
+                }
+                compoundQueryScorer.setMinCompetitiveScore(subQueryIndex, bottomScore);
+                minCompetitiveScores[subQueryIndex] = bottomScore;
+                // skipped docs are not counted, so number of hits becomes a lower bound
+                totalHitsRelation = TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO;
+            }
+
+            /**
+             * Stops collection of the segment once none of remaining docs can get into top hits of any sub-query, i.e. no sub-query
+             * scorer can score rest of the segment above the bottom of that sub-query queue
+             */
+            private void terminateIfNoCompetitiveDocsLeft() throws IOException {
+                for (int i = 0; i < compoundScores.length; i++) {
+                    if (compoundQueryScorer.hasCompetitiveDocs(i, compoundScores[i].top().score)) {
+                        return;
+                    }
                 }
+                log.debug("no competitive docs left for any of sub-queries, terminating collection of the segment");
+                totalHitsRelation = TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO;
+                throw new CollectionTerminatedException();
             }
         };
     }
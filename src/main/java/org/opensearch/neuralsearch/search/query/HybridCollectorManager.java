@@ -15,8 +15,10 @@ import org.apache.lucene.search.Weight;
 import org.apache.lucene.search.Query;
 import org.apache.lucene.search.ScoreMode;
 import org.opensearch.common.Nullable;
+import org.opensearch.common.settings.Settings;
 import org.opensearch.common.lucene.search.FilteredCollector;
 import org.opensearch.common.lucene.search.TopDocsAndMaxScore;
+import org.opensearch.index.shard.IndexShard;
 import org.opensearch.neuralsearch.search.HitsThresholdChecker;
 import org.opensearch.neuralsearch.search.HybridTopScoreDocCollector;
 import org.opensearch.search.DocValueFormat;
@@ -27,17 +29,19 @@ import org.opensearch.search.query.QuerySearchResult;
 import org.opensearch.search.query.ReduceableSearchResult;
 import org.opensearch.search.sort.SortAndFormats;
 
+import com.google.common.annotations.VisibleForTesting;
+
 import java.io.IOException;
 import java.util.ArrayList;
-import java.util.Arrays;
 import java.util.Collection;
 import java.util.List;
 import java.util.Objects;
 
 import static org.apache.lucene.search.TotalHits.Relation;
 import static org.opensearch.neuralsearch.search.query.TopDocsMerger.TOP_DOCS_MERGER_TOP_SCORES;
-import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createDelimiterElementForHybridSearchResults;
-import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createStartStopElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_SEARCH_SHARD_WINDOW_ENABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_SEARCH_SHARD_WINDOW_FACTOR;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createHybridSearchResultScoreDocs;
 
 /**
  * Collector manager based on HybridTopScoreDocCollector that allows users to parallelize counting the number of hits.
@@ -64,7 +68,7 @@ public abstract class HybridCollectorManager implements CollectorManager<Collect
     public static CollectorManager createHybridCollectorManager(final SearchContext searchContext) throws IOException {
         final IndexReader reader = searchContext.searcher().getIndexReader();
         final int totalNumDocs = Math.max(0, reader.numDocs());
-        int numDocs = Math.min(searchContext.from() + searchContext.size(), totalNumDocs);
+        int numDocs = Math.min(getShardWindowSize(searchContext), totalNumDocs);
         int trackTotalHitsUpTo = searchContext.trackTotalHitsUpTo();
 
         Weight filteringWeight = null;
@@ -97,6 +101,29 @@ public abstract class HybridCollectorManager implements CollectorManager<Collect
             );
     }
 
+    /**
+     * Number of hits each sub-query collects on this shard. By default, that's "from + size" so every shard can provide all top hits.
+     * If adaptive shard window is enabled for the index only a share of it is collected, proportional to number of shards.
+     * @param searchContext search context of the shard
+     * @return number of hits to collect per sub-query
+     */
+    @VisibleForTesting
+    static int getShardWindowSize(final SearchContext searchContext) {
+        int windowSize = searchContext.from() + searchContext.size();
+        int numberOfShards = searchContext.numberOfShards();
+        IndexShard indexShard = searchContext.indexShard();
+        if (numberOfShards <= 1 || Objects.isNull(indexShard)) {
+            return windowSize;
+        }
+        Settings indexSettings = indexShard.indexSettings().getSettings();
+        if (!HYBRID_SEARCH_SHARD_WINDOW_ENABLED.get(indexSettings)) {
+            return windowSize;
+        }
+        double factor = HYBRID_SEARCH_SHARD_WINDOW_FACTOR.get(indexSettings);
+        int shardWindowSize = (int) Math.ceil(factor * windowSize / numberOfShards);
+        return Math.min(windowSize, shardWindowSize);
+    }
+
     @Override
     public Collector newCollector() {
         Collector hybridcollector = new HybridTopScoreDocCollector(numHits, hitsThresholdChecker);
@@ -122,19 +149,27 @@ public abstract class HybridCollectorManager implements CollectorManager<Collect
             throw new IllegalStateException("cannot collect results of hybrid search query, there are no proper score collectors");
         }
 
-        List<ReduceableSearchResult> results = new ArrayList<>();
         DocValueFormat[] docValueFormats = getSortValueFormats(sortAndFormats);
+        // collectors of all slices of concurrent segment search are merged at once, per sub-query
+        final List<List<TopDocs>> topDocsPerCollector = new ArrayList<>(hybridTopScoreDocCollectors.size());
+        long totalHits = 0;
+        Relation totalHitsRelation = Relation.EQUAL_TO;
+        float maxScore = 0.0f;
         for (HybridTopScoreDocCollector hybridTopScoreDocCollector : hybridTopScoreDocCollectors) {
-            List<TopDocs> topDocs = hybridTopScoreDocCollector.topDocs();
-            TopDocs newTopDocs = getNewTopDocs(
-                getTotalHits(this.trackTotalHitsUpTo, topDocs, hybridTopScoreDocCollector.getTotalHits()),
-                topDocs
-            );
-            TopDocsAndMaxScore topDocsAndMaxScore = new TopDocsAndMaxScore(newTopDocs, hybridTopScoreDocCollector.getMaxScore());
-
-            results.add((QuerySearchResult result) -> reduceCollectorResults(result, topDocsAndMaxScore, docValueFormats, newTopDocs));
+            topDocsPerCollector.add(hybridTopScoreDocCollector.topDocs());
+            totalHits += hybridTopScoreDocCollector.getTotalHits();
+            if (hybridTopScoreDocCollector.getTotalHitsRelation() == Relation.GREATER_THAN_OR_EQUAL_TO) {
+                totalHitsRelation = Relation.GREATER_THAN_OR_EQUAL_TO;
+            }
+            maxScore = Math.max(maxScore, hybridTopScoreDocCollector.getMaxScore());
         }
-        return reduceSearchResults(results);
+        final List<TopDocs> topDocs = topDocsPerCollector.size() == 1
+            ? topDocsPerCollector.get(0)
+            : topDocsMerger.mergeSubQueryTopDocs(topDocsPerCollector, numHits);
+        TopDocs newTopDocs = getNewTopDocs(getTotalHits(this.trackTotalHitsUpTo, topDocs, totalHits, totalHitsRelation), topDocs);
+        TopDocsAndMaxScore topDocsAndMaxScore = new TopDocsAndMaxScore(newTopDocs, maxScore);
+
+        return (QuerySearchResult result) -> reduceCollectorResults(result, topDocsAndMaxScore, docValueFormats, newTopDocs);
     }
 
     private List<HybridTopScoreDocCollector> getHybridScoreDocCollectors(Collection<Collector> collectors) {
@@ -177,35 +212,21 @@ public abstract class HybridCollectorManager implements CollectorManager<Collect
             if (delimiterDocId == -1) {
                 return new TopDocs(totalHits, scoreDocs);
             }
-            // format scores using following template:
-            // doc_id | magic_number_1
-            // doc_id | magic_number_2
-            // ...
-            // doc_id | magic_number_2
-            // ...
-            // doc_id | magic_number_2
-            // ...
-            // doc_id | magic_number_1
-            List<ScoreDoc> result = new ArrayList<>();
-            result.add(createStartStopElementForHybridSearchResults(delimiterDocId));
-            for (TopDocs topDoc : topDocs) {
-                if (Objects.isNull(topDoc) || Objects.isNull(topDoc.scoreDocs)) {
-                    result.add(createDelimiterElementForHybridSearchResults(delimiterDocId));
-                    continue;
-                }
-                result.add(createDelimiterElementForHybridSearchResults(delimiterDocId));
-                result.addAll(Arrays.asList(topDoc.scoreDocs));
-            }
-            result.add(createStartStopElementForHybridSearchResults(delimiterDocId));
-            scoreDocs = result.stream().map(doc -> new ScoreDoc(doc.doc, doc.score, doc.shardIndex)).toArray(ScoreDoc[]::new);
+            // format scores using template of hybrid search query results, see HybridSearchResultFormatUtil
+            scoreDocs = createHybridSearchResultScoreDocs(delimiterDocId, topDocs);
         }
         return new TopDocs(totalHits, scoreDocs);
     }
 
-    private TotalHits getTotalHits(int trackTotalHitsUpTo, final List<TopDocs> topDocs, final long maxTotalHits) {
+    private TotalHits getTotalHits(
+        int trackTotalHitsUpTo,
+        final List<TopDocs> topDocs,
+        final long maxTotalHits,
+        final Relation collectorRelation
+    ) {
+        // collector counts hits as a lower bound once it starts to skip non-competitive docs
         final Relation relation = trackTotalHitsUpTo == SearchContext.TRACK_TOTAL_HITS_DISABLED
-            ? Relation.GREATER_THAN_OR_EQUAL_TO
-            : Relation.EQUAL_TO;
+            || collectorRelation == Relation.GREATER_THAN_OR_EQUAL_TO ? Relation.GREATER_THAN_OR_EQUAL_TO : Relation.EQUAL_TO;
         if (topDocs == null || topDocs.isEmpty()) {
             return new TotalHits(0, relation);
         }
@@ -242,20 +263,6 @@ public abstract class HybridCollectorManager implements CollectorManager<Collect
         result.topDocs(mergeTopDocsAndMaxScores, docValueFormats);
     }
 
-    /**
-     * For collection of search results, return a single one that has results from all individual result objects.
-     * @param results collection of search results
-     * @return single search result that represents all results as one object
-     */
-    private ReduceableSearchResult reduceSearchResults(List<ReduceableSearchResult> results) {
-        return (result) -> {
-            for (ReduceableSearchResult r : results) {
-                // call reduce for results of each single collector, this will update top docs in query result
-                r.reduce(result);
-            }
-        };
-    }
-
     /**
      * Implementation of the HybridCollector that reuses instance of collector on each even call. This allows caller to
      * use saved state of collector
@@ -16,7 +16,7 @@ import java.util.Objects;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQueryScoreDocElement;
 
 /**
- * Merges two ScoreDoc arrays into one
+ * Merges ScoreDoc arrays of hybrid query results into one
  */
 @NoArgsConstructor(access = AccessLevel.PACKAGE)
 class HybridQueryScoreDocsMerger<T extends ScoreDoc> {
@@ -80,4 +80,112 @@ class HybridQueryScoreDocsMerger<T extends ScoreDoc> {
         mergedScoreDocs.add(sourceScoreDocs[sourceScoreDocs.length - 1]);
         return mergedScoreDocs.toArray((T[]) new ScoreDoc[0]);
     }
+
+    /**
+     * Merge hits of one sub-query collected by multiple collectors, e.g. by slices of concurrent segment search, using k-way merge.
+     * Every array must be sorted by comparator, result has at most numHits top hits from all arrays. Hits with equal score
+     * are ordered by doc id. Arrays are not mutated and nothing besides the result array is allocated per hit.
+     * @param sortedScoreDocs hits of the same sub-query from every collector, null is treated as an empty array
+     * @param numHits maximum number of hits in the result
+     * @param comparator comparator used to sort hits in every array
+     * @return merged array of ScoreDocs objects
+     */
+    public T[] mergeSorted(final List<T[]> sortedScoreDocs, final int numHits, final Comparator<T> comparator) {
+        final SourcesHeap<T> heap = new SourcesHeap<>(sortedScoreDocs, comparator);
+        final T[] mergedScoreDocs = (T[]) new ScoreDoc[Math.min(numHits, heap.totalNumOfHits)];
+        for (int i = 0; i < mergedScoreDocs.length; i++) {
+            mergedScoreDocs[i] = heap.pollTopHit();
+        }
+        return mergedScoreDocs;
+    }
+
+    /**
+     * Heap of source arrays for k-way merge, array with the best not merged hit is on top. Keeps only indexes of arrays
+     * and positions of next hit in every array
+     */
+    private static final class SourcesHeap<T extends ScoreDoc> {
+        private final List<T[]> sources;
+        private final Comparator<T> comparator;
+        private final int[] heap;
+        private final int[] positions;
+        private final int totalNumOfHits;
+        private int size;
+
+        private SourcesHeap(final List<T[]> sources, final Comparator<T> comparator) {
+            this.sources = sources;
+            this.comparator = comparator;
+            this.heap = new int[sources.size()];
+            this.positions = new int[sources.size()];
+            int numOfHits = 0;
+            for (int source = 0; source < sources.size(); source++) {
+                T[] scoreDocs = sources.get(source);
+                if (Objects.isNull(scoreDocs) || scoreDocs.length == 0) {
+                    continue;
+                }
+                numOfHits += scoreDocs.length;
+                heap[size] = source;
+                siftUp(size);
+                size++;
+            }
+            this.totalNumOfHits = numOfHits;
+        }
+
+        /**
+         * Returns best not merged hit and moves its array to the next hit. Must not be called once all hits are merged
+         */
+        private T pollTopHit() {
+            final int source = heap[0];
+            final T[] scoreDocs = sources.get(source);
+            final T topHit = scoreDocs[positions[source]];
+            positions[source]++;
+            if (positions[source] == scoreDocs.length) {
+                size--;
+                heap[0] = heap[size];
+            }
+            if (size > 0) {
+                siftDown();
+            }
+            return topHit;
+        }
+
+        private void siftUp(int index) {
+            final int source = heap[index];
+            while (index > 0) {
+                int parent = (index - 1) >>> 1;
+                if (!isBetter(source, heap[parent])) {
+                    break;
+                }
+                heap[index] = heap[parent];
+                index = parent;
+            }
+            heap[index] = source;
+        }
+
+        private void siftDown() {
+            final int source = heap[0];
+            int index = 0;
+            int child;
+            while ((child = 2 * index + 1) < size) {
+                if (child + 1 < size && isBetter(heap[child + 1], heap[child])) {
+                    child++;
+                }
+                if (!isBetter(heap[child], source)) {
+                    break;
+                }
+                heap[index] = heap[child];
+                index = child;
+            }
+            heap[index] = source;
+        }
+
+        private boolean isBetter(final int source, final int otherSource) {
+            T scoreDoc = sources.get(source)[positions[source]];
+            T otherScoreDoc = sources.get(otherSource)[positions[otherSource]];
+            int result = comparator.compare(scoreDoc, otherScoreDoc);
+            if (result != 0) {
+                return result > 0;
+            }
+            return scoreDoc.doc < otherScoreDoc.doc;
+        }
+    }
 }
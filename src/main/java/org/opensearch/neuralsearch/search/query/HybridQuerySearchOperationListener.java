@@ -0,0 +1,42 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.search.query;
+
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQueryStartStopElement;
+
+import org.apache.lucene.search.ScoreDoc;
+import org.opensearch.index.shard.SearchOperationListener;
+import org.opensearch.search.internal.SearchContext;
+import org.opensearch.search.query.QuerySearchResult;
+
+import lombok.extern.log4j.Log4j2;
+
+/**
+ * Prepares fetch of hybrid query results that are read from the shard request cache. Query phase results of hybrid query
+ * are cached in the same format as they are sent to the coordinator node, with start/stop and delimiter elements. When
+ * the index has one shard fetch runs right after the query phase and has to load all elements of that format, size of
+ * the search context is updated by {@link HybridAggregationProcessor} when the query phase is executed. Cached results
+ * skip the query phase, so the listener updates the size before the fetch phase for both cases.
+ */
+@Log4j2
+public class HybridQuerySearchOperationListener implements SearchOperationListener {
+
+    @Override
+    public void onQueryPhase(final SearchContext searchContext, final long tookInNanos) {
+        if (searchContext.numberOfShards() != 1) {
+            return;
+        }
+        QuerySearchResult queryResult = searchContext.queryResult();
+        if (queryResult == null || queryResult.hasConsumedTopDocs()) {
+            return;
+        }
+        ScoreDoc[] scoreDocs = queryResult.topDocs().topDocs.scoreDocs;
+        if (scoreDocs.length == 0 || !isHybridQueryStartStopElement(scoreDocs[0]) || searchContext.size() == scoreDocs.length) {
+            return;
+        }
+        log.debug("updating size of search context to [{}] to fetch all elements of hybrid query results", scoreDocs.length);
+        searchContext.size(scoreDocs.length);
+    }
+}
@@ -12,7 +12,9 @@ import org.apache.lucene.search.TopDocs;
 import org.apache.lucene.search.TotalHits;
 import org.opensearch.common.lucene.search.TopDocsAndMaxScore;
 
+import java.util.ArrayList;
 import java.util.Comparator;
+import java.util.List;
 import java.util.Objects;
 
 /**
@@ -62,6 +64,42 @@ class TopDocsMerger {
         return result;
     }
 
+    /**
+     * Merge top docs of every sub-query collected by multiple collectors, e.g. by slices of concurrent segment search.
+     * Hits of each sub-query are merged in one k-way merge and limited to numHits, so collectors are merged at once
+     * instead of merging formatted results of collectors one by one.
+     * @param topDocsPerCollector top docs of sub-queries from each collector, collector that didn't collect any segment may have none
+     * @param numHits maximum number of hits per sub-query
+     * @return merged top docs per sub-query
+     */
+    public List<TopDocs> mergeSubQueryTopDocs(final List<List<TopDocs>> topDocsPerCollector, final int numHits) {
+        int numOfSubQueries = 0;
+        for (List<TopDocs> topDocs : topDocsPerCollector) {
+            numOfSubQueries = Math.max(numOfSubQueries, topDocs.size());
+        }
+        final List<TopDocs> mergedTopDocs = new ArrayList<>(numOfSubQueries);
+        final List<ScoreDoc[]> subQueryScoreDocs = new ArrayList<>(topDocsPerCollector.size());
+        for (int subQueryIndex = 0; subQueryIndex < numOfSubQueries; subQueryIndex++) {
+            subQueryScoreDocs.clear();
+            long totalHits = 0;
+            TotalHits.Relation relation = TotalHits.Relation.EQUAL_TO;
+            for (List<TopDocs> topDocs : topDocsPerCollector) {
+                if (subQueryIndex >= topDocs.size() || Objects.isNull(topDocs.get(subQueryIndex))) {
+                    continue;
+                }
+                TopDocs subQueryTopDocs = topDocs.get(subQueryIndex);
+                subQueryScoreDocs.add(subQueryTopDocs.scoreDocs);
+                totalHits += subQueryTopDocs.totalHits.value;
+                if (subQueryTopDocs.totalHits.relation == TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO) {
+                    relation = TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO;
+                }
+            }
+            ScoreDoc[] mergedScoreDocs = scoreDocsMerger.mergeSorted(subQueryScoreDocs, numHits, SCORE_DOC_BY_SCORE_COMPARATOR);
+            mergedTopDocs.add(new TopDocs(new TotalHits(totalHits, relation), mergedScoreDocs));
+        }
+        return mergedTopDocs;
+    }
+
     private TotalHits getMergedTotalHits(TopDocsAndMaxScore source, TopDocsAndMaxScore newTopDocs) {
         // merged value is a lower bound - if both are equal_to than merged will also be equal_to,
         // otherwise assign greater_than_or_equal
@@ -0,0 +1,150 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.search.util;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+
+import org.opensearch.neuralsearch.query.HybridQuery;
+import org.opensearch.search.profile.ProfileResult;
+import org.opensearch.search.profile.ProfileShardResult;
+import org.opensearch.search.profile.query.QueryProfileShardResult;
+import org.opensearch.search.query.QuerySearchResult;
+
+import lombok.AccessLevel;
+import lombok.NoArgsConstructor;
+
+/**
+ * Utility class that extends search profile results of hybrid query. Weights of sub-queries are created through the shard
+ * searcher, so the profiler reports every sub-query as a child of the hybrid query node with its own create_weight,
+ * build_scorer, next_doc, advance and score timings. Normalization and combination run on the coordinator node after all
+ * shards have been profiled, their breakdown is added to the hybrid query node of every shard together with times of
+ * sub-queries, so the sub-query that dominates the latency is visible right away.
+ */
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+public class HybridSearchProfileUtil {
+
+    public static final String NORMALIZATION_PROFILE_TYPE = "HybridScoreNormalization";
+    public static final String NORMALIZATION_PROFILE_DESCRIPTION =
+        "normalization and combination of sub-query scores of all shards, done on the coordinator node";
+    public static final String SUB_QUERY_TIMES_FIELD = "sub_query_time_in_nanos";
+    public static final String SLOWEST_SUB_QUERY_FIELD = "slowest_sub_query";
+
+    private static final String HYBRID_QUERY_PROFILE_TYPE = HybridQuery.class.getSimpleName();
+    private static final String COUNT_SUFFIX = "_count";
+
+    /**
+     * Checks if shards returned profile results, that's the case when search request has "profile": true
+     * @param querySearchResults query results of all shards
+     * @return true if at least one shard has profile results
+     */
+    public static boolean isProfiled(final List<QuerySearchResult> querySearchResults) {
+        return querySearchResults.stream().anyMatch(QuerySearchResult::hasProfileResults);
+    }
+
+    /**
+     * Adds breakdown of normalization stages and times of sub-queries to the hybrid query node of every shard profile
+     * @param querySearchResults query results of all shards
+     * @param stageTimesInNanos time of every normalization stage keyed by stage name, e.g. normalize or combine
+     */
+    public static void addHybridProfileBreakdown(
+        final List<QuerySearchResult> querySearchResults,
+        final Map<String, Long> stageTimesInNanos
+    ) {
+        Map<String, Long> breakdown = new LinkedHashMap<>();
+        long totalTimeInNanos = 0;
+        for (Map.Entry<String, Long> stage : stageTimesInNanos.entrySet()) {
+            breakdown.put(stage.getKey(), stage.getValue());
+            breakdown.put(stage.getKey() + COUNT_SUFFIX, 1L);
+            totalTimeInNanos += stage.getValue();
+        }
+        ProfileResult normalizationProfile = new ProfileResult(
+            NORMALIZATION_PROFILE_TYPE,
+            NORMALIZATION_PROFILE_DESCRIPTION,
+            breakdown,
+            Map.of(),
+            totalTimeInNanos,
+            List.of()
+        );
+        for (QuerySearchResult querySearchResult : querySearchResults) {
+            if (!querySearchResult.hasProfileResults()) {
+                continue;
+            }
+            ProfileShardResult shardProfile = querySearchResult.consumeProfileResult();
+            List<QueryProfileShardResult> queryProfiles = new ArrayList<>(shardProfile.getQueryProfileResults().size());
+            for (QueryProfileShardResult queryProfile : shardProfile.getQueryProfileResults()) {
+                queryProfiles.add(
+                    new QueryProfileShardResult(
+                        withHybridBreakdown(queryProfile.getQueryResults(), normalizationProfile),
+                        queryProfile.getRewriteTime(),
+                        queryProfile.getCollectorResult()
+                    )
+                );
+            }
+            querySearchResult.profileResults(
+                new ProfileShardResult(queryProfiles, shardProfile.getAggregationProfileResults(), shardProfile.getNetworkTime())
+            );
+        }
+    }
+
+    private static List<ProfileResult> withHybridBreakdown(final List<ProfileResult> profiles, final ProfileResult normalizationProfile) {
+        List<ProfileResult> updatedProfiles = new ArrayList<>(profiles.size());
+        for (ProfileResult profile : profiles) {
+            if (HYBRID_QUERY_PROFILE_TYPE.equals(profile.getQueryName())) {
+                updatedProfiles.add(withHybridBreakdown(profile, normalizationProfile));
+            } else {
+                // hybrid query may be wrapped into a boolean query with filters, e.g. when the index has nested fields
+                updatedProfiles.add(copyWithChildren(profile, withHybridBreakdown(profile.getProfiledChildren(), normalizationProfile)));
+            }
+        }
+        return updatedProfiles;
+    }
+
+    private static ProfileResult withHybridBreakdown(final ProfileResult hybridProfile, final ProfileResult normalizationProfile) {
+        List<ProfileResult> subQueryProfiles = hybridProfile.getProfiledChildren();
+        List<Long> subQueryTimes = new ArrayList<>(subQueryProfiles.size());
+        int slowestSubQuery = -1;
+        for (int i = 0; i < subQueryProfiles.size(); i++) {
+            subQueryTimes.add(subQueryProfiles.get(i).getTime());
+            if (slowestSubQuery < 0 || subQueryProfiles.get(i).getTime() > subQueryProfiles.get(slowestSubQuery).getTime()) {
+                slowestSubQuery = i;
+            }
+        }
+        Map<String, Object> debug = new HashMap<>(Objects.requireNonNullElse(hybridProfile.getDebugInfo(), Map.of()));
+        debug.put(SUB_QUERY_TIMES_FIELD, subQueryTimes);
+        debug.put(SLOWEST_SUB_QUERY_FIELD, slowestSubQuery);
+        List<ProfileResult> children = new ArrayList<>(subQueryProfiles);
+        children.add(normalizationProfile);
+        return new ProfileResult(
+            hybridProfile.getQueryName(),
+            hybridProfile.getLuceneDescription(),
+            hybridProfile.getTimeBreakdown(),
+            debug,
+            hybridProfile.getTime(),
+            children,
+            hybridProfile.getMaxSliceTime(),
+            hybridProfile.getMinSliceTime(),
+            hybridProfile.getAvgSliceTime()
+        );
+    }
+
+    private static ProfileResult copyWithChildren(final ProfileResult profile, final List<ProfileResult> children) {
+        return new ProfileResult(
+            profile.getQueryName(),
+            profile.getLuceneDescription(),
+            profile.getTimeBreakdown(),
+            profile.getDebugInfo(),
+            profile.getTime(),
+            children,
+            profile.getMaxSliceTime(),
+            profile.getMinSliceTime(),
+            profile.getAvgSliceTime()
+        );
+    }
+}
@@ -4,9 +4,14 @@
  */
 package org.opensearch.neuralsearch.search.util;
 
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
 import java.util.Objects;
 
 import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.TotalHits;
 
 /**
  * Utility class for handling format of Hybrid Search query results
@@ -76,4 +81,60 @@ public class HybridSearchResultFormatUtil {
         }
         return !isHybridQuerySpecialElement(scoreDoc);
     }
+
+    /**
+     * Create array of scores in format of hybrid search query results:
+     *  doc_id | magic_number_1
+     *  doc_id | magic_number_2
+     *  ... scores of first sub-query
+     *  doc_id | magic_number_2
+     *  ... scores of second sub-query
+     *  doc_id | magic_number_1
+     * Array is allocated once with its final size, score docs of sub-queries are copied
+     * @param delimiterDocId id of one of docs from actual result object
+     * @param topDocsPerSubQuery results of each sub-query, null results are formatted as sub-query without matches
+     * @return array of scores of all sub-queries with start/stop and delimiter elements
+     */
+    public static ScoreDoc[] createHybridSearchResultScoreDocs(final int delimiterDocId, final List<TopDocs> topDocsPerSubQuery) {
+        int numOfScoreDocs = 2 + topDocsPerSubQuery.size();
+        for (TopDocs topDocs : topDocsPerSubQuery) {
+            if (Objects.nonNull(topDocs) && Objects.nonNull(topDocs.scoreDocs)) {
+                numOfScoreDocs += topDocs.scoreDocs.length;
+            }
+        }
+        ScoreDoc[] scoreDocs = new ScoreDoc[numOfScoreDocs];
+        int index = 0;
+        scoreDocs[index++] = createStartStopElementForHybridSearchResults(delimiterDocId);
+        for (TopDocs topDocs : topDocsPerSubQuery) {
+            scoreDocs[index++] = createDelimiterElementForHybridSearchResults(delimiterDocId);
+            if (Objects.isNull(topDocs) || Objects.isNull(topDocs.scoreDocs)) {
+                continue;
+            }
+            for (ScoreDoc scoreDoc : topDocs.scoreDocs) {
+                scoreDocs[index++] = new ScoreDoc(scoreDoc.doc, scoreDoc.score, scoreDoc.shardIndex);
+            }
+        }
+        scoreDocs[index] = createStartStopElementForHybridSearchResults(delimiterDocId);
+        return scoreDocs;
+    }
+
+    /**
+     * Parse results of each sub-query from array of scores in format of hybrid search query results. Scores of each sub-query
+     * are copied as a range of the array in one pass, first two elements are start/stop element and delimiter of first sub-query
+     * @param scoreDocs array of scores in format of hybrid search query results
+     * @return results of each sub-query
+     */
+    public static List<TopDocs> getSubQueryTopDocs(final ScoreDoc[] scoreDocs) {
+        List<TopDocs> topDocsPerSubQuery = new ArrayList<>();
+        int subQueryStart = 2;
+        for (int index = subQueryStart; index < scoreDocs.length; index++) {
+            if (isHybridQuerySpecialElement(scoreDocs[index])) {
+                ScoreDoc[] subQueryScoreDocs = Arrays.copyOfRange(scoreDocs, subQueryStart, index);
+                TotalHits totalHits = new TotalHits(subQueryScoreDocs.length, TotalHits.Relation.EQUAL_TO);
+                topDocsPerSubQuery.add(new TopDocs(totalHits, subQueryScoreDocs));
+                subQueryStart = index + 1;
+            }
+        }
+        return topDocsPerSubQuery;
+    }
 }
@@ -5,6 +5,8 @@
 package org.opensearch.neuralsearch.settings;
 
 import org.opensearch.common.settings.Setting;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.common.unit.ByteSizeValue;
 
 import lombok.AccessLevel;
 import lombok.NoArgsConstructor;
@@ -34,4 +36,277 @@ public final class NeuralSearchSettings {
         50,
         Setting.Property.NodeScope
     );
+
+    /**
+     * Memory limit for the node level cache of query inference results, used by neural and neural_sparse queries.
+     * Can be set as an absolute value or as a percentage of the heap, zero disables the cache and is the default.
+     */
+    public static final Setting<ByteSizeValue> QUERY_INFERENCE_CACHE_SIZE = Setting.memorySizeSetting(
+        "plugins.neural_search.query_inference_cache.size",
+        "0%",
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Time after which an entry of the query inference cache expires
+     */
+    public static final Setting<TimeValue> QUERY_INFERENCE_CACHE_EXPIRE = Setting.positiveTimeSetting(
+        "plugins.neural_search.query_inference_cache.expire",
+        TimeValue.timeValueMinutes(60),
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Enables batching of query inference calls. Text only neural queries that target the same model are collected
+     * for a short time and sent to the model in a single predict call.
+     */
+    public static final Setting<Boolean> QUERY_INFERENCE_BATCH_ENABLED = Setting.boolSetting(
+        "plugins.neural_search.query_inference_batch.enabled",
+        false,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Time for which query inference requests are collected before they are sent to the model as a batch
+     */
+    public static final Setting<TimeValue> QUERY_INFERENCE_BATCH_WINDOW = Setting.timeSetting(
+        "plugins.neural_search.query_inference_batch.window",
+        TimeValue.timeValueMillis(2),
+        TimeValue.ZERO,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Maximum number of query texts in one batch, batch is sent right away once it reaches this size
+     */
+    public static final Setting<Integer> QUERY_INFERENCE_BATCH_MAX_SIZE = Setting.intSetting(
+        "plugins.neural_search.query_inference_batch.max_size",
+        32,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Maximum number of queued and in-flight query inference requests per model, requests above this limit are rejected
+     */
+    public static final Setting<Integer> QUERY_INFERENCE_BATCH_MAX_QUEUE_DEPTH = Setting.intSetting(
+        "plugins.neural_search.query_inference_batch.max_queue_depth",
+        1000,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Maximum number of texts sent to the model in one inference call during batch ingestion
+     */
+    public static final Setting<Integer> INGEST_INFERENCE_BATCH_MAX_SIZE = Setting.intSetting(
+        "plugins.neural_search.ingest_inference_batch.max_size",
+        256,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Maximum total length in characters of texts sent to the model in one inference call during batch ingestion,
+     * zero means there is no limit
+     */
+    public static final Setting<Integer> INGEST_INFERENCE_BATCH_MAX_CHARS = Setting.intSetting(
+        "plugins.neural_search.ingest_inference_batch.max_chars",
+        0,
+        0,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Maximum number of inference calls that run at the same time for one batch of ingested documents
+     */
+    public static final Setting<Integer> INGEST_INFERENCE_BATCH_MAX_IN_FLIGHT = Setting.intSetting(
+        "plugins.neural_search.ingest_inference_batch.max_in_flight",
+        2,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Memory limit for the node level cache of batch ingestion inference results, used by text_embedding and sparse_encoding
+     * processors. Can be set as an absolute value or as a percentage of the heap, zero disables the cache.
+     */
+    public static final Setting<ByteSizeValue> INGEST_INFERENCE_CACHE_SIZE = Setting.memorySizeSetting(
+        "plugins.neural_search.ingest_inference_cache.size",
+        "0%",
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Time after which an entry of the ingestion inference cache expires
+     */
+    public static final Setting<TimeValue> INGEST_INFERENCE_CACHE_EXPIRE = Setting.positiveTimeSetting(
+        "plugins.neural_search.ingest_inference_cache.expire",
+        TimeValue.timeValueMinutes(60),
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Enables adaptive per model limit of concurrent inference calls. Calls above the limit wait in a bounded queue,
+     * calls that don't fit into the queue are rejected.
+     */
+    public static final Setting<Boolean> INFERENCE_CONCURRENCY_LIMIT_ENABLED = Setting.boolSetting(
+        "plugins.neural_search.inference_concurrency_limit.enabled",
+        false,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Limit of concurrent inference calls per model before it's adapted to observed latency
+     */
+    public static final Setting<Integer> INFERENCE_CONCURRENCY_LIMIT_INITIAL = Setting.intSetting(
+        "plugins.neural_search.inference_concurrency_limit.initial",
+        16,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Upper bound of the adaptive limit of concurrent inference calls per model
+     */
+    public static final Setting<Integer> INFERENCE_CONCURRENCY_LIMIT_MAX = Setting.intSetting(
+        "plugins.neural_search.inference_concurrency_limit.max",
+        256,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Max number of inference calls per model that wait for a free slot
+     */
+    public static final Setting<Integer> INFERENCE_CONCURRENCY_LIMIT_MAX_QUEUE_SIZE = Setting.intSetting(
+        "plugins.neural_search.inference_concurrency_limit.max_queue_size",
+        1000,
+        0,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Delay after which query time inference call is sent once more if it hasn't completed, first response is used.
+     * Zero disables hedged calls.
+     */
+    public static final Setting<TimeValue> QUERY_INFERENCE_HEDGE_DELAY = Setting.timeSetting(
+        "plugins.neural_search.query_inference.hedge_delay",
+        TimeValue.ZERO,
+        TimeValue.ZERO,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Max memory of the node level cache of rerank scores, 0 disables the cache and is the default. Scores are reused
+     * only for the same model, query text and document context, hits requested with "version" or "seq_no_primary_term"
+     * are also identified by that version.
+     */
+    public static final Setting<ByteSizeValue> RERANK_SCORE_CACHE_SIZE = Setting.memorySizeSetting(
+        "plugins.neural_search.rerank_score_cache.size",
+        "0%",
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Time after which an entry of the rerank score cache expires
+     */
+    public static final Setting<TimeValue> RERANK_SCORE_CACHE_EXPIRE = Setting.positiveTimeSetting(
+        "plugins.neural_search.rerank_score_cache.expire",
+        TimeValue.timeValueMinutes(60),
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Enables adaptive per shard window of hybrid query. When enabled each shard collects for every sub-query only its
+     * share of "from + size" hits instead of all of them, see {@link #HYBRID_SEARCH_SHARD_WINDOW_FACTOR}. Results are
+     * approximate if top documents are not evenly distributed among shards.
+     */
+    public static final Setting<Boolean> HYBRID_SEARCH_SHARD_WINDOW_ENABLED = Setting.boolSetting(
+        "index.neural_search.hybrid_search.shard_window.enabled",
+        false,
+        Setting.Property.IndexScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Factor of adaptive per shard window of hybrid query, each shard collects ceil(factor * (from + size) / number of shards)
+     * hits for every sub-query
+     */
+    public static final Setting<Double> HYBRID_SEARCH_SHARD_WINDOW_FACTOR = Setting.doubleSetting(
+        "index.neural_search.hybrid_search.shard_window.factor",
+        1.5,
+        1.0,
+        Setting.Property.IndexScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum number of threads, including the calling one, that run sub-query tasks of one hybrid query at the same time
+     */
+    public static final Setting<Integer> HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST = Setting.intSetting(
+        "plugins.neural_search.hybrid_query_executor.max_parallel_tasks_per_request",
+        3,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Enables recording of latency and size histograms of neural search stages, reported by the neural stats API
+     */
+    public static final Setting<Boolean> NEURAL_SEARCH_STATS_ENABLED = Setting.boolSetting(
+        "plugins.neural_search.stats_enabled",
+        false,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Enables warm-up of models referenced by ingest and search pipelines after node start and pipeline updates,
+     * readiness of the node is reported by GET /_plugins/_neural/warmup
+     */
+    public static final Setting<Boolean> MODEL_WARMUP_ENABLED = Setting.boolSetting(
+        "plugins.neural_search.model_warmup.enabled",
+        false,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Text sent to models in warm-up inferences
+     */
+    public static final Setting<String> MODEL_WARMUP_TEXT = Setting.simpleString(
+        "plugins.neural_search.model_warmup.text",
+        "neural search model warm-up",
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Number of successful warm-up inferences after which a model is ready
+     */
+    public static final Setting<Integer> MODEL_WARMUP_INFERENCES = Setting.intSetting(
+        "plugins.neural_search.model_warmup.inferences",
+        3,
+        1,
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Delay before a failed warm-up inference is sent again, e.g. while the model is still being deployed
+     */
+    public static final Setting<TimeValue> MODEL_WARMUP_RETRY_DELAY = Setting.positiveTimeSetting(
+        "plugins.neural_search.model_warmup.retry_delay",
+        TimeValue.timeValueSeconds(30),
+        Setting.Property.NodeScope
+    );
+
+    /**
+     * Number of failed warm-up inferences after which warm-up of a model stops until its pipelines are updated
+     */
+    public static final Setting<Integer> MODEL_WARMUP_MAX_ATTEMPTS = Setting.intSetting(
+        "plugins.neural_search.model_warmup.max_attempts",
+        10,
+        1,
+        Setting.Property.NodeScope
+    );
 }
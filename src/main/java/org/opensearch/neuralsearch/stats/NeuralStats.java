@@ -0,0 +1,202 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.stats;
+
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Supplier;
+
+import org.opensearch.common.cache.Cache;
+import org.opensearch.core.action.ActionListener;
+
+import com.google.common.annotations.VisibleForTesting;
+
+import lombok.extern.log4j.Log4j2;
+
+/**
+ * Node level latency and size histograms of neural search stages. Recording is disabled by default and switched on with a
+ * dynamic setting, when disabled timers are not started and every record call returns right away. Besides histograms
+ * components register suppliers of their own counters, e.g. caches or executors, so all stats are reported by one API.
+ */
+@Log4j2
+public final class NeuralStats {
+
+    public static final String NEURAL_QUERY_INFERENCE_TIME = "neural_query.inference_time_micros";
+    public static final String NEURAL_SPARSE_QUERY_INFERENCE_TIME = "neural_sparse_query.inference_time_micros";
+    public static final String INGEST_INFERENCE_TIME_PREFIX = "ingest.inference_time_micros.";
+    public static final String INGEST_INFERENCE_BATCH_SIZE_PREFIX = "ingest.inference_batch_size.";
+    public static final String TEXT_CHUNKING_TIME = "text_chunking.time_micros";
+    public static final String TEXT_CHUNKING_CHUNKS = "text_chunking.chunks_per_document";
+    public static final String NORMALIZATION_NORMALIZE_TIME = "normalization.normalize_time_micros";
+    public static final String NORMALIZATION_COMBINE_TIME = "normalization.combine_time_micros";
+    public static final String NORMALIZATION_FETCH_UPDATE_TIME = "normalization.fetch_update_time_micros";
+    public static final String RERANK_TIME = "rerank.time_micros";
+    public static final String HYBRID_QUERY_EXECUTOR_QUEUE_TIME = "hybrid_query_executor.queue_time_micros";
+
+    // returned by startTimer when stats are disabled, record calls with this start time are ignored
+    public static final long DISABLED_TIMER = Long.MIN_VALUE;
+
+    private static final NeuralStats INSTANCE = new NeuralStats();
+
+    private final Map<String, StatHistogram> histograms = new ConcurrentHashMap<>();
+    private final Map<String, Supplier<Object>> statsSuppliers = new ConcurrentHashMap<>();
+    private volatile boolean enabled;
+
+    @VisibleForTesting
+    NeuralStats() {}
+
+    /**
+     * Returns node level stats. Instance is created eagerly, so getting it on a hot path doesn't synchronize
+     * @return instance of stats
+     */
+    public static NeuralStats instance() {
+        return INSTANCE;
+    }
+
+    public boolean isEnabled() {
+        return enabled;
+    }
+
+    /**
+     * Switches recording of histograms on or off, recorded values are kept when stats are disabled
+     * @param enabled true to record histograms
+     */
+    public void setEnabled(final boolean enabled) {
+        this.enabled = enabled;
+        log.info("Neural search stats are {}", enabled ? "enabled" : "disabled");
+    }
+
+    /**
+     * Starts timer of a stage
+     * @return start time in nanoseconds, or {@link #DISABLED_TIMER} if stats are disabled
+     */
+    public long startTimer() {
+        return enabled ? System.nanoTime() : DISABLED_TIMER;
+    }
+
+    /**
+     * Records time of a stage since the start time
+     * @param name name of the stat
+     * @param startNanos value returned by {@link #startTimer()}
+     */
+    public void recordTime(final String name, final long startNanos) {
+        if (startNanos == DISABLED_TIMER) {
+            return;
+        }
+        histogram(name, StatHistogram.TIME_BOUNDS_MICROS).record(TimeUnit.NANOSECONDS.toMicros(System.nanoTime() - startNanos));
+    }
+
+    /**
+     * Records time of a stage measured by the caller
+     * @param name name of the stat
+     * @param elapsedNanos time of the stage in nanoseconds
+     */
+    public void recordElapsedTime(final String name, final long elapsedNanos) {
+        if (!enabled) {
+            return;
+        }
+        histogram(name, StatHistogram.TIME_BOUNDS_MICROS).record(TimeUnit.NANOSECONDS.toMicros(elapsedNanos));
+    }
+
+    /**
+     * Records a size, e.g. number of texts in a batch
+     * @param name name of the stat
+     * @param value value to record
+     */
+    public void recordSize(final String name, final long value) {
+        if (!enabled) {
+            return;
+        }
+        histogram(name, StatHistogram.SIZE_BOUNDS).record(value);
+    }
+
+    /**
+     * Wraps listener of an async stage, time is recorded when the listener completes either way
+     * @param name name of the stat
+     * @param listener listener of the stage
+     * @return listener that records time, or the same listener if stats are disabled
+     * @param <T> type of the result
+     */
+    public <T> ActionListener<T> timedListener(final String name, final ActionListener<T> listener) {
+        long startNanos = startTimer();
+        if (startNanos == DISABLED_TIMER) {
+            return listener;
+        }
+        return ActionListener.runBefore(listener, () -> recordTime(name, startNanos));
+    }
+
+    /**
+     * Registers supplier of counters kept by a component, supplier is called every time stats are requested
+     * @param name name the counters are reported under
+     * @param supplier supplier of counters, usually a map or a number
+     */
+    public void registerStatsSupplier(final String name, final Supplier<Object> supplier) {
+        statsSuppliers.put(name, supplier);
+    }
+
+    /**
+     * Removes all recorded values
+     */
+    public void reset() {
+        histograms.clear();
+    }
+
+    /**
+     * Point in time view of all stats
+     * @return map with enabled flag, histograms keyed by stat name and counters of registered components
+     */
+    public Map<String, Object> toMap() {
+        Map<String, Object> stats = new TreeMap<>();
+        stats.put("enabled", enabled);
+        Map<String, Object> stages = new TreeMap<>();
+        histograms.forEach((name, histogram) -> stages.put(name, histogram.toMap()));
+        stats.put("stages", stages);
+        statsSuppliers.forEach((name, supplier) -> {
+            try {
+                stats.put(name, supplier.get());
+            } catch (Exception e) {
+                // stats of one component must not fail the whole response
+                log.warn("failed to collect neural search stats [{}]", name, e);
+            }
+        });
+        return stats;
+    }
+
+    /**
+     * Counters of a node level cache in the format reported by the neural stats API
+     * @param count number of entries
+     * @param memorySizeInBytes approximate memory used by entries
+     * @param cacheStats hits, misses and evictions of the cache
+     * @return map of counter names to values
+     */
+    public static Map<String, Object> cacheStats(final int count, final long memorySizeInBytes, final Cache.CacheStats cacheStats) {
+        long lookups = cacheStats.getHits() + cacheStats.getMisses();
+        Map<String, Object> stats = new LinkedHashMap<>();
+        stats.put("count", count);
+        stats.put("memory_size_in_bytes", memorySizeInBytes);
+        stats.put("hits", cacheStats.getHits());
+        stats.put("misses", cacheStats.getMisses());
+        stats.put("evictions", cacheStats.getEvictions());
+        stats.put("hit_rate", lookups == 0 ? 0.0 : (double) cacheStats.getHits() / lookups);
+        return stats;
+    }
+
+    @VisibleForTesting
+    StatHistogram getHistogram(final String name) {
+        return histograms.get(name);
+    }
+
+    private StatHistogram histogram(final String name, final long[] bounds) {
+        // get doesn't lock, computeIfAbsent may lock the bin on first record of the stat
+        StatHistogram histogram = histograms.get(name);
+        if (histogram == null) {
+            histogram = histograms.computeIfAbsent(name, key -> new StatHistogram(bounds));
+        }
+        return histogram;
+    }
+}
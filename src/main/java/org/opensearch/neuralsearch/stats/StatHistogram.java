@@ -0,0 +1,139 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.stats;
+
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.concurrent.atomic.LongAccumulator;
+import java.util.concurrent.atomic.LongAdder;
+
+/**
+ * Histogram with fixed bucket bounds. All counters are striped adders, so recording a value from many threads doesn't
+ * contend on a single memory location and never takes a lock.
+ */
+public final class StatHistogram {
+
+    // bounds of time histograms in microseconds, from 100 micros to 10 seconds
+    static final long[] TIME_BOUNDS_MICROS = new long[] {
+        100,
+        500,
+        1_000,
+        2_000,
+        5_000,
+        10_000,
+        20_000,
+        50_000,
+        100_000,
+        200_000,
+        500_000,
+        1_000_000,
+        2_000_000,
+        5_000_000,
+        10_000_000 };
+    // bounds of histograms of sizes, e.g. number of texts in a batch or chunks of a document
+    static final long[] SIZE_BOUNDS = new long[] { 1, 2, 5, 10, 20, 50, 100, 200, 500, 1_000 };
+
+    private static final String OVERFLOW_BUCKET = "inf";
+
+    private final long[] bounds;
+    // last bucket counts values above the highest bound
+    private final LongAdder[] buckets;
+    private final LongAdder count = new LongAdder();
+    private final LongAdder sum = new LongAdder();
+    private final LongAccumulator max = new LongAccumulator(Math::max, 0);
+
+    StatHistogram(final long[] bounds) {
+        this.bounds = bounds;
+        this.buckets = new LongAdder[bounds.length + 1];
+        for (int i = 0; i < buckets.length; i++) {
+            buckets[i] = new LongAdder();
+        }
+    }
+
+    /**
+     * Records one value
+     * @param value value to record, negative values are recorded as 0
+     */
+    public void record(final long value) {
+        long nonNegativeValue = Math.max(0, value);
+        int bucket = Arrays.binarySearch(bounds, nonNegativeValue);
+        // binary search returns -(insertion point) - 1 for values between bounds, bucket of a value is the first bound >= value
+        buckets[bucket >= 0 ? bucket : -bucket - 1].increment();
+        count.increment();
+        sum.add(nonNegativeValue);
+        max.accumulate(nonNegativeValue);
+    }
+
+    public long getCount() {
+        return count.sum();
+    }
+
+    public long getSum() {
+        return sum.sum();
+    }
+
+    public long getMax() {
+        return max.get();
+    }
+
+    /**
+     * Estimates percentile from bucket counts, the estimate is the upper bound of the bucket the percentile falls into
+     * @param percentile percentile between 0 and 100
+     * @return estimated value, or max recorded value if percentile falls into the overflow bucket
+     */
+    public long getPercentile(final double percentile) {
+        long[] bucketCounts = bucketCounts();
+        long total = 0;
+        for (long bucketCount : bucketCounts) {
+            total += bucketCount;
+        }
+        if (total == 0) {
+            return 0;
+        }
+        long rank = (long) Math.ceil(total * percentile / 100.0);
+        long seen = 0;
+        for (int i = 0; i < bounds.length; i++) {
+            seen += bucketCounts[i];
+            if (seen >= Math.max(1, rank)) {
+                return Math.min(bounds[i], getMax());
+            }
+        }
+        return getMax();
+    }
+
+    /**
+     * Point in time view of the histogram
+     * @return map with count, sum, max, average, estimated percentiles and bucket counts keyed by upper bound
+     */
+    public Map<String, Object> toMap() {
+        Map<String, Object> stats = new LinkedHashMap<>();
+        long countSnapshot = getCount();
+        long sumSnapshot = getSum();
+        stats.put("count", countSnapshot);
+        stats.put("sum", sumSnapshot);
+        stats.put("max", getMax());
+        stats.put("avg", countSnapshot == 0 ? 0.0 : (double) sumSnapshot / countSnapshot);
+        stats.put("p50", getPercentile(50));
+        stats.put("p90", getPercentile(90));
+        stats.put("p99", getPercentile(99));
+        long[] bucketCounts = bucketCounts();
+        Map<String, Long> bucketsByBound = new LinkedHashMap<>();
+        for (int i = 0; i < bounds.length; i++) {
+            bucketsByBound.put(Long.toString(bounds[i]), bucketCounts[i]);
+        }
+        bucketsByBound.put(OVERFLOW_BUCKET, bucketCounts[bounds.length]);
+        stats.put("buckets", bucketsByBound);
+        return stats;
+    }
+
+    private long[] bucketCounts() {
+        long[] bucketCounts = new long[buckets.length];
+        for (int i = 0; i < buckets.length; i++) {
+            bucketCounts[i] = buckets[i].sum();
+        }
+        return bucketCounts;
+    }
+}
@@ -0,0 +1,20 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.ActionType;
+
+/**
+ * Action that collects neural search stats from nodes of the cluster
+ */
+public class NeuralStatsAction extends ActionType<NeuralStatsResponse> {
+
+    public static final NeuralStatsAction INSTANCE = new NeuralStatsAction();
+    public static final String NAME = "cluster:monitor/neural_search/stats";
+
+    private NeuralStatsAction() {
+        super(NAME, NeuralStatsResponse::new);
+    }
+}
@@ -0,0 +1,24 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import java.io.IOException;
+
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.transport.TransportRequest;
+
+/**
+ * Request of neural search stats sent to one node. Node reports all its stats, so the request has no parameters
+ */
+public class NeuralStatsNodeRequest extends TransportRequest {
+
+    public NeuralStatsNodeRequest() {
+        super();
+    }
+
+    public NeuralStatsNodeRequest(final StreamInput in) throws IOException {
+        super(in);
+    }
+}
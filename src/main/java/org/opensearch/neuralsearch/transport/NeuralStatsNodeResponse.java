@@ -0,0 +1,50 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import java.io.IOException;
+import java.util.Map;
+
+import org.opensearch.action.support.nodes.BaseNodeResponse;
+import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.io.stream.StreamOutput;
+import org.opensearch.core.xcontent.ToXContentFragment;
+import org.opensearch.core.xcontent.XContentBuilder;
+
+import lombok.Getter;
+
+/**
+ * Neural search stats of one node
+ */
+@Getter
+public class NeuralStatsNodeResponse extends BaseNodeResponse implements ToXContentFragment {
+
+    private final Map<String, Object> stats;
+
+    public NeuralStatsNodeResponse(final DiscoveryNode node, final Map<String, Object> stats) {
+        super(node);
+        this.stats = stats;
+    }
+
+    public NeuralStatsNodeResponse(final StreamInput in) throws IOException {
+        super(in);
+        this.stats = in.readMap();
+    }
+
+    @Override
+    public void writeTo(final StreamOutput out) throws IOException {
+        super.writeTo(out);
+        out.writeMap(stats);
+    }
+
+    @Override
+    public XContentBuilder toXContent(final XContentBuilder builder, final Params params) throws IOException {
+        for (Map.Entry<String, Object> stat : stats.entrySet()) {
+            builder.field(stat.getKey(), stat.getValue());
+        }
+        return builder;
+    }
+}
@@ -0,0 +1,24 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import java.io.IOException;
+
+import org.opensearch.action.support.nodes.BaseNodesRequest;
+import org.opensearch.core.common.io.stream.StreamInput;
+
+/**
+ * Request of neural search stats from a set of nodes, all nodes of the cluster if no node ids are given
+ */
+public class NeuralStatsRequest extends BaseNodesRequest<NeuralStatsRequest> {
+
+    public NeuralStatsRequest(final String... nodeIds) {
+        super(nodeIds);
+    }
+
+    public NeuralStatsRequest(final StreamInput in) throws IOException {
+        super(in);
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import java.io.IOException;
+import java.util.List;
+
+import org.opensearch.action.FailedNodeException;
+import org.opensearch.action.support.nodes.BaseNodesResponse;
+import org.opensearch.cluster.ClusterName;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.io.stream.StreamOutput;
+import org.opensearch.core.xcontent.ToXContentFragment;
+import org.opensearch.core.xcontent.XContentBuilder;
+
+/**
+ * Neural search stats of all nodes the request was sent to, stats of every node are keyed by node id
+ */
+public class NeuralStatsResponse extends BaseNodesResponse<NeuralStatsNodeResponse> implements ToXContentFragment {
+
+    private static final String NODES_FIELD = "nodes";
+
+    public NeuralStatsResponse(
+        final ClusterName clusterName,
+        final List<NeuralStatsNodeResponse> nodes,
+        final List<FailedNodeException> failures
+    ) {
+        super(clusterName, nodes, failures);
+    }
+
+    public NeuralStatsResponse(final StreamInput in) throws IOException {
+        super(in);
+    }
+
+    @Override
+    protected List<NeuralStatsNodeResponse> readNodesFrom(final StreamInput in) throws IOException {
+        return in.readList(NeuralStatsNodeResponse::new);
+    }
+
+    @Override
+    protected void writeNodesTo(final StreamOutput out, final List<NeuralStatsNodeResponse> nodes) throws IOException {
+        out.writeList(nodes);
+    }
+
+    @Override
+    public XContentBuilder toXContent(final XContentBuilder builder, final Params params) throws IOException {
+        builder.startObject(NODES_FIELD);
+        for (NeuralStatsNodeResponse node : getNodes()) {
+            builder.startObject(node.getNode().getId());
+            node.toXContent(builder, params);
+            builder.endObject();
+        }
+        builder.endObject();
+        return builder;
+    }
+}
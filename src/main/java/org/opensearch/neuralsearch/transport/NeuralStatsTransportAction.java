@@ -0,0 +1,72 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import java.io.IOException;
+import java.util.List;
+
+import org.opensearch.action.FailedNodeException;
+import org.opensearch.action.support.ActionFilters;
+import org.opensearch.action.support.nodes.TransportNodesAction;
+import org.opensearch.cluster.service.ClusterService;
+import org.opensearch.common.inject.Inject;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.neuralsearch.stats.NeuralStats;
+import org.opensearch.threadpool.ThreadPool;
+import org.opensearch.transport.TransportService;
+
+/**
+ * Collects {@link NeuralStats} of every node the request is sent to
+ */
+public class NeuralStatsTransportAction extends TransportNodesAction<
+    NeuralStatsRequest,
+    NeuralStatsResponse,
+    NeuralStatsNodeRequest,
+    NeuralStatsNodeResponse> {
+
+    @Inject
+    public NeuralStatsTransportAction(
+        final ThreadPool threadPool,
+        final ClusterService clusterService,
+        final TransportService transportService,
+        final ActionFilters actionFilters
+    ) {
+        super(
+            NeuralStatsAction.NAME,
+            threadPool,
+            clusterService,
+            transportService,
+            actionFilters,
+            NeuralStatsRequest::new,
+            NeuralStatsNodeRequest::new,
+            ThreadPool.Names.MANAGEMENT,
+            NeuralStatsNodeResponse.class
+        );
+    }
+
+    @Override
+    protected NeuralStatsResponse newResponse(
+        final NeuralStatsRequest request,
+        final List<NeuralStatsNodeResponse> responses,
+        final List<FailedNodeException> failures
+    ) {
+        return new NeuralStatsResponse(clusterService.getClusterName(), responses, failures);
+    }
+
+    @Override
+    protected NeuralStatsNodeRequest newNodeRequest(final NeuralStatsRequest request) {
+        return new NeuralStatsNodeRequest();
+    }
+
+    @Override
+    protected NeuralStatsNodeResponse newNodeResponse(final StreamInput in) throws IOException {
+        return new NeuralStatsNodeResponse(in);
+    }
+
+    @Override
+    protected NeuralStatsNodeResponse nodeOperation(final NeuralStatsNodeRequest request) {
+        return new NeuralStatsNodeResponse(clusterService.localNode(), NeuralStats.instance().toMap());
+    }
+}
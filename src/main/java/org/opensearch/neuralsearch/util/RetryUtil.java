@@ -7,6 +7,7 @@ package org.opensearch.neuralsearch.util;
 import java.util.List;
 
 import org.apache.commons.lang3.exception.ExceptionUtils;
+import org.opensearch.common.Randomness;
 import org.opensearch.transport.NodeDisconnectedException;
 import org.opensearch.transport.NodeNotConnectedException;
 
@@ -15,6 +16,8 @@ import com.google.common.collect.ImmutableList;
 public class RetryUtil {
 
     private static final int MAX_RETRY = 3;
+    private static final long BASE_BACKOFF_MILLIS = 50;
+    private static final long MAX_BACKOFF_MILLIS = 2000;
 
     private static final List<Class<? extends Throwable>> RETRYABLE_EXCEPTIONS = ImmutableList.of(
         NodeNotConnectedException.class,
@@ -28,8 +31,26 @@ public class RetryUtil {
      * @return {@link boolean} which is the result of if current exception needs retry or not.
      */
     public static boolean shouldRetry(final Exception e, int retryTime) {
-        boolean hasRetryException = RETRYABLE_EXCEPTIONS.stream().anyMatch(x -> ExceptionUtils.indexOfThrowable(e, x) != -1);
-        return hasRetryException && retryTime < MAX_RETRY;
+        return isRetryableException(e) && retryTime < MAX_RETRY;
+    }
+
+    /**
+     * @param e {@link Exception} which is the exception received to check.
+     * @return {@link boolean} true if the exception or one of its causes is retryable, regardless of the retried times.
+     */
+    public static boolean isRetryableException(final Exception e) {
+        return RETRYABLE_EXCEPTIONS.stream().anyMatch(x -> ExceptionUtils.indexOfThrowable(e, x) != -1);
+    }
+
+    /**
+     * Delay before the next retry. Delay grows exponentially with the retried times and is randomized in the whole range
+     * (full jitter), so retries of calls that failed at the same time don't hit the model node at the same time again.
+     * @param retryTime {@link int} which is the current retried times.
+     * @return {@link long} delay in milliseconds.
+     */
+    public static long getBackoffDelayMillis(final int retryTime) {
+        long maxDelay = Math.min(MAX_BACKOFF_MILLIS, BASE_BACKOFF_MILLIS << Math.min(retryTime, 16));
+        return Randomness.get().nextInt((int) maxDelay + 1);
     }
 
 }
@@ -0,0 +1,56 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.util.prune;
+
+import java.util.Arrays;
+import java.util.Locale;
+import java.util.stream.Collectors;
+
+import org.apache.commons.lang.StringUtils;
+
+import lombok.AllArgsConstructor;
+import lombok.Getter;
+
+/**
+ * Strategies of pruning tokens of sparse vectors, see {@link PruneUtils}
+ */
+@AllArgsConstructor
+@Getter
+public enum PruneType {
+    // keep all tokens
+    NONE("none"),
+    // keep given number of tokens with the highest weights
+    TOP_K("top_k"),
+    // keep tokens with weight at least given ratio of the max weight
+    MAX_RATIO("max_ratio"),
+    // keep tokens with the highest weights until they have given share of the total weight
+    ALPHA_MASS("alpha_mass");
+
+    private final String value;
+
+    /**
+     * Get prune type by its value from processor configuration
+     * @param value value of prune type, blank value means no pruning
+     * @return prune type
+     */
+    public static PruneType getPruneType(final String value) {
+        if (StringUtils.isBlank(value)) {
+            return NONE;
+        }
+        for (PruneType pruneType : values()) {
+            if (pruneType.value.equals(value)) {
+                return pruneType;
+            }
+        }
+        throw new IllegalArgumentException(
+            String.format(
+                Locale.ROOT,
+                "Unknown prune type [%s], supported types are [%s]",
+                value,
+                Arrays.stream(values()).map(PruneType::getValue).collect(Collectors.joining(","))
+            )
+        );
+    }
+}
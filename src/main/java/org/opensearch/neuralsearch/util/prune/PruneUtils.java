@@ -0,0 +1,152 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.util.prune;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Objects;
+
+import lombok.AccessLevel;
+import lombok.NoArgsConstructor;
+
+/**
+ * Utility class for pruning and quantization of sparse vectors, i.e. maps of tokens and their weights
+ */
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+public final class PruneUtils {
+
+    /**
+     * Prune tokens of sparse vector with given strategy. Original map is not modified.
+     * @param pruneType strategy of pruning
+     * @param pruneRatio parameter of the strategy, see {@link #validatePruneRatio(PruneType, float)}
+     * @param sparseVector tokens and their weights
+     * @return tokens that are kept after pruning with their weights
+     */
+    public static Map<String, Float> pruneSparseVector(
+        final PruneType pruneType,
+        final float pruneRatio,
+        final Map<String, Float> sparseVector
+    ) {
+        if (Objects.isNull(sparseVector)) {
+            throw new IllegalArgumentException("sparse vector cannot be null");
+        }
+        switch (pruneType) {
+            case TOP_K:
+                return pruneByTopK(sparseVector, (int) pruneRatio);
+            case MAX_RATIO:
+                return pruneByMaxRatio(sparseVector, pruneRatio);
+            case ALPHA_MASS:
+                return pruneByAlphaMass(sparseVector, pruneRatio);
+            default:
+                return sparseVector;
+        }
+    }
+
+    /**
+     * Round weights of sparse vector to the nearest multiple of quantization step. Tokens with weight rounded to zero are removed.
+     * Original map is not modified.
+     * @param quantizationStep step of quantization, zero means weights are not quantized
+     * @param sparseVector tokens and their weights
+     * @return tokens with quantized weights
+     */
+    public static Map<String, Float> quantizeSparseVector(final float quantizationStep, final Map<String, Float> sparseVector) {
+        if (quantizationStep <= 0) {
+            return sparseVector;
+        }
+        Map<String, Float> quantizedSparseVector = new HashMap<>(sparseVector.size());
+        for (Map.Entry<String, Float> entry : sparseVector.entrySet()) {
+            float quantizedWeight = Math.round(entry.getValue() / quantizationStep) * quantizationStep;
+            if (quantizedWeight > 0) {
+                quantizedSparseVector.put(entry.getKey(), quantizedWeight);
+            }
+        }
+        return quantizedSparseVector;
+    }
+
+    /**
+     * Validate parameter of pruning strategy:
+     * - top_k: number of tokens to keep, integer greater than or equal to 1
+     * - max_ratio: ratio of the max weight, in range [0, 1)
+     * - alpha_mass: share of the total weight, in range (0, 1]
+     * @param pruneType strategy of pruning
+     * @param pruneRatio parameter of the strategy
+     */
+    public static void validatePruneRatio(final PruneType pruneType, final float pruneRatio) {
+        boolean isValid;
+        switch (pruneType) {
+            case TOP_K:
+                isValid = pruneRatio >= 1 && pruneRatio == Math.rint(pruneRatio);
+                break;
+            case MAX_RATIO:
+                isValid = pruneRatio >= 0 && pruneRatio < 1;
+                break;
+            case ALPHA_MASS:
+                isValid = pruneRatio > 0 && pruneRatio <= 1;
+                break;
+            default:
+                isValid = true;
+        }
+        if (!isValid) {
+            throw new IllegalArgumentException(
+                String.format(Locale.ROOT, "Illegal prune_ratio [%s] for prune type [%s]", pruneRatio, pruneType.getValue())
+            );
+        }
+    }
+
+    private static Map<String, Float> pruneByTopK(final Map<String, Float> sparseVector, final int k) {
+        if (sparseVector.size() <= k) {
+            return sparseVector;
+        }
+        List<Map.Entry<String, Float>> tokens = getTokensByWeightDescending(sparseVector);
+        Map<String, Float> prunedSparseVector = new HashMap<>(k);
+        for (int i = 0; i < k; i++) {
+            prunedSparseVector.put(tokens.get(i).getKey(), tokens.get(i).getValue());
+        }
+        return prunedSparseVector;
+    }
+
+    private static Map<String, Float> pruneByMaxRatio(final Map<String, Float> sparseVector, final float ratio) {
+        float maxWeight = 0f;
+        for (Float weight : sparseVector.values()) {
+            maxWeight = Math.max(maxWeight, weight);
+        }
+        float threshold = maxWeight * ratio;
+        Map<String, Float> prunedSparseVector = new HashMap<>();
+        for (Map.Entry<String, Float> entry : sparseVector.entrySet()) {
+            if (entry.getValue() >= threshold) {
+                prunedSparseVector.put(entry.getKey(), entry.getValue());
+            }
+        }
+        return prunedSparseVector;
+    }
+
+    private static Map<String, Float> pruneByAlphaMass(final Map<String, Float> sparseVector, final float alpha) {
+        List<Map.Entry<String, Float>> tokens = getTokensByWeightDescending(sparseVector);
+        double totalWeight = 0;
+        for (Map.Entry<String, Float> token : tokens) {
+            totalWeight += token.getValue();
+        }
+        double massToKeep = totalWeight * alpha;
+        double keptMass = 0;
+        Map<String, Float> prunedSparseVector = new HashMap<>();
+        for (Map.Entry<String, Float> token : tokens) {
+            if (keptMass >= massToKeep) {
+                break;
+            }
+            prunedSparseVector.put(token.getKey(), token.getValue());
+            keptMass += token.getValue();
+        }
+        return prunedSparseVector;
+    }
+
+    private static List<Map.Entry<String, Float>> getTokensByWeightDescending(final Map<String, Float> sparseVector) {
+        List<Map.Entry<String, Float>> tokens = new ArrayList<>(sparseVector.entrySet());
+        tokens.sort(Map.Entry.<String, Float>comparingByValue().reversed());
+        return tokens;
+    }
+}
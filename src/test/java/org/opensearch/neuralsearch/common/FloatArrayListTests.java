@@ -0,0 +1,49 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.common;
+
+import java.util.List;
+
+import org.opensearch.test.OpenSearchTestCase;
+
+public class FloatArrayListTests extends OpenSearchTestCase {
+
+    public void testGet_whenListIsRangeOfArray_thenReturnElementsOfRange() {
+        float[] data = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+        FloatArrayList list = new FloatArrayList(data, 1, 3);
+
+        assertEquals(3, list.size());
+        assertEquals(2.0f, list.getFloat(0), 0.0f);
+        assertEquals(Float.valueOf(4.0f), list.get(2));
+        assertEquals(List.of(2.0f, 3.0f, 4.0f), list);
+        assertEquals(List.of(2.0f, 3.0f, 4.0f).hashCode(), list.hashCode());
+        expectThrows(IndexOutOfBoundsException.class, () -> list.get(3));
+        expectThrows(IndexOutOfBoundsException.class, () -> new FloatArrayList(data, 3, 3));
+    }
+
+    public void testSet_whenElementUpdated_thenOnlyRangeOfListChanged() {
+        float[] data = { 1.0f, 2.0f, 3.0f, 4.0f };
+        FloatArrayList first = new FloatArrayList(data, 0, 2);
+        FloatArrayList second = new FloatArrayList(data, 2, 2);
+
+        assertEquals(Float.valueOf(2.0f), first.set(1, 7.0f));
+
+        assertEquals(List.of(1.0f, 7.0f), first);
+        assertEquals(List.of(3.0f, 4.0f), second);
+        expectThrows(UnsupportedOperationException.class, () -> first.add(5.0f));
+    }
+
+    public void testToFloatArray_whenCalled_thenReturnCopyOfRange() {
+        float[] data = { 1.0f, 2.0f, 3.0f, 4.0f };
+        FloatArrayList list = new FloatArrayList(data, 2, 2);
+
+        float[] copy = list.toFloatArray();
+        copy[0] = 10.0f;
+
+        assertArrayEquals(new float[] { 10.0f, 4.0f }, copy, 0.0f);
+        assertEquals(3.0f, list.getFloat(0), 0.0f);
+        assertArrayEquals(new float[] { 3.0f, 4.0f }, VectorUtil.vectorAsListToArray(list), 0.0f);
+    }
+}
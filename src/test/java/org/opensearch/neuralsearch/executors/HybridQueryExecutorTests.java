@@ -0,0 +1,143 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.executors;
+
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.doThrow;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST;
+
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+
+import org.apache.lucene.util.ThreadInterruptedException;
+import org.junit.After;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.ThreadPool;
+
+import lombok.SneakyThrows;
+
+public class HybridQueryExecutorTests extends OpenSearchTestCase {
+
+    private ExecutorService executorService;
+
+    @After
+    @SneakyThrows
+    public void shutdownExecutor() {
+        if (executorService != null) {
+            executorService.shutdown();
+            assertTrue(executorService.awaitTermination(10, TimeUnit.SECONDS));
+        }
+    }
+
+    @SneakyThrows
+    public void testInvokeAll_whenFewTasks_thenExecutedInline() {
+        ExecutorService pool = mock(ExecutorService.class);
+        initializeExecutor(pool, 3);
+        long inlineExecutionsBefore = HybridQueryExecutor.getStats().getInlineExecutions();
+
+        List<Long> threadIds = HybridQueryExecutor.invokeAll(List.of(currentThreadIdTask(), currentThreadIdTask()));
+
+        assertEquals(List.of(Thread.currentThread().getId(), Thread.currentThread().getId()), threadIds);
+        assertEquals(inlineExecutionsBefore + 1, HybridQueryExecutor.getStats().getInlineExecutions());
+        verify(pool, never()).execute(any(Runnable.class));
+    }
+
+    @SneakyThrows
+    public void testInvokeAll_whenManyTasks_thenResultsInOrderOfTasks() {
+        executorService = Executors.newFixedThreadPool(4);
+        initializeExecutor(executorService, 3);
+        List<Callable<Integer>> tasks = new ArrayList<>();
+        for (int i = 0; i < 5; i++) {
+            final int taskIndex = i;
+            tasks.add(() -> taskIndex * 10);
+        }
+
+        assertEquals(List.of(0, 10, 20, 30, 40), HybridQueryExecutor.invokeAll(tasks));
+    }
+
+    @SneakyThrows
+    public void testInvokeAll_whenPoolRejectsTasks_thenExecutedByCallingThread() {
+        ExecutorService pool = mock(ExecutorService.class);
+        doThrow(new RejectedExecutionException("queue is full")).when(pool).execute(any(Runnable.class));
+        initializeExecutor(pool, 3);
+        HybridQueryExecutorStats statsBefore = HybridQueryExecutor.getStats();
+
+        List<Long> threadIds = HybridQueryExecutor.invokeAll(
+            List.of(currentThreadIdTask(), currentThreadIdTask(), currentThreadIdTask(), currentThreadIdTask())
+        );
+
+        long callingThreadId = Thread.currentThread().getId();
+        assertEquals(List.of(callingThreadId, callingThreadId, callingThreadId, callingThreadId), threadIds);
+        HybridQueryExecutorStats statsAfter = HybridQueryExecutor.getStats();
+        // two pool threads were requested, both got rejected
+        assertEquals(statsBefore.getRejectedTasks() + 2, statsAfter.getRejectedTasks());
+        assertEquals(statsBefore.getStolenTasks() + 3, statsAfter.getStolenTasks());
+    }
+
+    public void testInvokeAll_whenTaskFails_thenExceptionRethrown() {
+        executorService = Executors.newFixedThreadPool(2);
+        initializeExecutor(executorService, 3);
+        List<Callable<Integer>> tasks = List.of(() -> 1, () -> { throw new IOException("failed to read segment"); }, () -> 3);
+
+        IOException exception = expectThrows(IOException.class, () -> HybridQueryExecutor.invokeAll(tasks));
+        assertEquals("failed to read segment", exception.getMessage());
+    }
+
+    @SneakyThrows
+    public void testInvokeAll_whenCallingThreadInterrupted_thenRunningTasksInterrupted() {
+        executorService = Executors.newFixedThreadPool(2);
+        initializeExecutor(executorService, 3);
+        Thread callingThread = Thread.currentThread();
+        CountDownLatch poolTasksStarted = new CountDownLatch(2);
+        CountDownLatch poolTasksInterrupted = new CountDownLatch(2);
+        Callable<Integer> task = () -> {
+            if (Thread.currentThread() == callingThread) {
+                // interrupt calling thread once pool threads took the other tasks, it's waiting for them next
+                poolTasksStarted.await();
+                callingThread.interrupt();
+                return 0;
+            }
+            poolTasksStarted.countDown();
+            try {
+                new CountDownLatch(1).await(10, TimeUnit.SECONDS);
+            } catch (InterruptedException e) {
+                poolTasksInterrupted.countDown();
+            }
+            return 1;
+        };
+
+        expectThrows(ThreadInterruptedException.class, () -> HybridQueryExecutor.invokeAll(List.of(task, task, task)));
+
+        // interrupt flag of calling thread is restored, checking it clears the flag for other tests
+        assertTrue(Thread.interrupted());
+        assertTrue(poolTasksInterrupted.await(10, TimeUnit.SECONDS));
+    }
+
+    private void initializeExecutor(final ExecutorService pool, final int maxParallelTasksPerRequest) {
+        ThreadPool threadPool = mock(ThreadPool.class);
+        when(threadPool.executor(eq(HybridQueryExecutor.getThreadPoolName()))).thenReturn(pool);
+        Settings settings = Settings.builder()
+            .put(HYBRID_QUERY_EXECUTOR_MAX_PARALLEL_TASKS_PER_REQUEST.getKey(), maxParallelTasksPerRequest)
+            .build();
+        HybridQueryExecutor.initialize(threadPool, settings);
+    }
+
+    private static Callable<Long> currentThreadIdTask() {
+        return () -> Thread.currentThread().getId();
+    }
+}
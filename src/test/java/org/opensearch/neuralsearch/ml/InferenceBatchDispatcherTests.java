@@ -0,0 +1,132 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.anyList;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.doAnswer;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.times;
+import static org.mockito.Mockito.verify;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.junit.Before;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.concurrency.OpenSearchRejectedExecutionException;
+import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.ThreadPool;
+
+public class InferenceBatchDispatcherTests extends OpenSearchTestCase {
+
+    private static final String MODEL_ID = "model_id";
+    private static final TimeValue BATCH_WINDOW = TimeValue.timeValueMillis(2);
+
+    private MLCommonsClientAccessor accessor;
+    private ThreadPool threadPool;
+    private List<Runnable> scheduledFlushes;
+    private List<List<String>> predictedBatches;
+    private List<ActionListener<List<List<Float>>>> predictListeners;
+
+    @Before
+    public void setup() {
+        accessor = mock(MLCommonsClientAccessor.class);
+        threadPool = mock(ThreadPool.class);
+        scheduledFlushes = new ArrayList<>();
+        predictedBatches = new ArrayList<>();
+        predictListeners = new ArrayList<>();
+        doAnswer(invocation -> {
+            scheduledFlushes.add(invocation.getArgument(0));
+            return null;
+        }).when(threadPool).schedule(any(Runnable.class), eq(BATCH_WINDOW), eq(ThreadPool.Names.GENERIC));
+        doAnswer(invocation -> {
+            predictedBatches.add(invocation.getArgument(1));
+            predictListeners.add(invocation.getArgument(2));
+            return null;
+        }).when(accessor).inferenceSentences(eq(MODEL_ID), anyList(), any());
+    }
+
+    public void testInferenceSentence_whenBatchWindowExpires_thenSendOneBatch() {
+        InferenceBatchDispatcher dispatcher = new InferenceBatchDispatcher(accessor, threadPool, BATCH_WINDOW, 10, 100);
+        List<List<Float>> results = new ArrayList<>();
+
+        dispatcher.inferenceSentence(MODEL_ID, "first", ActionListener.wrap(results::add, e -> fail(e.getMessage())));
+        dispatcher.inferenceSentence(MODEL_ID, "second", ActionListener.wrap(results::add, e -> fail(e.getMessage())));
+        assertEquals(1, scheduledFlushes.size());
+        assertTrue(predictedBatches.isEmpty());
+
+        scheduledFlushes.get(0).run();
+        assertEquals(List.of(List.of("first", "second")), predictedBatches);
+        assertEquals(2, dispatcher.queueDepth(MODEL_ID));
+
+        predictListeners.get(0).onResponse(List.of(List.of(1.0f), List.of(2.0f)));
+        assertEquals(List.of(List.of(1.0f), List.of(2.0f)), results);
+        assertEquals(0, dispatcher.queueDepth(MODEL_ID));
+    }
+
+    public void testInferenceSentence_whenBatchIsFull_thenSendWithoutWaiting() {
+        InferenceBatchDispatcher dispatcher = new InferenceBatchDispatcher(accessor, threadPool, BATCH_WINDOW, 2, 100);
+
+        dispatcher.inferenceSentence(MODEL_ID, "first", ActionListener.wrap(r -> {}, e -> fail(e.getMessage())));
+        dispatcher.inferenceSentence(MODEL_ID, "second", ActionListener.wrap(r -> {}, e -> fail(e.getMessage())));
+        dispatcher.inferenceSentence(MODEL_ID, "third", ActionListener.wrap(r -> {}, e -> fail(e.getMessage())));
+
+        assertEquals(List.of(List.of("first", "second")), predictedBatches);
+        scheduledFlushes.get(0).run();
+        assertEquals(List.of(List.of("first", "second"), List.of("third")), predictedBatches);
+        verify(accessor, times(2)).inferenceSentences(eq(MODEL_ID), anyList(), any());
+    }
+
+    public void testInferenceSentence_whenQueueDepthExceeded_thenReject() {
+        InferenceBatchDispatcher dispatcher = new InferenceBatchDispatcher(accessor, threadPool, BATCH_WINDOW, 10, 1);
+        AtomicInteger rejections = new AtomicInteger();
+
+        dispatcher.inferenceSentence(MODEL_ID, "first", ActionListener.wrap(r -> {}, e -> fail(e.getMessage())));
+        dispatcher.inferenceSentence(MODEL_ID, "second", ActionListener.wrap(r -> fail("request must be rejected"), e -> {
+            assertTrue(e instanceof OpenSearchRejectedExecutionException);
+            rejections.incrementAndGet();
+        }));
+
+        assertEquals(1, rejections.get());
+        assertEquals(1, dispatcher.queueDepth(MODEL_ID));
+        verify(accessor, never()).inferenceSentences(eq(MODEL_ID), anyList(), any());
+    }
+
+    public void testInferenceSentence_whenInferenceFails_thenFailAllListeners() {
+        InferenceBatchDispatcher dispatcher = new InferenceBatchDispatcher(accessor, threadPool, BATCH_WINDOW, 2, 100);
+        AtomicInteger failures = new AtomicInteger();
+        ActionListener<List<Float>> failureCountingListener = ActionListener.wrap(
+            r -> fail("unexpected result"),
+            e -> failures.incrementAndGet()
+        );
+
+        dispatcher.inferenceSentence(MODEL_ID, "first", failureCountingListener);
+        dispatcher.inferenceSentence(MODEL_ID, "second", failureCountingListener);
+        predictListeners.get(0).onFailure(new IllegalStateException("model is not deployed"));
+
+        assertEquals(2, failures.get());
+        assertEquals(0, dispatcher.queueDepth(MODEL_ID));
+    }
+
+    public void testInferenceSentence_whenUnexpectedNumberOfVectors_thenFail() {
+        InferenceBatchDispatcher dispatcher = new InferenceBatchDispatcher(accessor, threadPool, BATCH_WINDOW, 2, 100);
+        AtomicInteger failures = new AtomicInteger();
+        ActionListener<List<Float>> failureCountingListener = ActionListener.wrap(
+            r -> fail("unexpected result"),
+            e -> failures.incrementAndGet()
+        );
+
+        dispatcher.inferenceSentence(MODEL_ID, "first", failureCountingListener);
+        dispatcher.inferenceSentence(MODEL_ID, "second", failureCountingListener);
+        predictListeners.get(0).onResponse(List.of(List.of(1.0f)));
+
+        assertEquals(2, failures.get());
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicReference;
+
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.concurrency.OpenSearchRejectedExecutionException;
+import org.opensearch.test.OpenSearchTestCase;
+
+public class InferenceConcurrencyLimiterTests extends OpenSearchTestCase {
+
+    private static final String MODEL_ID = "model_id";
+
+    public void testExecute_whenLimitReached_thenQueueAndReject() {
+        InferenceConcurrencyLimiter limiter = new InferenceConcurrencyLimiter(2, 2, 1);
+        List<ActionListener<String>> sentCalls = new ArrayList<>();
+        List<String> results = new ArrayList<>();
+        AtomicReference<Exception> rejection = new AtomicReference<>();
+
+        for (int i = 0; i < 3; i++) {
+            limiter.execute(MODEL_ID, 1, sentCalls::add, ActionListener.wrap(results::add, e -> fail(e.getMessage())));
+        }
+        limiter.execute(MODEL_ID, 1, sentCalls::add, ActionListener.wrap(results::add, rejection::set));
+
+        assertEquals(2, sentCalls.size());
+        assertFalse(limiter.hasCapacity(MODEL_ID));
+        assertTrue(limiter.hasCapacity("other_model"));
+        assertTrue(rejection.get() instanceof OpenSearchRejectedExecutionException);
+        assertEquals(
+            "inference call to model [model_id] is rejected, in flight calls [2], limit [2], queued calls [1]",
+            rejection.get().getMessage()
+        );
+        InferenceConcurrencyLimiterStats stats = limiter.getStats().get(MODEL_ID);
+        assertEquals(2, stats.getInFlight());
+        assertEquals(1, stats.getQueueSize());
+        assertEquals(1, stats.getRejectedCalls());
+
+        // completed call frees the slot for the queued one
+        sentCalls.get(0).onResponse("first");
+        assertEquals(3, sentCalls.size());
+        assertEquals(List.of("first"), results);
+        assertEquals(0, limiter.getStats().get(MODEL_ID).getQueueSize());
+    }
+
+    public void testExecute_whenCallsCompleteFast_thenLimitGrows() {
+        AtomicLong nanoTime = new AtomicLong();
+        InferenceConcurrencyLimiter limiter = new InferenceConcurrencyLimiter(4, 6, 10, nanoTime::get);
+
+        for (int i = 0; i < 20; i++) {
+            limiter.execute(MODEL_ID, 1, listener -> {
+                nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(10));
+                listener.onResponse("result");
+            }, ActionListener.wrap(result -> {}, e -> fail(e.getMessage())));
+        }
+
+        assertEquals(4, limiter.getStats().get(MODEL_ID).getLimit());
+        assertEquals(10, limiter.getStats().get(MODEL_ID).getBaselineLatencyMillis());
+
+        // limit grows only while it's used
+        List<ActionListener<String>> sentCalls = new ArrayList<>();
+        for (int round = 0; round < 10; round++) {
+            for (int i = 0; i < 3; i++) {
+                limiter.execute(MODEL_ID, 1, sentCalls::add, ActionListener.wrap(result -> {}, e -> fail(e.getMessage())));
+            }
+            nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(10));
+            sentCalls.forEach(listener -> listener.onResponse("result"));
+            sentCalls.clear();
+        }
+        assertEquals(6, limiter.getStats().get(MODEL_ID).getLimit());
+    }
+
+    public void testExecute_whenModelOverloaded_thenLimitDecreases() {
+        AtomicLong nanoTime = new AtomicLong();
+        InferenceConcurrencyLimiter limiter = new InferenceConcurrencyLimiter(10, 10, 10, nanoTime::get);
+
+        limiter.execute(MODEL_ID, 1, listener -> {
+            nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(10));
+            listener.onFailure(new OpenSearchRejectedExecutionException("model queue is full"));
+        }, ActionListener.wrap(result -> fail("call must fail"), e -> {}));
+        assertEquals(9, limiter.getStats().get(MODEL_ID).getLimit());
+
+        limiter.execute(MODEL_ID, 1, listener -> {
+            nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(10));
+            listener.onResponse("result");
+        }, ActionListener.wrap(result -> {}, e -> fail(e.getMessage())));
+        // latency far above the baseline is a sign of overload
+        limiter.execute(MODEL_ID, 1, listener -> {
+            nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(100));
+            listener.onResponse("result");
+        }, ActionListener.wrap(result -> {}, e -> fail(e.getMessage())));
+        assertEquals(8, limiter.getStats().get(MODEL_ID).getLimit());
+
+        // failures that don't mean overload keep the limit
+        limiter.execute(MODEL_ID, 1, listener -> {
+            nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(10));
+            listener.onFailure(new IllegalArgumentException("bad input"));
+        }, ActionListener.wrap(result -> fail("call must fail"), e -> {}));
+        assertEquals(8, limiter.getStats().get(MODEL_ID).getLimit());
+        assertEquals(0, limiter.getStats().get(MODEL_ID).getInFlight());
+    }
+
+    public void testExecute_whenBatchAndSingleTextCallsMixed_thenLimitStaysStable() {
+        AtomicLong nanoTime = new AtomicLong();
+        InferenceConcurrencyLimiter limiter = new InferenceConcurrencyLimiter(8, 8, 100, nanoTime::get);
+        List<ActionListener<String>> singleTextCalls = new ArrayList<>();
+        List<ActionListener<String>> batchCalls = new ArrayList<>();
+
+        // search sends single texts while ingestion sends batches that take much longer, none of them is overloaded
+        for (int round = 0; round < 50; round++) {
+            for (int i = 0; i < 4; i++) {
+                limiter.execute(MODEL_ID, 1, singleTextCalls::add, ActionListener.wrap(result -> {}, e -> fail(e.getMessage())));
+                limiter.execute(MODEL_ID, 256, batchCalls::add, ActionListener.wrap(result -> {}, e -> fail(e.getMessage())));
+            }
+            nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(10));
+            singleTextCalls.forEach(listener -> listener.onResponse("result"));
+            singleTextCalls.clear();
+            nanoTime.addAndGet(TimeUnit.MILLISECONDS.toNanos(190));
+            batchCalls.forEach(listener -> listener.onResponse("result"));
+            batchCalls.clear();
+        }
+
+        InferenceConcurrencyLimiterStats stats = limiter.getStats().get(MODEL_ID);
+        assertEquals(8, stats.getLimit());
+        assertEquals(0, stats.getRejectedCalls());
+        assertEquals(10, stats.getBaselineLatencyMillis());
+        assertEquals(0, InferenceConcurrencyLimiter.toInputCountBucket(1));
+        assertEquals(8, InferenceConcurrencyLimiter.toInputCountBucket(256));
+        assertEquals(15, InferenceConcurrencyLimiter.toInputCountBucket(Integer.MAX_VALUE));
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicReference;
+
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.test.OpenSearchTestCase;
+
+public class InferenceResultCacheTests extends OpenSearchTestCase {
+
+    private static final String MODEL_ID = "model_id";
+    private static final List<String> RESPONSE_FILTERS = List.of("sentence_embedding");
+
+    public void testGetOrLoad_whenEntryMissing_thenLoadAndCache() {
+        InferenceResultCache<float[]> cache = createCache(new ByteSizeValue(1024 * 1024));
+        InferenceCacheKey key = InferenceCacheKey.of(MODEL_ID, "hello world", null, RESPONSE_FILTERS);
+        AtomicInteger loadCount = new AtomicInteger();
+        AtomicReference<float[]> result = new AtomicReference<>();
+
+        cache.getOrLoad(key, listener -> {
+            loadCount.incrementAndGet();
+            listener.onResponse(new float[] { 1.0f, 2.0f });
+        }, ActionListener.wrap(result::set, e -> fail(e.getMessage())));
+        assertArrayEquals(new float[] { 1.0f, 2.0f }, result.get(), 0.0f);
+
+        cache.getOrLoad(key, listener -> {
+            loadCount.incrementAndGet();
+            listener.onResponse(new float[] { 3.0f });
+        }, ActionListener.wrap(result::set, e -> fail(e.getMessage())));
+        assertArrayEquals(new float[] { 1.0f, 2.0f }, result.get(), 0.0f);
+
+        assertEquals(1, loadCount.get());
+        assertEquals(1, cache.count());
+        assertEquals(1, cache.stats().getHits());
+        assertEquals(1, cache.stats().getMisses());
+    }
+
+    public void testGetOrLoad_whenConcurrentLoadsForSameKey_thenSingleInference() {
+        InferenceResultCache<float[]> cache = createCache(new ByteSizeValue(1024 * 1024));
+        InferenceCacheKey key = InferenceCacheKey.of(MODEL_ID, "hello world", null, RESPONSE_FILTERS);
+        List<ActionListener<float[]>> pendingLoads = new ArrayList<>();
+        List<float[]> results = new ArrayList<>();
+
+        for (int i = 0; i < 3; i++) {
+            cache.getOrLoad(key, pendingLoads::add, ActionListener.wrap(results::add, e -> fail(e.getMessage())));
+        }
+        assertEquals(1, pendingLoads.size());
+        assertEquals(1, cache.inFlightLoadsCount());
+        assertTrue(results.isEmpty());
+
+        pendingLoads.get(0).onResponse(new float[] { 1.0f });
+
+        assertEquals(3, results.size());
+        results.forEach(vector -> assertArrayEquals(new float[] { 1.0f }, vector, 0.0f));
+        assertEquals(0, cache.inFlightLoadsCount());
+        assertNotNull(cache.get(key));
+    }
+
+    public void testGetOrLoad_whenLoadFails_thenNotifyAllListenersAndDoNotCache() {
+        InferenceResultCache<float[]> cache = createCache(new ByteSizeValue(1024 * 1024));
+        InferenceCacheKey key = InferenceCacheKey.of(MODEL_ID, "hello world", null, RESPONSE_FILTERS);
+        List<ActionListener<float[]>> pendingLoads = new ArrayList<>();
+        AtomicInteger failures = new AtomicInteger();
+
+        cache.getOrLoad(key, pendingLoads::add, ActionListener.wrap(r -> fail("unexpected result"), e -> failures.incrementAndGet()));
+        cache.getOrLoad(key, pendingLoads::add, ActionListener.wrap(r -> fail("unexpected result"), e -> failures.incrementAndGet()));
+        pendingLoads.get(0).onFailure(new IllegalStateException("model is not deployed"));
+
+        assertEquals(2, failures.get());
+        assertEquals(0, cache.inFlightLoadsCount());
+        assertNull(cache.get(key));
+    }
+
+    public void testGetOrLoad_whenMaxSizeExceeded_thenEvictEntries() {
+        InferenceCacheKey firstKey = InferenceCacheKey.of(MODEL_ID, "first", null, RESPONSE_FILTERS);
+        float[] vector = new float[64];
+        long entrySize = firstKey.ramBytesUsed() + RamUsageEstimator.sizeOf(vector);
+        InferenceResultCache<float[]> cache = createCache(new ByteSizeValue(entrySize + entrySize / 2));
+
+        cache.getOrLoad(firstKey, listener -> listener.onResponse(vector), ActionListener.wrap(r -> {}, e -> fail(e.getMessage())));
+        InferenceCacheKey secondKey = InferenceCacheKey.of(MODEL_ID, "other", null, RESPONSE_FILTERS);
+        cache.getOrLoad(secondKey, listener -> listener.onResponse(vector), ActionListener.wrap(r -> {}, e -> fail(e.getMessage())));
+
+        assertEquals(1, cache.count());
+        assertEquals(1, cache.stats().getEvictions());
+        assertNull(cache.get(firstKey));
+        assertNotNull(cache.get(secondKey));
+    }
+
+    public void testCacheKey_whenDifferentInputs_thenKeysNotEqual() {
+        InferenceCacheKey key = InferenceCacheKey.of(MODEL_ID, "text", "image", RESPONSE_FILTERS);
+
+        assertEquals(key, InferenceCacheKey.of(MODEL_ID, "text", "image", RESPONSE_FILTERS));
+        assertEquals(key.hashCode(), InferenceCacheKey.of(MODEL_ID, "text", "image", RESPONSE_FILTERS).hashCode());
+        assertNotEquals(key, InferenceCacheKey.of("other_model_id", "text", "image", RESPONSE_FILTERS));
+        assertNotEquals(key, InferenceCacheKey.of(MODEL_ID, "other text", "image", RESPONSE_FILTERS));
+        assertNotEquals(key, InferenceCacheKey.of(MODEL_ID, "text", "other image", RESPONSE_FILTERS));
+        assertNotEquals(key, InferenceCacheKey.of(MODEL_ID, "text", "image", List.of()));
+    }
+
+    public void testCacheKey_whenHashedText_thenKeyDoesNotKeepText() {
+        String text = "long ingested passage ".repeat(100);
+        InferenceCacheKey key = InferenceCacheKey.ofHashedText(MODEL_ID, text, RESPONSE_FILTERS);
+
+        assertEquals(key, InferenceCacheKey.ofHashedText(MODEL_ID, text, RESPONSE_FILTERS));
+        assertNotEquals(key, InferenceCacheKey.ofHashedText(MODEL_ID, "other text", RESPONSE_FILTERS));
+        assertNotEquals(key, InferenceCacheKey.of(MODEL_ID, text, null, RESPONSE_FILTERS));
+        assertTrue(key.ramBytesUsed() < RamUsageEstimator.sizeOf(text));
+    }
+
+    private InferenceResultCache<float[]> createCache(ByteSizeValue maxSize) {
+        return new InferenceResultCache<float[]>(maxSize, TimeValue.timeValueMinutes(10), RamUsageEstimator::sizeOf);
+    }
+}
@@ -13,6 +13,7 @@ import java.util.Arrays;
 import java.util.Collections;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.atomic.AtomicInteger;
 
 import org.junit.Before;
 import org.mockito.ArgumentCaptor;
@@ -21,6 +22,7 @@ import org.mockito.Mock;
 import org.mockito.Mockito;
 import org.mockito.MockitoAnnotations;
 import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.common.unit.TimeValue;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.ml.client.MachineLearningNodeClient;
 import org.opensearch.ml.common.input.MLInput;
@@ -29,8 +31,10 @@ import org.opensearch.ml.common.output.model.MLResultDataType;
 import org.opensearch.ml.common.output.model.ModelTensor;
 import org.opensearch.ml.common.output.model.ModelTensorOutput;
 import org.opensearch.ml.common.output.model.ModelTensors;
+import org.opensearch.neuralsearch.common.FloatArrayList;
 import org.opensearch.neuralsearch.constants.TestCommonConstants;
 import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.Scheduler;
 import org.opensearch.transport.NodeNotConnectedException;
 
 public class MLCommonsClientAccessorTests extends OpenSearchTestCase {
@@ -68,6 +72,22 @@ public class MLCommonsClientAccessorTests extends OpenSearchTestCase {
         Mockito.verifyNoMoreInteractions(singleSentenceResultListener);
     }
 
+    public void testInferenceSentences_whenValidInput_thenVectorsBackedByPrimitiveArray() {
+        Mockito.doAnswer(invocation -> {
+            final ActionListener<MLOutput> actionListener = invocation.getArgument(2);
+            actionListener.onResponse(createModelTensorOutput(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+            return null;
+        }).when(client).predict(Mockito.eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+
+        accessor.inferenceSentences(TestCommonConstants.MODEL_ID, TestCommonConstants.SENTENCES_LIST, resultListener);
+
+        ArgumentCaptor<List<List<Float>>> vectorsCaptor = ArgumentCaptor.forClass(List.class);
+        Mockito.verify(resultListener).onResponse(vectorsCaptor.capture());
+        assertEquals(1, vectorsCaptor.getValue().size());
+        assertTrue(vectorsCaptor.getValue().get(0) instanceof FloatArrayList);
+        assertEquals(Arrays.asList(TestCommonConstants.PREDICT_VECTOR_ARRAY), vectorsCaptor.getValue().get(0));
+    }
+
     public void testInferenceSentences_whenValidInputThenSuccess() {
         final List<List<Float>> vectorList = new ArrayList<>();
         vectorList.add(Arrays.asList(TestCommonConstants.PREDICT_VECTOR_ARRAY));
@@ -390,6 +410,101 @@ public class MLCommonsClientAccessorTests extends OpenSearchTestCase {
         Mockito.verify(singleSentenceResultListener).onFailure(nodeNodeConnectedException);
     }
 
+    public void testInferenceSentences_whenRetryableException_thenRetryAfterBackoff() {
+        final NodeNotConnectedException nodeNodeConnectedException = new NodeNotConnectedException(
+            mock(DiscoveryNode.class),
+            "Node not connected"
+        );
+        final List<Float> vector = new ArrayList<>(List.of(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+        final AtomicInteger predictCalls = new AtomicInteger();
+        Mockito.doAnswer(invocation -> {
+            final ActionListener<MLOutput> actionListener = invocation.getArgument(2);
+            if (predictCalls.incrementAndGet() == 1) {
+                actionListener.onFailure(nodeNodeConnectedException);
+            } else {
+                actionListener.onResponse(createModelTensorOutput(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+            }
+            return null;
+        }).when(client).predict(Mockito.eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+        final List<Long> delays = new ArrayList<>();
+        final List<Runnable> scheduledCommands = new ArrayList<>();
+        final MLCommonsClientAccessor backoffAccessor = new MLCommonsClientAccessor(client, null, (delay, command) -> {
+            delays.add(delay);
+            scheduledCommands.add(command);
+            return mock(Scheduler.ScheduledCancellable.class);
+        }, null);
+
+        backoffAccessor.inferenceSentences(
+            TestCommonConstants.TARGET_RESPONSE_FILTERS,
+            TestCommonConstants.MODEL_ID,
+            TestCommonConstants.SENTENCES_LIST,
+            resultListener
+        );
+
+        // retry waits for the scheduler
+        assertEquals(1, predictCalls.get());
+        assertEquals(1, delays.size());
+        assertTrue(delays.get(0) >= 0 && delays.get(0) <= 50);
+        Mockito.verifyNoInteractions(resultListener);
+
+        scheduledCommands.get(0).run();
+        assertEquals(2, predictCalls.get());
+        Mockito.verify(resultListener).onResponse(List.of(vector));
+        Mockito.verifyNoMoreInteractions(resultListener);
+    }
+
+    public void testInferenceSentences_whenHedgedCallCompletesFirst_thenUseItsResult() {
+        final List<ActionListener<MLOutput>> predictListeners = new ArrayList<>();
+        Mockito.doAnswer(invocation -> {
+            predictListeners.add(invocation.getArgument(2));
+            return null;
+        }).when(client).predict(Mockito.eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+        final List<Runnable> scheduledCommands = new ArrayList<>();
+        final Scheduler.ScheduledCancellable scheduledHedge = mock(Scheduler.ScheduledCancellable.class);
+        final MLCommonsClientAccessor hedgingAccessor = accessor.withHedging((delay, command) -> {
+            assertEquals(10L, delay.longValue());
+            scheduledCommands.add(command);
+            return scheduledHedge;
+        }, TimeValue.timeValueMillis(10));
+
+        hedgingAccessor.inferenceSentences(TestCommonConstants.MODEL_ID, TestCommonConstants.SENTENCES_LIST, resultListener);
+        assertEquals(1, predictListeners.size());
+        assertEquals(1, scheduledCommands.size());
+
+        // first call is slow, hedged call is sent and completes first
+        scheduledCommands.get(0).run();
+        assertEquals(2, predictListeners.size());
+        predictListeners.get(1).onResponse(createModelTensorOutput(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+        predictListeners.get(0).onResponse(createModelTensorOutput(new Float[] { 0.0f }));
+
+        final List<Float> vector = new ArrayList<>(List.of(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+        Mockito.verify(resultListener).onResponse(List.of(vector));
+        Mockito.verifyNoMoreInteractions(resultListener);
+        Mockito.verify(scheduledHedge).cancel();
+    }
+
+    public void testInferenceSentences_whenFirstCallCompletesBeforeHedgeDelay_thenNoHedgedCall() {
+        Mockito.doAnswer(invocation -> {
+            final ActionListener<MLOutput> actionListener = invocation.getArgument(2);
+            actionListener.onResponse(createModelTensorOutput(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+            return null;
+        }).when(client).predict(Mockito.eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+        final List<Runnable> scheduledCommands = new ArrayList<>();
+        final Scheduler.ScheduledCancellable scheduledHedge = mock(Scheduler.ScheduledCancellable.class);
+        final MLCommonsClientAccessor hedgingAccessor = accessor.withHedging((delay, command) -> {
+            scheduledCommands.add(command);
+            return scheduledHedge;
+        }, TimeValue.timeValueMillis(10));
+
+        hedgingAccessor.inferenceSentences(TestCommonConstants.MODEL_ID, TestCommonConstants.SENTENCES_LIST, resultListener);
+        Mockito.verify(scheduledHedge).cancel();
+        scheduledCommands.forEach(Runnable::run);
+
+        Mockito.verify(client, times(1))
+            .predict(Mockito.eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+        Mockito.verify(resultListener, times(1)).onResponse(Mockito.anyList());
+    }
+
     private ModelTensorOutput createModelTensorOutput(final Float[] output) {
         final List<ModelTensors> tensorsList = new ArrayList<>();
         final List<ModelTensor> mlModelTensorList = new ArrayList<>();
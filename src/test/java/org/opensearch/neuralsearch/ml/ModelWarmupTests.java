@@ -0,0 +1,174 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.anyList;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.doAnswer;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.times;
+import static org.mockito.Mockito.verify;
+
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.junit.Before;
+import org.opensearch.cluster.ClusterChangedEvent;
+import org.opensearch.cluster.ClusterName;
+import org.opensearch.cluster.ClusterState;
+import org.opensearch.cluster.metadata.Metadata;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.common.xcontent.XContentType;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.common.bytes.BytesArray;
+import org.opensearch.ingest.IngestMetadata;
+import org.opensearch.ingest.PipelineConfiguration;
+import org.opensearch.search.pipeline.SearchPipelineMetadata;
+import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.ThreadPool;
+
+public class ModelWarmupTests extends OpenSearchTestCase {
+
+    private static final String WARMUP_TEXT = "warm-up";
+    private static final TimeValue RETRY_DELAY = TimeValue.timeValueSeconds(1);
+    private static final String INGEST_PIPELINE = "{\"processors\":["
+        + "{\"text_embedding\":{\"model_id\":\"dense_model\",\"field_map\":{\"text\":\"embedding\"}}},"
+        + "{\"sparse_encoding\":{\"model_id\":\"sparse_model\",\"field_map\":{\"text\":\"sparse\"}}},"
+        + "{\"text_image_embedding\":{\"model_id\":\"multimodal_model\",\"embedding\":\"vector\",\"field_map\":{\"text\":\"text\"}}},"
+        + "{\"set\":{\"field\":\"model_id\",\"value\":\"not_a_model\"}}]}";
+    private static final String SEARCH_PIPELINE = "{\"request_processors\":["
+        + "{\"neural_query_enricher\":{\"default_model_id\":\"dense_model\",\"neural_field_default_id\":{\"sparse\":\"query_model\"}}}],"
+        + "\"response_processors\":["
+        + "{\"rerank\":{\"ml_opensearch\":{\"model_id\":\"rerank_model\"},\"context\":{\"document_fields\":[\"text\"]}}}]}";
+
+    private MLCommonsClientAccessor accessor;
+    private ThreadPool threadPool;
+    private List<Runnable> scheduledRetries;
+
+    @Before
+    public void setup() {
+        accessor = mock(MLCommonsClientAccessor.class);
+        threadPool = mock(ThreadPool.class);
+        scheduledRetries = new ArrayList<>();
+        doAnswer(invocation -> {
+            scheduledRetries.add(invocation.getArgument(0));
+            return null;
+        }).when(threadPool).schedule(any(Runnable.class), eq(RETRY_DELAY), eq(ThreadPool.Names.GENERIC));
+    }
+
+    public void testFindModels_whenIngestAndSearchPipelines_thenModelsOfNeuralProcessors() {
+        Map<String, ModelWarmup.InferenceType> models = ModelWarmup.findModels(createMetadata(INGEST_PIPELINE, SEARCH_PIPELINE));
+
+        Map<String, ModelWarmup.InferenceType> expectedModels = new LinkedHashMap<>();
+        expectedModels.put("dense_model", ModelWarmup.InferenceType.TEXT_EMBEDDING);
+        expectedModels.put("sparse_model", ModelWarmup.InferenceType.TEXT_DOCS);
+        expectedModels.put("multimodal_model", ModelWarmup.InferenceType.TEXT_IMAGE_EMBEDDING);
+        expectedModels.put("query_model", ModelWarmup.InferenceType.TEXT_DOCS);
+        expectedModels.put("rerank_model", ModelWarmup.InferenceType.TEXT_SIMILARITY);
+        assertEquals(expectedModels, models);
+        assertTrue(ModelWarmup.findModels(Metadata.EMPTY_METADATA).isEmpty());
+    }
+
+    public void testClusterChanged_whenInferencesSucceed_thenModelIsReady() {
+        doAnswer(invocation -> {
+            ActionListener<List<List<Float>>> listener = invocation.getArgument(2);
+            listener.onResponse(List.of(List.of(1.0f)));
+            return null;
+        }).when(accessor).inferenceSentences(eq("dense_model"), anyList(), any());
+        ModelWarmup modelWarmup = new ModelWarmup(accessor, threadPool, true, WARMUP_TEXT, 3, RETRY_DELAY, 2);
+        assertFalse(modelWarmup.isReady());
+
+        Metadata metadata = createMetadata("{\"processors\":[{\"text_embedding\":{\"model_id\":\"dense_model\"}}]}", null);
+        modelWarmup.clusterChanged(createEvent(metadata));
+
+        verify(accessor, times(3)).inferenceSentences(eq("dense_model"), eq(List.of(WARMUP_TEXT)), any());
+        assertTrue(modelWarmup.isReady());
+        Map<?, ?> modelState = (Map<?, ?>) ((Map<?, ?>) modelWarmup.toMap().get("models")).get("dense_model");
+        assertEquals("ready", modelState.get("status"));
+        assertEquals(3, modelState.get("successful_inferences"));
+    }
+
+    public void testClusterChanged_whenInferenceFails_thenRetryUntilMaxAttempts() {
+        doAnswer(invocation -> {
+            ActionListener<List<Float>> listener = invocation.getArgument(3);
+            listener.onFailure(new IllegalStateException("model is not deployed"));
+            return null;
+        }).when(accessor).inferenceSimilarity(eq("rerank_model"), eq(WARMUP_TEXT), anyList(), any());
+        ModelWarmup modelWarmup = new ModelWarmup(accessor, threadPool, true, WARMUP_TEXT, 1, RETRY_DELAY, 2);
+
+        modelWarmup.clusterChanged(createEvent(createMetadata(null, SEARCH_PIPELINE)));
+        assertEquals(1, scheduledRetries.size());
+        assertFalse(modelWarmup.isReady());
+
+        scheduledRetries.get(0).run();
+        verify(accessor, times(2)).inferenceSimilarity(eq("rerank_model"), eq(WARMUP_TEXT), anyList(), any());
+        assertEquals(1, scheduledRetries.size());
+        Map<?, ?> modelState = (Map<?, ?>) ((Map<?, ?>) modelWarmup.toMap().get("models")).get("rerank_model");
+        assertEquals("failed", modelState.get("status"));
+        assertEquals("model is not deployed", modelState.get("last_error"));
+        // models of the enricher don't respond, they are still being warmed up
+        assertFalse(modelWarmup.isReady());
+    }
+
+    public void testClusterChanged_whenModelRemovedFromPipelines_thenModelDoesNotBlockReadiness() {
+        ModelWarmup modelWarmup = new ModelWarmup(accessor, threadPool, true, WARMUP_TEXT, 1, RETRY_DELAY, 2);
+        Metadata metadata = createMetadata("{\"processors\":[{\"sparse_encoding\":{\"model_id\":\"sparse_model\"}}]}", null);
+        modelWarmup.clusterChanged(createEvent(metadata));
+        verify(accessor).inferenceSentencesWithMapResult(eq("sparse_model"), eq(List.of(WARMUP_TEXT)), any());
+        assertFalse(modelWarmup.isReady());
+
+        modelWarmup.clusterChanged(
+            new ClusterChangedEvent(
+                "test",
+                ClusterState.builder(ClusterName.DEFAULT).metadata(createMetadata("{\"processors\":[]}", null)).build(),
+                ClusterState.builder(ClusterName.DEFAULT).metadata(metadata).build()
+            )
+        );
+
+        assertTrue(modelWarmup.isReady());
+        assertTrue(((Map<?, ?>) modelWarmup.toMap().get("models")).isEmpty());
+    }
+
+    public void testSetEnabled_whenEnabledAfterStart_thenWarmUpModelsOfKnownPipelines() {
+        ModelWarmup modelWarmup = new ModelWarmup(accessor, threadPool, false, WARMUP_TEXT, 1, RETRY_DELAY, 2);
+        modelWarmup.clusterChanged(createEvent(createMetadata(INGEST_PIPELINE, null)));
+        verify(accessor, never()).inferenceSentences(eq("dense_model"), anyList(), any());
+        assertTrue(modelWarmup.isReady());
+
+        modelWarmup.setEnabled(true);
+
+        verify(accessor).inferenceSentences(eq("dense_model"), eq(List.of(WARMUP_TEXT)), any());
+        assertFalse(modelWarmup.isReady());
+
+        modelWarmup.setEnabled(false);
+        assertTrue(modelWarmup.isReady());
+    }
+
+    private static Metadata createMetadata(final String ingestPipeline, final String searchPipeline) {
+        Metadata.Builder builder = Metadata.builder();
+        if (ingestPipeline != null) {
+            PipelineConfiguration pipeline = new PipelineConfiguration("ingest", new BytesArray(ingestPipeline), XContentType.JSON);
+            builder.putCustom(IngestMetadata.TYPE, new IngestMetadata(Map.of(pipeline.getId(), pipeline)));
+        }
+        if (searchPipeline != null) {
+            org.opensearch.search.pipeline.PipelineConfiguration pipeline = new org.opensearch.search.pipeline.PipelineConfiguration(
+                "search",
+                new BytesArray(searchPipeline),
+                XContentType.JSON
+            );
+            builder.putCustom(SearchPipelineMetadata.TYPE, new SearchPipelineMetadata(Map.of(pipeline.getId(), pipeline)));
+        }
+        return builder.build();
+    }
+
+    private static ClusterChangedEvent createEvent(final Metadata metadata) {
+        ClusterState state = ClusterState.builder(ClusterName.DEFAULT).metadata(metadata).build();
+        return new ClusterChangedEvent("test", state, ClusterState.EMPTY_STATE);
+    }
+}
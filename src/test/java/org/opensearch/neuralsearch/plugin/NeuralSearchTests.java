@@ -11,7 +11,9 @@ import java.util.List;
 import java.util.Map;
 import java.util.Optional;
 
+import org.opensearch.action.ActionRequest;
 import org.opensearch.common.settings.Settings;
+import org.opensearch.core.action.ActionResponse;
 import org.opensearch.env.Environment;
 import org.opensearch.indices.IndicesService;
 import org.opensearch.ingest.IngestService;
@@ -24,10 +26,15 @@ import org.opensearch.neuralsearch.processor.factory.NormalizationProcessorFacto
 import org.opensearch.neuralsearch.query.HybridQueryBuilder;
 import org.opensearch.neuralsearch.query.NeuralQueryBuilder;
 import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
+import org.opensearch.neuralsearch.rest.RestModelWarmupHandler;
+import org.opensearch.neuralsearch.rest.RestNeuralStatsHandler;
 import org.opensearch.neuralsearch.search.query.HybridQueryPhaseSearcher;
+import org.opensearch.neuralsearch.transport.NeuralStatsAction;
+import org.opensearch.plugins.ActionPlugin;
 import org.opensearch.plugins.SearchPipelinePlugin;
 import org.opensearch.plugins.SearchPlugin;
 import org.opensearch.search.pipeline.SearchPhaseResultsProcessor;
+import org.opensearch.rest.RestHandler;
 import org.opensearch.search.pipeline.SearchRequestProcessor;
 import org.opensearch.search.query.QueryPhaseSearcher;
 import org.opensearch.threadpool.ExecutorBuilder;
@@ -108,6 +115,19 @@ public class NeuralSearchTests extends OpenSearchQueryTestCase {
         assertNotNull(processors.get(NeuralSparseTwoPhaseProcessor.TYPE));
     }
 
+    public void testActionsAndRestHandlers() {
+        NeuralSearch plugin = new NeuralSearch();
+
+        List<ActionPlugin.ActionHandler<? extends ActionRequest, ? extends ActionResponse>> actions = plugin.getActions();
+        List<RestHandler> restHandlers = plugin.getRestHandlers(Settings.EMPTY, null, null, null, null, null, null);
+
+        assertEquals(1, actions.size());
+        assertEquals(NeuralStatsAction.INSTANCE, actions.get(0).getAction());
+        assertEquals(2, restHandlers.size());
+        assertTrue(restHandlers.get(0) instanceof RestNeuralStatsHandler);
+        assertTrue(restHandlers.get(1) instanceof RestModelWarmupHandler);
+    }
+
     public void testExecutionBuilders() {
         NeuralSearch plugin = new NeuralSearch();
         Settings settings = Settings.builder().build();
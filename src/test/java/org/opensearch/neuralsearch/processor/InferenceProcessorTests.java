@@ -13,8 +13,13 @@ import org.opensearch.core.action.ActionListener;
 import org.opensearch.env.Environment;
 import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Collections;
 import java.util.List;
@@ -28,6 +33,7 @@ import static org.mockito.ArgumentMatchers.anyString;
 import static org.mockito.Mockito.RETURNS_DEEP_STUBS;
 import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.times;
 import static org.mockito.Mockito.verify;
 import static org.mockito.Mockito.when;
 
@@ -174,12 +180,211 @@ public class InferenceProcessorTests extends InferenceProcessorTestCase {
         verify(clientAccessor).inferenceSentences(anyString(), anyList(), any());
     }
 
+    public void test_batchExecute_whenMaxBatchSizeExceeded_thenSplitIntoSubBatches() {
+        mockSettings(Settings.builder().put("plugins.neural_search.ingest_inference_batch.max_size", 2));
+        List<List<Float>> inferenceResults = createMockVectorWithLength(2);
+        TestInferenceProcessor processor = new TestInferenceProcessor(inferenceResults, null);
+        List<IngestDocumentWrapper> wrapperList = createIngestDocumentWrappers(2);
+        wrapperList.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("aaaaa", "bbb"));
+        wrapperList.get(1).getIngestDocument().setFieldValue("key1", Arrays.asList("cc", "ddd"));
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(wrapperList, resultHandler);
+
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        ArgumentCaptor<List<String>> inferenceTextCaptor = ArgumentCaptor.forClass(List.class);
+        verify(clientAccessor, times(2)).inferenceSentences(anyString(), inferenceTextCaptor.capture(), any());
+        assertEquals(List.of(List.of("cc", "bbb"), List.of("ddd", "aaaaa")), inferenceTextCaptor.getAllValues());
+
+        List<?> doc1Embeddings = (List) (captor.getValue().get(0).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        List<?> doc2Embeddings = (List) (captor.getValue().get(1).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        // every sub-batch gets the same mocked results, sorted texts are ("cc", "bbb") and ("ddd", "aaaaa")
+        assertEquals(inferenceResults.get(1), ((Map) doc1Embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(1), ((Map) doc1Embeddings.get(1)).get("map_key"));
+        assertEquals(inferenceResults.get(0), ((Map) doc2Embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(0), ((Map) doc2Embeddings.get(1)).get("map_key"));
+    }
+
+    public void test_batchExecute_whenMaxBatchCharsExceeded_thenSplitIntoSubBatches() {
+        mockSettings(Settings.builder().put("plugins.neural_search.ingest_inference_batch.max_chars", 5));
+        TestInferenceProcessor processor = new TestInferenceProcessor(createMockVectorWithLength(4), null);
+        List<IngestDocumentWrapper> wrapperList = createIngestDocumentWrappers(2);
+        wrapperList.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("aaaaaaa", "bbb"));
+        wrapperList.get(1).getIngestDocument().setFieldValue("key1", Arrays.asList("cc", "ddd"));
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(wrapperList, resultHandler);
+
+        ArgumentCaptor<List<String>> inferenceTextCaptor = ArgumentCaptor.forClass(List.class);
+        verify(clientAccessor, times(3)).inferenceSentences(anyString(), inferenceTextCaptor.capture(), any());
+        assertEquals(List.of(List.of("cc", "bbb"), List.of("ddd"), List.of("aaaaaaa")), inferenceTextCaptor.getAllValues());
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        captor.getValue().forEach(wrapper -> assertNull(wrapper.getException()));
+    }
+
+    public void test_batchExecute_whenMaxInFlightReached_thenWaitForCompletedSubBatch() {
+        mockSettings(
+            Settings.builder()
+                .put("plugins.neural_search.ingest_inference_batch.max_size", 1)
+                .put("plugins.neural_search.ingest_inference_batch.max_in_flight", 2)
+        );
+        DeferredInferenceProcessor processor = new DeferredInferenceProcessor();
+        List<IngestDocumentWrapper> wrapperList = createIngestDocumentWrappers(2);
+        wrapperList.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("aaaaa", "bbb"));
+        wrapperList.get(1).getIngestDocument().setFieldValue("key1", Arrays.asList("cc", "ddd"));
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(wrapperList, resultHandler);
+
+        assertEquals(2, processor.pendingHandlers.size());
+        processor.pendingHandlers.get(0).accept(createMockVectorWithLength(1));
+        assertEquals(3, processor.pendingHandlers.size());
+        processor.pendingHandlers.get(1).accept(createMockVectorWithLength(1));
+        processor.pendingHandlers.get(2).accept(createMockVectorWithLength(1));
+        assertEquals(4, processor.pendingHandlers.size());
+        verify(resultHandler, never()).accept(any());
+
+        processor.pendingHandlers.get(3).accept(createMockVectorWithLength(1));
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        captor.getValue().forEach(wrapper -> assertNull(wrapper.getException()));
+    }
+
+    public void test_batchExecute_whenSubBatchFails_thenFailOnlyAffectedDocuments() {
+        mockSettings(Settings.builder().put("plugins.neural_search.ingest_inference_batch.max_size", 2));
+        DeferredInferenceProcessor processor = new DeferredInferenceProcessor();
+        List<IngestDocumentWrapper> wrapperList = createIngestDocumentWrappers(2);
+        wrapperList.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("aaaaa", "bbbb"));
+        wrapperList.get(1).getIngestDocument().setFieldValue("key1", Arrays.asList("cc", "d"));
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(wrapperList, resultHandler);
+
+        // sorted texts are ("d", "cc") and ("bbbb", "aaaaa"), so the first sub-batch has texts of the second document only
+        processor.pendingHandlers.get(0).accept(createMockVectorWithLength(2));
+        processor.pendingFailureHandlers.get(1).accept(new RuntimeException("model is not deployed"));
+
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        assertNotNull(captor.getValue().get(0).getException());
+        assertNull(captor.getValue().get(1).getException());
+    }
+
+    public void test_batchExecute_whenDuplicateTexts_thenInferenceOnceForEachUniqueText() {
+        List<List<Float>> inferenceResults = createMockVectorWithLength(2);
+        TestInferenceProcessor processor = new TestInferenceProcessor(inferenceResults, null);
+        List<IngestDocumentWrapper> wrapperList = createIngestDocumentWrappers(2);
+        wrapperList.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("same", "other"));
+        wrapperList.get(1).getIngestDocument().setFieldValue("key1", Arrays.asList("same", "same"));
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(wrapperList, resultHandler);
+
+        ArgumentCaptor<List<String>> inferenceTextCaptor = ArgumentCaptor.forClass(List.class);
+        verify(clientAccessor).inferenceSentences(anyString(), inferenceTextCaptor.capture(), any());
+        assertEquals(List.of("same", "other"), inferenceTextCaptor.getValue());
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        List<?> doc1Embeddings = (List) (captor.getValue().get(0).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        List<?> doc2Embeddings = (List) (captor.getValue().get(1).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        assertEquals(inferenceResults.get(0), ((Map) doc1Embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(1), ((Map) doc1Embeddings.get(1)).get("map_key"));
+        assertEquals(inferenceResults.get(0), ((Map) doc2Embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(0), ((Map) doc2Embeddings.get(1)).get("map_key"));
+        // documents don't share result objects
+        assertNotSame(((Map) doc2Embeddings.get(0)).get("map_key"), ((Map) doc2Embeddings.get(1)).get("map_key"));
+    }
+
+    public void test_batchExecute_whenInferenceCacheEnabled_thenSkipCachedTexts() {
+        InferenceResultCache<Object> cache = new InferenceResultCache<Object>(
+            new ByteSizeValue(1024 * 1024),
+            TimeValue.timeValueMinutes(10),
+            RamUsageEstimator::sizeOfObject
+        );
+        List<List<Float>> inferenceResults = createMockVectorWithLength(2);
+        TestInferenceProcessor processor = new TestInferenceProcessor(inferenceResults, null, cache);
+        List<IngestDocumentWrapper> firstBatch = createIngestDocumentWrappers(1);
+        firstBatch.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("value1", "value22"));
+        processor.batchExecute(firstBatch, mock(Consumer.class));
+        assertEquals(2, cache.count());
+
+        List<IngestDocumentWrapper> secondBatch = createIngestDocumentWrappers(1);
+        secondBatch.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("value22", "value3"));
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(secondBatch, resultHandler);
+
+        ArgumentCaptor<List<String>> inferenceTextCaptor = ArgumentCaptor.forClass(List.class);
+        verify(clientAccessor, times(2)).inferenceSentences(anyString(), inferenceTextCaptor.capture(), any());
+        assertEquals(List.of(List.of("value1", "value22"), List.of("value3")), inferenceTextCaptor.getAllValues());
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        List<?> embeddings = (List) (captor.getValue().get(0).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        assertEquals(inferenceResults.get(1), ((Map) embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(0), ((Map) embeddings.get(1)).get("map_key"));
+        assertEquals(1, cache.stats().getHits());
+    }
+
+    public void test_batchExecute_whenAllTextsCached_thenNoInference() {
+        InferenceResultCache<Object> cache = new InferenceResultCache<Object>(
+            new ByteSizeValue(1024 * 1024),
+            TimeValue.timeValueMinutes(10),
+            RamUsageEstimator::sizeOfObject
+        );
+        TestInferenceProcessor processor = new TestInferenceProcessor(createMockVectorWithLength(2), null, cache);
+        List<IngestDocumentWrapper> firstBatch = createIngestDocumentWrappers(1);
+        firstBatch.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("value1", "value2"));
+        processor.batchExecute(firstBatch, mock(Consumer.class));
+
+        List<IngestDocumentWrapper> secondBatch = createIngestDocumentWrappers(2);
+        secondBatch.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("value2", "value1"));
+        secondBatch.get(1).getIngestDocument().setFieldValue("key1", Arrays.asList("value1", "value1"));
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(secondBatch, resultHandler);
+
+        verify(clientAccessor).inferenceSentences(anyString(), anyList(), any());
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        captor.getValue().forEach(wrapper -> {
+            assertNull(wrapper.getException());
+            assertNotNull(wrapper.getIngestDocument().getFieldValue("embedding_key1", List.class));
+        });
+    }
+
+    private void mockSettings(Settings.Builder settingsBuilder) {
+        Settings settings = settingsBuilder.put("index.mapping.depth.limit", 20).build();
+        when(environment.settings()).thenReturn(settings);
+    }
+
+    private class DeferredInferenceProcessor extends InferenceProcessor {
+        private final List<Consumer<List<?>>> pendingHandlers = new ArrayList<>();
+        private final List<Consumer<Exception>> pendingFailureHandlers = new ArrayList<>();
+
+        public DeferredInferenceProcessor() {
+            super(TAG, DESCRIPTION, TYPE, MAP_KEY, MODEL_ID, FIELD_MAP, clientAccessor, environment, clusterService);
+        }
+
+        @Override
+        public void doExecute(
+            IngestDocument ingestDocument,
+            Map<String, Object> ProcessMap,
+            List<String> inferenceList,
+            BiConsumer<IngestDocument, Exception> handler
+        ) {}
+
+        @Override
+        void doBatchExecute(List<String> inferenceList, Consumer<List<?>> handler, Consumer<Exception> onException) {
+            pendingHandlers.add(handler);
+            pendingFailureHandlers.add(onException);
+        }
+    }
+
     private class TestInferenceProcessor extends InferenceProcessor {
         List<?> vectors;
         Exception exception;
 
         public TestInferenceProcessor(List<?> vectors, Exception exception) {
-            super(TAG, DESCRIPTION, TYPE, MAP_KEY, MODEL_ID, FIELD_MAP, clientAccessor, environment, clusterService);
+            this(vectors, exception, null);
+        }
+
+        public TestInferenceProcessor(List<?> vectors, Exception exception, InferenceResultCache<Object> inferenceResultCache) {
+            super(TAG, DESCRIPTION, TYPE, MAP_KEY, MODEL_ID, FIELD_MAP, clientAccessor, environment, clusterService, inferenceResultCache);
             this.vectors = vectors;
             this.exception = exception;
         }
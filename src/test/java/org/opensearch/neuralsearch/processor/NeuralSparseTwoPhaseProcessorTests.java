@@ -9,6 +9,7 @@ import org.opensearch.action.search.SearchRequest;
 import org.opensearch.common.collect.Tuple;
 import org.opensearch.index.query.BoolQueryBuilder;
 import org.opensearch.index.query.MatchAllQueryBuilder;
+import org.opensearch.neuralsearch.query.HybridQueryBuilder;
 import org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder;
 import org.opensearch.search.builder.SearchSourceBuilder;
 import org.opensearch.search.rescore.QueryRescorerBuilder;
@@ -88,6 +89,79 @@ public class NeuralSparseTwoPhaseProcessorTests extends OpenSearchTestCase {
         assertNotNull(searchRequest.source().rescores());
     }
 
+    public void testProcessRequest_whenTwoPhaseEnabledAndHybridQuery_thenTwoPhaseWithinQuery() throws Exception {
+        NeuralSparseTwoPhaseProcessor.Factory factory = new NeuralSparseTwoPhaseProcessor.Factory();
+        NeuralSparseQueryBuilder neuralQueryBuilder = new NeuralSparseQueryBuilder();
+        HybridQueryBuilder hybridQueryBuilder = new HybridQueryBuilder();
+        hybridQueryBuilder.add(new MatchAllQueryBuilder());
+        hybridQueryBuilder.add(neuralQueryBuilder);
+        SearchRequest searchRequest = new SearchRequest();
+        searchRequest.source(new SearchSourceBuilder().query(hybridQueryBuilder));
+        NeuralSparseTwoPhaseProcessor processor = createTestProcessor(factory, 0.5f, true, 4.0f, 10000);
+        processor.processRequest(searchRequest);
+        assertEquals(neuralQueryBuilder.twoPhasePruneRatio(), 0f, 1e-3);
+        assertEquals(neuralQueryBuilder.inlineTwoPhasePruneRatio(), 0.5f, 1e-3);
+        assertNull(searchRequest.source().rescores());
+    }
+
+    public void testProcessRequest_whenTwoPhaseEnabledAndBooleanMust_thenTwoPhaseWithinQuery() throws Exception {
+        NeuralSparseTwoPhaseProcessor.Factory factory = new NeuralSparseTwoPhaseProcessor.Factory();
+        NeuralSparseQueryBuilder mustQueryBuilder = new NeuralSparseQueryBuilder();
+        NeuralSparseQueryBuilder shouldQueryBuilder = new NeuralSparseQueryBuilder();
+        BoolQueryBuilder boolQueryBuilder = new BoolQueryBuilder();
+        boolQueryBuilder.must(mustQueryBuilder);
+        boolQueryBuilder.should(shouldQueryBuilder);
+        SearchRequest searchRequest = new SearchRequest();
+        searchRequest.source(new SearchSourceBuilder().query(boolQueryBuilder));
+        NeuralSparseTwoPhaseProcessor processor = createTestProcessor(factory, 0.5f, true, 4.0f, 10000);
+        processor.processRequest(searchRequest);
+        assertEquals(mustQueryBuilder.twoPhasePruneRatio(), 0f, 1e-3);
+        assertEquals(mustQueryBuilder.inlineTwoPhasePruneRatio(), 0.5f, 1e-3);
+        assertEquals(shouldQueryBuilder.twoPhasePruneRatio(), 0.5f, 1e-3);
+        assertEquals(shouldQueryBuilder.inlineTwoPhasePruneRatio(), 0f, 1e-3);
+        assertNotNull(searchRequest.source().rescores());
+    }
+
+    public void testProcessRequest_whenTwoPhaseEnabledAndBooleanFilterAndMustNot_thenNoTwoPhase() throws Exception {
+        NeuralSparseTwoPhaseProcessor.Factory factory = new NeuralSparseTwoPhaseProcessor.Factory();
+        NeuralSparseQueryBuilder mustQueryBuilder = new NeuralSparseQueryBuilder();
+        NeuralSparseQueryBuilder filterQueryBuilder = new NeuralSparseQueryBuilder();
+        NeuralSparseQueryBuilder mustNotQueryBuilder = new NeuralSparseQueryBuilder();
+        NeuralSparseQueryBuilder nestedFilterQueryBuilder = new NeuralSparseQueryBuilder();
+        BoolQueryBuilder boolQueryBuilder = new BoolQueryBuilder();
+        boolQueryBuilder.must(mustQueryBuilder);
+        boolQueryBuilder.filter(filterQueryBuilder);
+        boolQueryBuilder.mustNot(mustNotQueryBuilder);
+        boolQueryBuilder.filter(new BoolQueryBuilder().must(nestedFilterQueryBuilder));
+        SearchRequest searchRequest = new SearchRequest();
+        searchRequest.source(new SearchSourceBuilder().query(boolQueryBuilder));
+        NeuralSparseTwoPhaseProcessor processor = createTestProcessor(factory, 0.5f, true, 4.0f, 10000);
+        processor.processRequest(searchRequest);
+        assertEquals(mustQueryBuilder.inlineTwoPhasePruneRatio(), 0.5f, 1e-3);
+        // splitting tokens of filter and must_not clauses would change which docs match
+        assertEquals(filterQueryBuilder.inlineTwoPhasePruneRatio(), 0f, 1e-3);
+        assertEquals(mustNotQueryBuilder.inlineTwoPhasePruneRatio(), 0f, 1e-3);
+        assertEquals(nestedFilterQueryBuilder.inlineTwoPhasePruneRatio(), 0f, 1e-3);
+        assertEquals(filterQueryBuilder.twoPhasePruneRatio(), 0f, 1e-3);
+        assertEquals(mustNotQueryBuilder.twoPhasePruneRatio(), 0f, 1e-3);
+        assertNull(searchRequest.source().rescores());
+    }
+
+    public void testProcessRequest_whenTwoPhaseEnabledAndMustNotInHybridSubQuery_thenNoTwoPhase() throws Exception {
+        NeuralSparseTwoPhaseProcessor.Factory factory = new NeuralSparseTwoPhaseProcessor.Factory();
+        NeuralSparseQueryBuilder subQueryBuilder = new NeuralSparseQueryBuilder();
+        NeuralSparseQueryBuilder mustNotQueryBuilder = new NeuralSparseQueryBuilder();
+        HybridQueryBuilder hybridQueryBuilder = new HybridQueryBuilder();
+        hybridQueryBuilder.add(subQueryBuilder);
+        hybridQueryBuilder.add(new BoolQueryBuilder().must(new MatchAllQueryBuilder()).mustNot(mustNotQueryBuilder));
+        SearchRequest searchRequest = new SearchRequest();
+        searchRequest.source(new SearchSourceBuilder().query(hybridQueryBuilder));
+        NeuralSparseTwoPhaseProcessor processor = createTestProcessor(factory, 0.5f, true, 4.0f, 10000);
+        processor.processRequest(searchRequest);
+        assertEquals(subQueryBuilder.inlineTwoPhasePruneRatio(), 0.5f, 1e-3);
+        assertEquals(mustNotQueryBuilder.inlineTwoPhasePruneRatio(), 0f, 1e-3);
+    }
+
     public void testProcessRequestWithRescorer_whenTwoPhaseEnabled_thenSuccess() throws Exception {
         NeuralSparseTwoPhaseProcessor.Factory factory = new NeuralSparseTwoPhaseProcessor.Factory();
         NeuralSparseQueryBuilder neuralQueryBuilder = new NeuralSparseQueryBuilder();
@@ -4,8 +4,11 @@
  */
 package org.opensearch.neuralsearch.processor;
 
+import static org.mockito.ArgumentMatchers.any;
 import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
 import static org.mockito.Mockito.spy;
+import static org.mockito.Mockito.verify;
 import static org.mockito.Mockito.when;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createDelimiterElementForHybridSearchResults;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createStartStopElementForHybridSearchResults;
@@ -22,6 +25,7 @@ import org.opensearch.action.OriginalIndices;
 import org.opensearch.common.lucene.search.TopDocsAndMaxScore;
 import org.opensearch.core.index.shard.ShardId;
 import org.opensearch.neuralsearch.util.TestUtils;
+import org.opensearch.neuralsearch.processor.combination.RRFScoreCombinationTechnique;
 import org.opensearch.neuralsearch.processor.combination.ScoreCombinationFactory;
 import org.opensearch.neuralsearch.processor.combination.ScoreCombiner;
 import org.opensearch.neuralsearch.processor.normalization.ScoreNormalizationFactory;
@@ -37,6 +41,8 @@ import org.opensearch.test.OpenSearchTestCase;
 
 public class NormalizationProcessorWorkflowTests extends OpenSearchTestCase {
 
+    private static final float DELTA_FOR_RANK_SCORE_ASSERTION = 0.000001f;
+
     public void testSearchResultTypes_whenResultsOfHybridSearch_thenDoNormalizationCombination() {
         NormalizationProcessorWorkflow normalizationProcessorWorkflow = spy(
             new NormalizationProcessorWorkflow(new ScoreNormalizer(), new ScoreCombiner())
@@ -83,6 +89,55 @@ public class NormalizationProcessorWorkflowTests extends OpenSearchTestCase {
         TestUtils.assertQueryResultScores(querySearchResults);
     }
 
+    public void testSearchResultTypes_whenRRFCombination_thenSkipNormalizationAndCombineRanks() {
+        ScoreNormalizer scoreNormalizer = mock(ScoreNormalizer.class);
+        NormalizationProcessorWorkflow normalizationProcessorWorkflow = new NormalizationProcessorWorkflow(
+            scoreNormalizer,
+            new ScoreCombiner()
+        );
+
+        SearchShardTarget searchShardTarget = new SearchShardTarget("node", new ShardId("index", "uuid", 0), null, OriginalIndices.NONE);
+        QuerySearchResult querySearchResult = new QuerySearchResult();
+        querySearchResult.topDocs(
+            new TopDocsAndMaxScore(
+                new TopDocs(
+                    new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                    new ScoreDoc[] {
+                        createStartStopElementForHybridSearchResults(0),
+                        createDelimiterElementForHybridSearchResults(0),
+                        new ScoreDoc(0, 12.5f),
+                        new ScoreDoc(2, 3.0f),
+                        createDelimiterElementForHybridSearchResults(0),
+                        new ScoreDoc(4, 0.9f),
+                        new ScoreDoc(2, 0.3f),
+                        createStartStopElementForHybridSearchResults(0) }
+                ),
+                12.5f
+            ),
+            new DocValueFormat[0]
+        );
+        querySearchResult.setSearchShardTarget(searchShardTarget);
+        querySearchResult.setShardIndex(0);
+        List<QuerySearchResult> querySearchResults = List.of(querySearchResult);
+
+        normalizationProcessorWorkflow.execute(
+            querySearchResults,
+            Optional.empty(),
+            ScoreNormalizationFactory.DEFAULT_METHOD,
+            new ScoreCombinationFactory().createCombination(RRFScoreCombinationTechnique.TECHNIQUE_NAME)
+        );
+
+        verify(scoreNormalizer, never()).normalizeScores(any(), any());
+        ScoreDoc[] scoreDocs = querySearchResult.topDocs().topDocs.scoreDocs;
+        assertEquals(3, scoreDocs.length);
+        assertEquals(2, scoreDocs[0].doc);
+        assertEquals(1.0f / 62 + 1.0f / 62, scoreDocs[0].score, DELTA_FOR_RANK_SCORE_ASSERTION);
+        assertEquals(0, scoreDocs[1].doc);
+        assertEquals(1.0f / 61, scoreDocs[1].score, DELTA_FOR_RANK_SCORE_ASSERTION);
+        assertEquals(4, scoreDocs[2].doc);
+        assertEquals(1.0f / 61, scoreDocs[2].score, DELTA_FOR_RANK_SCORE_ASSERTION);
+    }
+
     public void testSearchResultTypes_whenNoMatches_thenReturnZeroResults() {
         NormalizationProcessorWorkflow normalizationProcessorWorkflow = spy(
             new NormalizationProcessorWorkflow(new ScoreNormalizer(), new ScoreCombiner())
@@ -245,6 +300,76 @@ public class NormalizationProcessorWorkflowTests extends OpenSearchTestCase {
         TestUtils.assertFetchResultScores(fetchSearchResult, 4);
     }
 
+    public void testFetchResults_whenDocumentMatchesSeveralSubQueries_thenOneHitPerDocumentInCombinedOrder() {
+        NormalizationProcessorWorkflow normalizationProcessorWorkflow = new NormalizationProcessorWorkflow(
+            new ScoreNormalizer(),
+            new ScoreCombiner()
+        );
+
+        List<QuerySearchResult> querySearchResults = new ArrayList<>();
+        FetchSearchResult fetchSearchResult = new FetchSearchResult();
+        int shardId = 0;
+        SearchShardTarget searchShardTarget = new SearchShardTarget(
+            "node",
+            new ShardId("index", "uuid", shardId),
+            null,
+            OriginalIndices.NONE
+        );
+        QuerySearchResult querySearchResult = new QuerySearchResult();
+        querySearchResult.topDocs(
+            new TopDocsAndMaxScore(
+                new TopDocs(
+                    new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                    new ScoreDoc[] {
+                        createStartStopElementForHybridSearchResults(7),
+                        createDelimiterElementForHybridSearchResults(7),
+                        new ScoreDoc(7, 0.9f),
+                        new ScoreDoc(3, 0.5f),
+                        new ScoreDoc(5, 0.1f),
+                        createDelimiterElementForHybridSearchResults(7),
+                        new ScoreDoc(3, 0.8f),
+                        new ScoreDoc(5, 0.2f),
+                        createStartStopElementForHybridSearchResults(7) }
+                ),
+                0.9f
+            ),
+            new DocValueFormat[0]
+        );
+        querySearchResult.setSearchShardTarget(searchShardTarget);
+        querySearchResult.setShardIndex(shardId);
+        ShardSearchRequest shardSearchRequest = mock(ShardSearchRequest.class);
+        when(shardSearchRequest.requestCache()).thenReturn(Boolean.FALSE);
+        querySearchResult.setShardSearchRequest(shardSearchRequest);
+        querySearchResults.add(querySearchResult);
+        SearchHit[] searchHitArray = new SearchHit[] {
+            new SearchHit(7, "7", Map.of(), Map.of()),
+            new SearchHit(7, "7", Map.of(), Map.of()),
+            new SearchHit(7, "7", Map.of(), Map.of()),
+            new SearchHit(3, "3", Map.of(), Map.of()),
+            new SearchHit(5, "5", Map.of(), Map.of()),
+            new SearchHit(7, "7", Map.of(), Map.of()),
+            new SearchHit(3, "3", Map.of(), Map.of()),
+            new SearchHit(5, "5", Map.of(), Map.of()),
+            new SearchHit(7, "7", Map.of(), Map.of()) };
+        fetchSearchResult.hits(new SearchHits(searchHitArray, new TotalHits(9, TotalHits.Relation.EQUAL_TO), 0.9f));
+
+        normalizationProcessorWorkflow.execute(
+            querySearchResults,
+            Optional.of(fetchSearchResult),
+            ScoreNormalizationFactory.DEFAULT_METHOD,
+            ScoreCombinationFactory.DEFAULT_METHOD
+        );
+
+        ScoreDoc[] scoreDocs = querySearchResults.get(0).topDocs().topDocs.scoreDocs;
+        SearchHit[] hits = fetchSearchResult.hits().getHits();
+        assertEquals(3, hits.length);
+        assertEquals("3", hits[0].getId());
+        for (int i = 0; i < hits.length; i++) {
+            assertEquals(String.valueOf(scoreDocs[i].doc), hits[i].getId());
+            assertEquals(scoreDocs[i].score, hits[i].getScore(), DELTA_FOR_RANK_SCORE_ASSERTION);
+        }
+    }
+
     public void testFetchResultsAndNoCache_whenOneShardAndMultipleNodesAndMismatchResults_thenFail() {
         NormalizationProcessorWorkflow normalizationProcessorWorkflow = spy(
             new NormalizationProcessorWorkflow(new ScoreNormalizer(), new ScoreCombiner())
@@ -7,16 +7,21 @@ package org.opensearch.neuralsearch.processor;
 import static org.opensearch.neuralsearch.util.TestUtils.DELTA_FOR_SCORE_ASSERTION;
 
 import java.util.List;
+import java.util.stream.Collectors;
 
 import org.apache.lucene.search.ScoreDoc;
 import org.apache.lucene.search.TopDocs;
 import org.apache.lucene.search.TotalHits;
+import org.opensearch.neuralsearch.processor.combination.RRFScoreCombinationTechnique;
 import org.opensearch.neuralsearch.processor.combination.ScoreCombinationFactory;
+import org.opensearch.neuralsearch.processor.combination.ScoreCombinationTechnique;
 import org.opensearch.neuralsearch.processor.combination.ScoreCombiner;
 import org.opensearch.test.OpenSearchTestCase;
 
 public class ScoreCombinationTechniqueTests extends OpenSearchTestCase {
 
+    private static final float DELTA_FOR_RANK_SCORE_ASSERTION = 0.000001f;
+
     public void testEmptyResults_whenEmptyResultsAndDefaultMethod_thenNoProcessing() {
         ScoreCombiner scoreCombiner = new ScoreCombiner();
         scoreCombiner.combineScores(List.of(), ScoreCombinationFactory.DEFAULT_METHOD);
@@ -83,4 +88,134 @@ public class ScoreCombinationTechniqueTests extends OpenSearchTestCase {
 
         assertEquals(0, queryTopDocs.get(2).getScoreDocs().size());
     }
+
+    public void testCombination_whenMoreDocsThanMaxHitsAndEqualScores_thenTopDocsOrderedByScoreAndDocId() {
+        ScoreCombiner scoreCombiner = new ScoreCombiner();
+
+        final List<CompoundTopDocs> queryTopDocs = List.of(
+            new CompoundTopDocs(
+                new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                List.of(
+                    new TopDocs(
+                        new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(33, 0.8f), new ScoreDoc(1000, 0.6f), new ScoreDoc(17, 0.6f) }
+                    ),
+                    new TopDocs(
+                        new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(5, 1.0f), new ScoreDoc(1_000_000, 0.8f), new ScoreDoc(17, 0.2f) }
+                    )
+                )
+            )
+        );
+
+        scoreCombiner.combineScores(queryTopDocs, ScoreCombinationFactory.DEFAULT_METHOD);
+
+        List<ScoreDoc> scoreDocs = queryTopDocs.get(0).getScoreDocs();
+        assertEquals(3, scoreDocs.size());
+        assertEquals(5, scoreDocs.get(0).doc);
+        assertEquals(0.5, scoreDocs.get(0).score, DELTA_FOR_SCORE_ASSERTION);
+        assertEquals(17, scoreDocs.get(1).doc);
+        assertEquals(0.4, scoreDocs.get(1).score, DELTA_FOR_SCORE_ASSERTION);
+        assertEquals(33, scoreDocs.get(2).doc);
+        assertEquals(0.4, scoreDocs.get(2).score, DELTA_FOR_SCORE_ASSERTION);
+        assertEquals(new TotalHits(3, TotalHits.Relation.EQUAL_TO), queryTopDocs.get(0).getTotalHits());
+    }
+
+    public void testCombination_whenRRFMethod_thenDocumentsCombinedByRanks() {
+        ScoreCombiner scoreCombiner = new ScoreCombiner();
+
+        final List<CompoundTopDocs> queryTopDocs = List.of(
+            new CompoundTopDocs(
+                new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                List.of(
+                    new TopDocs(
+                        new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(1, 25.0f), new ScoreDoc(2, 3.5f) }
+                    ),
+                    new TopDocs(
+                        new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(2, 0.9f), new ScoreDoc(3, 0.8f) }
+                    )
+                )
+            )
+        );
+
+        ScoreCombinationTechnique rrf = new ScoreCombinationFactory().createCombination(RRFScoreCombinationTechnique.TECHNIQUE_NAME);
+        scoreCombiner.combineScores(queryTopDocs, rrf);
+
+        List<ScoreDoc> scoreDocs = queryTopDocs.get(0).getScoreDocs();
+        assertEquals(3, scoreDocs.size());
+        assertEquals(2, scoreDocs.get(0).doc);
+        assertEquals(1.0f / 62 + 1.0f / 61, scoreDocs.get(0).score, DELTA_FOR_RANK_SCORE_ASSERTION);
+        assertEquals(1, scoreDocs.get(1).doc);
+        assertEquals(1.0f / 61, scoreDocs.get(1).score, DELTA_FOR_RANK_SCORE_ASSERTION);
+        assertEquals(3, scoreDocs.get(2).doc);
+        assertEquals(1.0f / 62, scoreDocs.get(2).score, DELTA_FOR_RANK_SCORE_ASSERTION);
+    }
+
+    public void testCombination_whenRRFMethodAndMultipleShards_thenRanksAcrossShards() {
+        ScoreCombiner scoreCombiner = new ScoreCombiner();
+
+        final List<CompoundTopDocs> queryTopDocs = List.of(
+            new CompoundTopDocs(
+                new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                List.of(
+                    new TopDocs(
+                        new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(1, 25.0f), new ScoreDoc(2, 3.5f) }
+                    ),
+                    new TopDocs(new TotalHits(1, TotalHits.Relation.EQUAL_TO), new ScoreDoc[] { new ScoreDoc(2, 0.5f) })
+                )
+            ),
+            new CompoundTopDocs(
+                new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                List.of(
+                    new TopDocs(new TotalHits(1, TotalHits.Relation.EQUAL_TO), new ScoreDoc[] { new ScoreDoc(7, 10.0f) }),
+                    new TopDocs(
+                        new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(8, 0.9f), new ScoreDoc(7, 0.2f) }
+                    )
+                )
+            )
+        );
+
+        ScoreCombinationTechnique rrf = new ScoreCombinationFactory().createCombination(RRFScoreCombinationTechnique.TECHNIQUE_NAME);
+        scoreCombiner.combineScores(queryTopDocs, rrf);
+
+        // first sub-query is ranked 25.0, 10.0, 3.5 and second 0.9, 0.5, 0.2 across both shards
+        List<ScoreDoc> firstShardScoreDocs = queryTopDocs.get(0).getScoreDocs();
+        assertEquals(2, firstShardScoreDocs.size());
+        assertEquals(2, firstShardScoreDocs.get(0).doc);
+        assertEquals(1.0f / 63 + 1.0f / 62, firstShardScoreDocs.get(0).score, DELTA_FOR_RANK_SCORE_ASSERTION);
+        assertEquals(1, firstShardScoreDocs.get(1).doc);
+        assertEquals(1.0f / 61, firstShardScoreDocs.get(1).score, DELTA_FOR_RANK_SCORE_ASSERTION);
+        List<ScoreDoc> secondShardScoreDocs = queryTopDocs.get(1).getScoreDocs();
+        assertEquals(2, secondShardScoreDocs.size());
+        assertEquals(7, secondShardScoreDocs.get(0).doc);
+        assertEquals(1.0f / 62 + 1.0f / 63, secondShardScoreDocs.get(0).score, DELTA_FOR_RANK_SCORE_ASSERTION);
+        assertEquals(8, secondShardScoreDocs.get(1).doc);
+        assertEquals(1.0f / 61, secondShardScoreDocs.get(1).score, DELTA_FOR_RANK_SCORE_ASSERTION);
+    }
+
+    public void testCombination_whenEqualScores_thenOrderedByAscendingDocId() {
+        ScoreCombiner scoreCombiner = new ScoreCombiner();
+
+        final List<CompoundTopDocs> queryTopDocs = List.of(
+            new CompoundTopDocs(
+                new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                List.of(
+                    new TopDocs(
+                        new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(1, 0.6f), new ScoreDoc(17, 0.6f), new ScoreDoc(16, 0.6f) }
+                    )
+                )
+            )
+        );
+
+        scoreCombiner.combineScores(queryTopDocs, ScoreCombinationFactory.DEFAULT_METHOD);
+
+        // order of equal scores doesn't depend on the order of sub-query results
+        List<ScoreDoc> scoreDocs = queryTopDocs.get(0).getScoreDocs();
+        assertEquals(List.of(1, 16, 17), scoreDocs.stream().map(scoreDoc -> scoreDoc.doc).collect(Collectors.toList()));
+    }
 }
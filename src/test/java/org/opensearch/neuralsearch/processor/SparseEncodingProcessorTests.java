@@ -33,6 +33,7 @@ import org.mockito.ArgumentCaptor;
 import org.mockito.InjectMocks;
 import org.mockito.Mock;
 import org.mockito.MockitoAnnotations;
+import org.opensearch.OpenSearchParseException;
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.common.settings.Settings;
 import org.opensearch.core.action.ActionListener;
@@ -239,6 +240,48 @@ public class SparseEncodingProcessorTests extends InferenceProcessorTestCase {
         }
     }
 
+    @SneakyThrows
+    public void testExecute_whenPruneTypeAndQuantizationStepConfigured_thenTokensPrunedAndWeightsQuantized() {
+        Map<String, Object> config = new HashMap<>();
+        config.put(SparseEncodingProcessor.MODEL_ID_FIELD, "mockModelId");
+        config.put(SparseEncodingProcessor.FIELD_MAP_FIELD, ImmutableMap.of("key1", "key1Mapped"));
+        config.put(SparseEncodingProcessor.PRUNE_TYPE_FIELD, "top_k");
+        config.put(SparseEncodingProcessor.PRUNE_RATIO_FIELD, 2);
+        config.put(SparseEncodingProcessor.QUANTIZATION_STEP_FIELD, 0.5f);
+        SparseEncodingProcessor processor = sparseEncodingProcessorFactory.create(new HashMap<>(), PROCESSOR_TAG, DESCRIPTION, config);
+        Map<String, Object> sourceAndMetadata = new HashMap<>();
+        sourceAndMetadata.put(IndexFieldMapper.NAME, "my_index");
+        sourceAndMetadata.put("key1", "value1");
+        IngestDocument ingestDocument = new IngestDocument(sourceAndMetadata, new HashMap<>());
+
+        List<Map<String, Float>> sparseEncodingResult = List.of(Map.of("hello", 1.2f, "world", 0.6f, "planet", 0.1f));
+        doAnswer(invocation -> {
+            ActionListener<List<Map<String, ?>>> listener = invocation.getArgument(2);
+            listener.onResponse(Collections.singletonList(Map.of("response", sparseEncodingResult)));
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSentencesWithMapResult(anyString(), anyList(), isA(ActionListener.class));
+
+        BiConsumer handler = mock(BiConsumer.class);
+        processor.execute(ingestDocument, handler);
+
+        verify(handler).accept(any(IngestDocument.class), isNull());
+        // "planet" is pruned as third token, "world" weight is quantized to 0.5
+        assertEquals(Map.of("hello", 1.0f, "world", 0.5f), ingestDocument.getSourceAndMetadata().get("key1Mapped"));
+        assertEquals(1.0 / 3, processor.getPruningRatio(), 0.001);
+    }
+
+    public void testCreate_whenPruneTypeWithoutPruneRatio_thenFail() {
+        Map<String, Object> config = new HashMap<>();
+        config.put(SparseEncodingProcessor.MODEL_ID_FIELD, "mockModelId");
+        config.put(SparseEncodingProcessor.FIELD_MAP_FIELD, ImmutableMap.of("key1", "key1Mapped"));
+        config.put(SparseEncodingProcessor.PRUNE_TYPE_FIELD, "max_ratio");
+
+        expectThrows(
+            OpenSearchParseException.class,
+            () -> sparseEncodingProcessorFactory.create(new HashMap<>(), PROCESSOR_TAG, DESCRIPTION, config)
+        );
+    }
+
     private List<Map<String, ?>> createMockMapResult(int number) {
         List<Map<String, Float>> mockSparseEncodingResult = new ArrayList<>();
         IntStream.range(0, number).forEachOrdered(x -> mockSparseEncodingResult.add(ImmutableMap.of("hello", 1.0f)));
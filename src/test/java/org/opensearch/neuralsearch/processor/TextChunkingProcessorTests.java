@@ -33,6 +33,7 @@ import org.opensearch.index.analysis.TokenizerFactory;
 import org.opensearch.index.mapper.IndexFieldMapper;
 import org.opensearch.indices.analysis.AnalysisModule;
 import org.opensearch.ingest.IngestDocument;
+import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.ingest.Processor;
 import org.opensearch.neuralsearch.processor.chunker.DelimiterChunker;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
@@ -945,4 +946,19 @@ public class TextChunkingProcessorTests extends OpenSearchTestCase {
         expectedPassages.add(" The document contains a single paragraph, two sentences and 24 tokens by standard tokenizer in OpenSearch.");
         assertEquals(expectedPassages, passages);
     }
+
+    @SneakyThrows
+    public void testExecute_withDelimiter_thenChunksAreStringsAndDocumentCanBeCopied() {
+        TextChunkingProcessor processor = createDelimiterInstance();
+        IngestDocument ingestDocument = createIngestDocumentWithSourceData(createSourceDataString());
+        IngestDocument document = processor.execute(ingestDocument);
+        List<?> passages = (List<?>) document.getSourceAndMetadata().get(OUTPUT_FIELD);
+        assertEquals(2, passages.size());
+        for (Object passage : passages) {
+            assertTrue(passage instanceof String);
+        }
+        // simulate API with verbose flag copies the document after every processor
+        IngestDocument copiedDocument = new IngestDocument(document);
+        assertEquals(passages, copiedDocument.getSourceAndMetadata().get(OUTPUT_FIELD));
+    }
 }
@@ -12,6 +12,7 @@ import static org.mockito.Mockito.doThrow;
 import static org.mockito.Mockito.isA;
 import static org.mockito.Mockito.isNull;
 import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.times;
 import static org.mockito.Mockito.verify;
 import static org.mockito.Mockito.when;
 import static org.opensearch.neuralsearch.processor.TextImageEmbeddingProcessor.IMAGE_FIELD_NAME;
@@ -22,6 +23,7 @@ import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.function.BiConsumer;
+import java.util.function.Consumer;
 import java.util.function.Supplier;
 
 import org.junit.Before;
@@ -38,6 +40,7 @@ import org.opensearch.core.action.ActionListener;
 import org.opensearch.env.Environment;
 import org.opensearch.index.mapper.IndexFieldMapper;
 import org.opensearch.ingest.IngestDocument;
+import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.ingest.Processor;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.factory.TextImageEmbeddingProcessorFactory;
@@ -341,6 +344,69 @@ public class TextImageEmbeddingProcessorTests extends OpenSearchTestCase {
         verify(handler).accept(any(IngestDocument.class), isNull());
     }
 
+    public void testBatchExecute_whenSameTextAndImage_thenOneInferencePerPair() {
+        TextImageEmbeddingProcessor processor = createInstance();
+        List<IngestDocumentWrapper> ingestDocumentWrappers = List.of(
+            createIngestDocumentWrapper(0, "value1", "image1"),
+            createIngestDocumentWrapper(1, "value2", "image2"),
+            createIngestDocumentWrapper(2, "value1", "image1")
+        );
+        List<Float> vector = List.of(1.234f, 2.354f);
+        doAnswer(invocation -> {
+            ActionListener<List<Float>> listener = invocation.getArgument(2);
+            listener.onResponse(vector);
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSentences(anyString(), anyMap(), isA(ActionListener.class));
+
+        Consumer handler = mock(Consumer.class);
+        processor.batchExecute(ingestDocumentWrappers, handler);
+
+        verify(handler).accept(ingestDocumentWrappers);
+        verify(mlCommonsClientAccessor, times(2)).inferenceSentences(anyString(), anyMap(), isA(ActionListener.class));
+        for (IngestDocumentWrapper ingestDocumentWrapper : ingestDocumentWrappers) {
+            assertNull(ingestDocumentWrapper.getException());
+            assertEquals(vector, ingestDocumentWrapper.getIngestDocument().getSourceAndMetadata().get("my_embedding_field"));
+        }
+        assertNotSame(
+            ingestDocumentWrappers.get(0).getIngestDocument().getSourceAndMetadata().get("my_embedding_field"),
+            ingestDocumentWrappers.get(2).getIngestDocument().getSourceAndMetadata().get("my_embedding_field")
+        );
+    }
+
+    public void testBatchExecute_whenInferenceFails_thenDocumentsOfFailedInferenceHaveException() {
+        TextImageEmbeddingProcessor processor = createInstance();
+        List<IngestDocumentWrapper> ingestDocumentWrappers = List.of(
+            createIngestDocumentWrapper(0, "value1", "image1"),
+            createIngestDocumentWrapper(1, "value2", "image2")
+        );
+        doAnswer(invocation -> {
+            Map<String, String> inferenceMap = invocation.getArgument(1);
+            ActionListener<List<Float>> listener = invocation.getArgument(2);
+            if ("value1".equals(inferenceMap.get(TextImageEmbeddingProcessor.INPUT_TEXT))) {
+                listener.onFailure(new IllegalArgumentException("inference failed"));
+            } else {
+                listener.onResponse(List.of(1.234f, 2.354f));
+            }
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSentences(anyString(), anyMap(), isA(ActionListener.class));
+
+        Consumer handler = mock(Consumer.class);
+        processor.batchExecute(ingestDocumentWrappers, handler);
+
+        verify(handler).accept(ingestDocumentWrappers);
+        assertTrue(ingestDocumentWrappers.get(0).getException() instanceof IllegalArgumentException);
+        assertNull(ingestDocumentWrappers.get(1).getException());
+        assertNotNull(ingestDocumentWrappers.get(1).getIngestDocument().getSourceAndMetadata().get("my_embedding_field"));
+    }
+
+    private IngestDocumentWrapper createIngestDocumentWrapper(final int slot, final String text, final String image) {
+        Map<String, Object> sourceAndMetadata = new HashMap<>();
+        sourceAndMetadata.put(IndexFieldMapper.NAME, "my_index");
+        sourceAndMetadata.put("my_text_field", text);
+        sourceAndMetadata.put("image_field", image);
+        return new IngestDocumentWrapper(slot, new IngestDocument(sourceAndMetadata, new HashMap<>()), null);
+    }
+
     private List<List<Float>> createMockVectorResult() {
         List<List<Float>> modelTensorList = new ArrayList<>();
         List<Float> number1 = ImmutableList.of(1.234f, 2.354f);
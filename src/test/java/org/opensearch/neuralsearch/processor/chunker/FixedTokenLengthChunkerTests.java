@@ -181,6 +181,23 @@ public class FixedTokenLengthChunkerTests extends OpenSearchTestCase {
             .contains(String.format(Locale.ROOT, "analyzer %s throws exception", lowercaseTokenizer)));
     }
 
+    public void testChunk_whenExceedMaxTokenCount_thenFail() {
+        Map<String, Object> parameters = new HashMap<>();
+        parameters.put(TOKEN_LIMIT_FIELD, 10);
+        parameters.put(TOKENIZER_FIELD, "standard");
+        FixedTokenLengthChunker fixedTokenLengthChunker = createFixedTokenLengthChunker(parameters);
+        Map<String, Object> runtimeParameters = new HashMap<>(this.runtimeParameters);
+        runtimeParameters.put(MAX_TOKEN_COUNT_FIELD, 20);
+        runtimeParameters.put(MAX_CHUNK_LIMIT_FIELD, 1);
+        String content =
+            "This is an example document to be chunked. The document contains a single paragraph, two sentences and 24 tokens by standard tokenizer in OpenSearch.";
+        IllegalStateException illegalStateException = assertThrows(
+            IllegalStateException.class,
+            () -> fixedTokenLengthChunker.chunk(content, runtimeParameters)
+        );
+        assert (illegalStateException.getMessage().contains("has exceeded the allowed maximum of [20]"));
+    }
+
     public void testChunk_withEmptyInput_thenSucceed() {
         Map<String, Object> parameters = new HashMap<>();
         parameters.put(TOKEN_LIMIT_FIELD, 10);
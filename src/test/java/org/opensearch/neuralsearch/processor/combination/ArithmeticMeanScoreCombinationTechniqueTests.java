@@ -29,6 +29,11 @@ public class ArithmeticMeanScoreCombinationTechniqueTests extends BaseScoreCombi
         testLogic_whenNotAllScoresPresentAndNoWeights_thenCorrectScores(technique);
     }
 
+    public void testLogic_whenScoresAreRangeOfArray_thenSameAsCopiedScores() {
+        ScoreCombinationTechnique technique = new ArithmeticMeanScoreCombinationTechnique(Map.of(), scoreCombinationUtil);
+        testLogic_whenScoresAreRangeOfArray_thenSameAsCopiedScores(technique);
+    }
+
     public void testRandomValues_whenAllScoresAndWeightsPresent_thenCorrectScores() {
         List<Double> weights = IntStream.range(0, RANDOM_SCORES_SIZE).mapToObj(i -> 1.0 / RANDOM_SCORES_SIZE).collect(Collectors.toList());
         ScoreCombinationTechnique technique = new ArithmeticMeanScoreCombinationTechnique(
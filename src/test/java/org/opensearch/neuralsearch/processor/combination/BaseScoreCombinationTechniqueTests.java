@@ -37,6 +37,12 @@ public class BaseScoreCombinationTechniqueTests extends OpenSearchTestCase {
         assertEquals(expectedScore, actualScore, DELTA_FOR_ASSERTION);
     }
 
+    public void testLogic_whenScoresAreRangeOfArray_thenSameAsCopiedScores(final ScoreCombinationTechnique technique) {
+        float[] scoresOfDocs = { 0.2f, 0.9f, 1.0f, 0.0f, 0.6f, 0.4f, 0.7f };
+        assertEquals(technique.combine(new float[] { 1.0f, 0.0f, 0.6f }), technique.combine(scoresOfDocs, 2, 3), DELTA_FOR_ASSERTION);
+        assertEquals(technique.combine(new float[] { 0.2f, 0.9f, 1.0f }), technique.combine(scoresOfDocs, 0, 3), DELTA_FOR_ASSERTION);
+    }
+
     public void testLogic_whenAllScoresAndWeightsPresent_thenCorrectScores(
         final ScoreCombinationTechnique technique,
         List<Float> scores,
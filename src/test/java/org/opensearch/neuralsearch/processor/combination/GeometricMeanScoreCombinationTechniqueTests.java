@@ -40,6 +40,11 @@ public class GeometricMeanScoreCombinationTechniqueTests extends BaseScoreCombin
         testLogic_whenAllScoresAndWeightsPresent_thenCorrectScores(technique, scores, expectedScore);
     }
 
+    public void testLogic_whenScoresAreRangeOfArray_thenSameAsCopiedScores() {
+        ScoreCombinationTechnique technique = new GeometricMeanScoreCombinationTechnique(Map.of(), scoreCombinationUtil);
+        testLogic_whenScoresAreRangeOfArray_thenSameAsCopiedScores(technique);
+    }
+
     public void testRandomValues_whenAllScoresAndWeightsPresent_thenCorrectScores() {
         List<Double> weights = IntStream.range(0, RANDOM_SCORES_SIZE).mapToObj(i -> 1.0 / RANDOM_SCORES_SIZE).collect(Collectors.toList());
         ScoreCombinationTechnique technique = new GeometricMeanScoreCombinationTechnique(
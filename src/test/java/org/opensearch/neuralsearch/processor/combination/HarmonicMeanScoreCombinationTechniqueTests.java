@@ -29,6 +29,11 @@ public class HarmonicMeanScoreCombinationTechniqueTests extends BaseScoreCombina
         testLogic_whenNotAllScoresPresentAndNoWeights_thenCorrectScores(technique);
     }
 
+    public void testLogic_whenScoresAreRangeOfArray_thenSameAsCopiedScores() {
+        ScoreCombinationTechnique technique = new HarmonicMeanScoreCombinationTechnique(Map.of(), scoreCombinationUtil);
+        testLogic_whenScoresAreRangeOfArray_thenSameAsCopiedScores(technique);
+    }
+
     public void testLogic_whenAllScoresAndWeightsPresent_thenCorrectScores() {
         List<Float> scores = List.of(1.0f, 0.5f, 0.3f);
         List<Double> weights = List.of(0.45, 0.15, 0.4);
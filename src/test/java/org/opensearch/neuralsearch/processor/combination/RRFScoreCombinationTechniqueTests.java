@@ -0,0 +1,59 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.combination;
+
+import static org.hamcrest.Matchers.containsString;
+import static org.opensearch.neuralsearch.processor.combination.RRFScoreCombinationTechnique.PARAM_NAME_RANK_CONSTANT;
+
+import java.util.List;
+import java.util.Map;
+
+import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
+
+public class RRFScoreCombinationTechniqueTests extends OpenSearchQueryTestCase {
+
+    private static final float DELTA_FOR_ASSERTION = 0.00001f;
+    private final ScoreCombinationUtil scoreCombinationUtil = new ScoreCombinationUtil();
+
+    public void testLogic_whenDefaultRankConstant_thenSumOfReciprocalRanks() {
+        ScoreCombinationTechnique technique = new RRFScoreCombinationTechnique(Map.of(), scoreCombinationUtil);
+        assertTrue(technique.usesRanks());
+
+        float actualScore = technique.combine(new float[] { 1.0f, 3.0f });
+        assertEquals(1.0f / 61 + 1.0f / 63, actualScore, DELTA_FOR_ASSERTION);
+    }
+
+    public void testLogic_whenDocumentMissingInSubQueryResults_thenSubQueryExcluded() {
+        ScoreCombinationTechnique technique = new RRFScoreCombinationTechnique(Map.of(PARAM_NAME_RANK_CONSTANT, 10), scoreCombinationUtil);
+
+        assertEquals(1.0f / 12, technique.combine(new float[] { 0.0f, 2.0f, 0.0f }), DELTA_FOR_ASSERTION);
+        assertEquals(0.0f, technique.combine(new float[] { 0.0f, 0.0f }), DELTA_FOR_ASSERTION);
+        assertEquals(1.0f / 11 + 1.0f / 15, technique.combine(new float[] { 7.0f, 1.0f, 5.0f, 9.0f }, 1, 2), DELTA_FOR_ASSERTION);
+    }
+
+    public void testParams_whenInvalidRankConstant_thenFail() {
+        IllegalArgumentException exception = expectThrows(
+            IllegalArgumentException.class,
+            () -> new RRFScoreCombinationTechnique(Map.of(PARAM_NAME_RANK_CONSTANT, 0), scoreCombinationUtil)
+        );
+        org.hamcrest.MatcherAssert.assertThat(exception.getMessage(), containsString("must be an integer greater than or equal to 1"));
+
+        expectThrows(
+            IllegalArgumentException.class,
+            () -> new RRFScoreCombinationTechnique(Map.of(PARAM_NAME_RANK_CONSTANT, "sixty"), scoreCombinationUtil)
+        );
+    }
+
+    public void testParams_whenUnsupportedParam_thenFail() {
+        IllegalArgumentException exception = expectThrows(
+            IllegalArgumentException.class,
+            () -> new RRFScoreCombinationTechnique(Map.of("weights", List.of(0.5, 0.5)), scoreCombinationUtil)
+        );
+        org.hamcrest.MatcherAssert.assertThat(
+            exception.getMessage(),
+            containsString("provided parameter for combination technique is not supported")
+        );
+    }
+}
@@ -4,6 +4,7 @@
  */
 package org.opensearch.neuralsearch.processor.normalization;
 
+import java.util.Arrays;
 import java.util.List;
 
 import org.apache.lucene.search.ScoreDoc;
@@ -161,6 +162,48 @@ public class MinMaxScoreNormalizationTechniqueTests extends OpenSearchQueryTestC
         }
     }
 
+    public void testNormalization_whenMinAndMaxScoresInDifferentShards_thenNormalizedWithGlobalMinAndMax() {
+        MinMaxScoreNormalizationTechnique normalizationTechnique = new MinMaxScoreNormalizationTechnique();
+        List<CompoundTopDocs> compoundTopDocs = Arrays.asList(
+            new CompoundTopDocs(
+                new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                List.of(
+                    new TopDocs(
+                        new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(2, 4.0f), new ScoreDoc(4, 3.0f) }
+                    )
+                )
+            ),
+            null,
+            new CompoundTopDocs(
+                new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                List.of(
+                    new TopDocs(
+                        new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                        new ScoreDoc[] { new ScoreDoc(7, 2.0f), new ScoreDoc(9, 1.0f) }
+                    )
+                )
+            )
+        );
+        normalizationTechnique.normalize(compoundTopDocs);
+
+        assertCompoundTopDocs(
+            new TopDocs(
+                new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                new ScoreDoc[] { new ScoreDoc(2, 1.0f), new ScoreDoc(4, 0.6666f) }
+            ),
+            compoundTopDocs.get(0).getTopDocs().get(0)
+        );
+        assertNull(compoundTopDocs.get(1));
+        assertCompoundTopDocs(
+            new TopDocs(
+                new TotalHits(2, TotalHits.Relation.EQUAL_TO),
+                new ScoreDoc[] { new ScoreDoc(7, 0.3333f), new ScoreDoc(9, 0.001f) }
+            ),
+            compoundTopDocs.get(2).getTopDocs().get(0)
+        );
+    }
+
     private void assertCompoundTopDocs(TopDocs expected, TopDocs actual) {
         assertEquals(expected.totalHits.value, actual.totalHits.value);
         assertEquals(expected.totalHits.relation, actual.totalHits.relation);
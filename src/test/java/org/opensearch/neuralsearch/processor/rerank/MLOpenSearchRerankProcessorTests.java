@@ -19,6 +19,7 @@ import java.util.HashMap;
 import java.util.List;
 import java.util.Locale;
 import java.util.Map;
+import java.util.stream.Collectors;
 
 import org.apache.lucene.search.TotalHits;
 import org.junit.Before;
@@ -33,9 +34,11 @@ import org.opensearch.action.search.SearchResponseSections;
 import org.opensearch.action.search.ShardSearchFailure;
 import org.opensearch.common.document.DocumentField;
 import org.opensearch.common.settings.Settings;
+import org.opensearch.common.unit.TimeValue;
 import org.opensearch.common.xcontent.json.JsonXContent;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.core.common.bytes.BytesReference;
+import org.opensearch.core.common.unit.ByteSizeValue;
 import org.opensearch.core.xcontent.XContentBuilder;
 import org.opensearch.index.mapper.MapperService;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
@@ -365,6 +368,202 @@ public class MLOpenSearchRerankProcessorTests extends OpenSearchTestCase {
         assert (argCaptor.getValue().getMessage().equals("scores and hits are not the same length"));
     }
 
+    public void testRerank_whenRerankWindowAndBatches_thenOnlyWindowRescoredInBatches() throws IOException {
+        List<List<String>> requestedContexts = new ArrayList<>();
+        doAnswer(invocation -> {
+            List<String> contexts = invocation.getArgument(2);
+            requestedContexts.add(contexts);
+            ActionListener<List<Float>> listener = invocation.getArgument(3);
+            listener.onResponse(contexts.stream().map(context -> context.equals("hig") ? 5f : 1f).collect(Collectors.toList()));
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSimilarity(anyString(), anyString(), anyList(), any());
+        setupSearchResults();
+        MLOpenSearchRerankProcessor windowedProcessor = new MLOpenSearchRerankProcessor(
+            "windowed processor",
+            "rerank processor",
+            false,
+            "model-id",
+            List.of(),
+            mlCommonsClientAccessor,
+            2,
+            1,
+            3
+        );
+        @SuppressWarnings("unchecked")
+        ActionListener<SearchResponse> listener = mock(ActionListener.class);
+        Map<String, Object> scoringContext = Map.of(
+            QueryContextSourceFetcher.QUERY_TEXT_FIELD,
+            "query text",
+            DocumentContextSourceFetcher.DOCUMENT_CONTEXT_LIST_FIELD,
+            new ArrayList<>(List.of("low", "high", "tail"))
+        );
+        windowedProcessor.rerank(response, scoringContext, listener);
+
+        assertEquals(List.of(List.of("low"), List.of("hig")), requestedContexts);
+        ArgumentCaptor<SearchResponse> argCaptor = ArgumentCaptor.forClass(SearchResponse.class);
+        verify(listener, times(1)).onResponse(argCaptor.capture());
+        SearchResponse rsp = argCaptor.getValue();
+        assertEquals(0, rsp.getHits().getAt(0).docId());
+        assertEquals(5f, rsp.getHits().getAt(0).getScore(), 0f);
+        assertEquals(1, rsp.getHits().getAt(1).docId());
+        assertEquals(1f, rsp.getHits().getAt(1).getScore(), 0f);
+        // hits out of the window keep their order and scores
+        assertEquals(2, rsp.getHits().getAt(2).docId());
+        assertEquals(0f, rsp.getHits().getAt(2).getScore(), 0f);
+        assertEquals(5f, rsp.getHits().getMaxScore(), 0f);
+    }
+
+    public void testRerank_whenHitPastRerankWindowHasHigherScore_thenMaxScoreOfWindow() throws IOException {
+        doAnswer(invocation -> {
+            List<String> contexts = invocation.getArgument(2);
+            ActionListener<List<Float>> listener = invocation.getArgument(3);
+            listener.onResponse(contexts.stream().map(context -> context.equals("hig") ? 0.5f : 0.25f).collect(Collectors.toList()));
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSimilarity(anyString(), anyString(), anyList(), any());
+        setupSearchResults();
+        response.getHits().getAt(2).score(3f);
+        MLOpenSearchRerankProcessor windowedProcessor = new MLOpenSearchRerankProcessor(
+            "windowed processor",
+            "rerank processor",
+            false,
+            "model-id",
+            List.of(),
+            mlCommonsClientAccessor,
+            2,
+            2,
+            3
+        );
+        @SuppressWarnings("unchecked")
+        ActionListener<SearchResponse> listener = mock(ActionListener.class);
+        Map<String, Object> scoringContext = Map.of(
+            QueryContextSourceFetcher.QUERY_TEXT_FIELD,
+            "query text",
+            DocumentContextSourceFetcher.DOCUMENT_CONTEXT_LIST_FIELD,
+            new ArrayList<>(List.of("low", "high", "tail"))
+        );
+        windowedProcessor.rerank(response, scoringContext, listener);
+
+        ArgumentCaptor<SearchResponse> argCaptor = ArgumentCaptor.forClass(SearchResponse.class);
+        verify(listener, times(1)).onResponse(argCaptor.capture());
+        SearchResponse rsp = argCaptor.getValue();
+        assertEquals(0, rsp.getHits().getAt(0).docId());
+        assertEquals(0.5f, rsp.getHits().getAt(0).getScore(), 0f);
+        // hit out of the window keeps its original score, which is not part of the max score
+        assertEquals(2, rsp.getHits().getAt(2).docId());
+        assertEquals(3f, rsp.getHits().getAt(2).getScore(), 0f);
+        assertEquals(0.5f, rsp.getHits().getMaxScore(), 0f);
+    }
+
+    public void testRescoreSearchResponse_whenOneOfBatchesFails_thenFailOnce() throws IOException {
+        doAnswer(invocation -> {
+            List<String> contexts = invocation.getArgument(2);
+            ActionListener<List<Float>> listener = invocation.getArgument(3);
+            if (contexts.contains("fail")) {
+                listener.onFailure(new IllegalStateException("model failure"));
+            } else {
+                listener.onResponse(List.of(1f));
+            }
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSimilarity(anyString(), anyString(), anyList(), any());
+        setupSearchResults();
+        MLOpenSearchRerankProcessor batchedProcessor = new MLOpenSearchRerankProcessor(
+            "batched processor",
+            "rerank processor",
+            false,
+            "model-id",
+            List.of(),
+            mlCommonsClientAccessor,
+            MLOpenSearchRerankProcessor.UNLIMITED,
+            1,
+            MLOpenSearchRerankProcessor.UNLIMITED
+        );
+        @SuppressWarnings("unchecked")
+        ActionListener<List<Float>> listener = mock(ActionListener.class);
+        Map<String, Object> scoringContext = Map.of(
+            QueryContextSourceFetcher.QUERY_TEXT_FIELD,
+            "query text",
+            DocumentContextSourceFetcher.DOCUMENT_CONTEXT_LIST_FIELD,
+            new ArrayList<>(List.of("fail", "dummy", "fail"))
+        );
+        batchedProcessor.rescoreSearchResponse(response, scoringContext, listener);
+
+        verify(listener, times(1)).onFailure(any(IllegalStateException.class));
+        verify(listener, times(0)).onResponse(any());
+    }
+
+    public void testRescoreSearchResponse_whenScoresCached_thenOnlyMissesAndUpdatedDocumentsSentToModel() throws IOException {
+        List<List<String>> requestedContexts = new ArrayList<>();
+        doAnswer(invocation -> {
+            List<String> contexts = invocation.getArgument(2);
+            requestedContexts.add(contexts);
+            ActionListener<List<Float>> listener = invocation.getArgument(3);
+            listener.onResponse(contexts.stream().map(context -> (float) context.length()).collect(Collectors.toList()));
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSimilarity(anyString(), anyString(), anyList(), any());
+        setupSearchResults();
+        for (SearchHit hit : response.getHits().getHits()) {
+            hit.version(1);
+        }
+        RerankScoreCache scoreCache = new RerankScoreCache(new ByteSizeValue(1024 * 1024), TimeValue.timeValueMinutes(1));
+        MLOpenSearchRerankProcessor cachedProcessor = new MLOpenSearchRerankProcessor(
+            "cached processor",
+            "rerank processor",
+            false,
+            "model-id",
+            List.of(),
+            mlCommonsClientAccessor,
+            MLOpenSearchRerankProcessor.UNLIMITED,
+            MLOpenSearchRerankProcessor.UNLIMITED,
+            MLOpenSearchRerankProcessor.UNLIMITED,
+            scoreCache
+        );
+        Map<String, Object> scoringContext = Map.of(
+            QueryContextSourceFetcher.QUERY_TEXT_FIELD,
+            "query text",
+            DocumentContextSourceFetcher.DOCUMENT_CONTEXT_LIST_FIELD,
+            new ArrayList<>(List.of("a", "bb", "ccc"))
+        );
+        @SuppressWarnings("unchecked")
+        ActionListener<List<Float>> firstListener = mock(ActionListener.class);
+        cachedProcessor.rescoreSearchResponse(response, scoringContext, firstListener);
+        verify(firstListener, times(1)).onResponse(List.of(1f, 2f, 3f));
+
+        @SuppressWarnings("unchecked")
+        ActionListener<List<Float>> cachedListener = mock(ActionListener.class);
+        cachedProcessor.rescoreSearchResponse(response, scoringContext, cachedListener);
+        verify(cachedListener, times(1)).onResponse(List.of(1f, 2f, 3f));
+        assertEquals(List.of(List.of("a", "bb", "ccc")), requestedContexts);
+
+        // updated document gets a new version, only its score is computed again
+        response.getHits().getAt(1).version(2);
+        @SuppressWarnings("unchecked")
+        ActionListener<List<Float>> updatedListener = mock(ActionListener.class);
+        cachedProcessor.rescoreSearchResponse(response, scoringContext, updatedListener);
+        verify(updatedListener, times(1)).onResponse(List.of(1f, 2f, 3f));
+        assertEquals(List.of(List.of("a", "bb", "ccc"), List.of("bb")), requestedContexts);
+        assertEquals(4, scoreCache.count());
+        assertEquals(5, scoreCache.stats().getHits());
+        assertEquals(4, scoreCache.stats().getMisses());
+    }
+
+    public void testCreate_whenRerankWindowIsNotPositive_thenFail() {
+        Map<String, Object> config = new HashMap<>(
+            Map.of(
+                RerankType.ML_OPENSEARCH.getLabel(),
+                new HashMap<>(
+                    Map.of(MLOpenSearchRerankProcessor.MODEL_ID_FIELD, "model-id", MLOpenSearchRerankProcessor.RERANK_WINDOW_FIELD, 0)
+                ),
+                RerankProcessorFactory.CONTEXT_CONFIG_FIELD,
+                new HashMap<>(Map.of(DocumentContextSourceFetcher.NAME, new ArrayList<>(List.of("text_representation"))))
+            )
+        );
+        IllegalArgumentException exception = expectThrows(
+            IllegalArgumentException.class,
+            () -> factory.create(Map.of(), "rerank processor", "description", false, config, pipelineContext)
+        );
+        assertEquals("rerank_window must be a positive integer", exception.getMessage());
+    }
+
     public void testBasics() throws IOException {
         assert (processor.getTag().equals("rerank processor"));
         assert (processor.getDescription().equals("processor for reranking with a cross encoder"));
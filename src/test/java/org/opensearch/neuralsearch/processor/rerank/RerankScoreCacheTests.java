@@ -0,0 +1,60 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.rerank;
+
+import java.util.Map;
+
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.search.SearchHit;
+import org.opensearch.test.OpenSearchTestCase;
+
+public class RerankScoreCacheTests extends OpenSearchTestCase {
+
+    private static final String MODEL_ID = "model_id";
+    private static final String QUERY_TEXT = "query text";
+
+    public void testGet_whenVersionChanged_thenMiss() {
+        RerankScoreCache cache = new RerankScoreCache(new ByteSizeValue(1024 * 1024), TimeValue.timeValueMinutes(1));
+        SearchHit hit = new SearchHit(0, "0", Map.of(), Map.of());
+        hit.version(1);
+        cache.put(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "passage"), 0.5f);
+
+        assertEquals(0.5f, cache.get(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "passage")), 0.0f);
+        assertNull(cache.get(RerankScoreCacheKey.of("other_model", QUERY_TEXT, hit, "passage")));
+        assertNull(cache.get(RerankScoreCacheKey.of(MODEL_ID, "other query", hit, "passage")));
+        assertNull(cache.get(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "other passage")));
+        hit.version(2);
+        assertNull(cache.get(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "passage")));
+
+        assertEquals(1, cache.count());
+        assertTrue(cache.weight() > 0);
+        assertEquals(0.2, cache.hitRate(), 0.0001);
+    }
+
+    public void testGet_whenVersionedHitAndContextsWithSameHashCode_thenMiss() {
+        RerankScoreCache cache = new RerankScoreCache(new ByteSizeValue(1024 * 1024), TimeValue.timeValueMinutes(1));
+        SearchHit hit = new SearchHit(0, "0", Map.of(), Map.of());
+        hit.version(1);
+        assertEquals("Aa".hashCode(), "BB".hashCode());
+        cache.put(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "Aa"), 0.5f);
+
+        assertEquals(0.5f, cache.get(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "Aa")), 0.0f);
+        assertNull(cache.get(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "BB")));
+    }
+
+    public void testGet_whenHitHasNoVersion_thenKeyedByContext() {
+        RerankScoreCache cache = new RerankScoreCache(new ByteSizeValue(1024 * 1024), TimeValue.timeValueMinutes(1));
+        SearchHit hit = new SearchHit(0, "0", Map.of(), Map.of());
+        cache.put(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "passage"), 0.5f);
+
+        assertEquals(0.5f, cache.get(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "passage")), 0.0f);
+        assertNull(cache.get(RerankScoreCacheKey.of(MODEL_ID, QUERY_TEXT, hit, "updated passage")));
+
+        cache.invalidateAll();
+        assertEquals(0, cache.count());
+        assertEquals(0, cache.weight());
+    }
+}
@@ -544,6 +544,41 @@ public class HybridQueryIT extends BaseNeuralSearchIT {
         }
     }
 
+    @SneakyThrows
+    public void testRequestCache_whenOneShardAndSizeLessThanResultElements_thenSameResultsFromCache() {
+        try {
+            initializeIndexIfNotExist(TEST_INDEX_WITH_KEYWORDS_ONE_SHARD);
+            createSearchPipelineWithResultsPostProcessor(SEARCH_PIPELINE);
+            HybridQueryBuilder hybridQueryBuilder = new HybridQueryBuilder();
+            hybridQueryBuilder.add(QueryBuilders.matchQuery(KEYWORD_FIELD_1, KEYWORD_FIELD_2_VALUE));
+            hybridQueryBuilder.add(QueryBuilders.rangeQuery(INTEGER_FIELD_PRICE).gte(10).lte(1000));
+            Map<String, String> requestParams = Map.of("search_pipeline", SEARCH_PIPELINE, "request_cache", Boolean.TRUE.toString());
+
+            // results of both sub-queries with start/stop and delimiter elements don't fit into the requested size, fetch of
+            // cached results must still load all of them
+            Map<String, Object> firstSearchResponseAsMap = search(
+                TEST_INDEX_WITH_KEYWORDS_ONE_SHARD,
+                hybridQueryBuilder,
+                null,
+                1,
+                requestParams
+            );
+            Map<String, Object> secondSearchResponseAsMap = search(
+                TEST_INDEX_WITH_KEYWORDS_ONE_SHARD,
+                hybridQueryBuilder,
+                null,
+                1,
+                requestParams
+            );
+
+            assertEquals(1, getNestedHits(firstSearchResponseAsMap).size());
+            assertEquals(getNestedHits(firstSearchResponseAsMap), getNestedHits(secondSearchResponseAsMap));
+            assertEquals(getTotalHits(firstSearchResponseAsMap), getTotalHits(secondSearchResponseAsMap));
+        } finally {
+            wipeOfTestResources(TEST_INDEX_WITH_KEYWORDS_ONE_SHARD, null, null, SEARCH_PIPELINE);
+        }
+    }
+
     @SneakyThrows
     public void testRequestCache_whenMultipleShardsQueryReturnResults_thenSuccessful() {
         try {
@@ -31,6 +31,28 @@ import lombok.SneakyThrows;
 
 public class HybridQueryScorerTests extends OpenSearchQueryTestCase {
 
+    @SneakyThrows
+    public void testHybridScores_whenScoresArrayReused_thenScoresOfPreviousDocReset() {
+        Weight weight = mock(Weight.class);
+        HybridQueryScorer hybridQueryScorer = new HybridQueryScorer(
+            weight,
+            Arrays.asList(
+                scorer(new int[] { 1 }, new float[] { 0.8f }, fakeWeight(new MatchAllDocsQuery())),
+                scorer(new int[] { 2 }, new float[] { 0.6f }, fakeWeight(new MatchAllDocsQuery()))
+            )
+        );
+        assertEquals(2, hybridQueryScorer.getNumSubqueries());
+        float[] scores = new float[hybridQueryScorer.getNumSubqueries()];
+
+        assertEquals(1, hybridQueryScorer.iterator().nextDoc());
+        hybridQueryScorer.hybridScores(scores);
+        assertArrayEquals(new float[] { 0.8f, 0.0f }, scores, 0.001f);
+
+        assertEquals(2, hybridQueryScorer.iterator().nextDoc());
+        hybridQueryScorer.hybridScores(scores);
+        assertArrayEquals(new float[] { 0.0f, 0.6f }, scores, 0.001f);
+    }
+
     @SneakyThrows
     public void testWithRandomDocuments_whenOneSubScorer_thenReturnSuccessfully() {
         int maxDocId = TestUtil.nextInt(random(), 10, 10_000);
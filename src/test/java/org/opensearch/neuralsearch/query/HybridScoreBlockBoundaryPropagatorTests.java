@@ -48,6 +48,32 @@ public class HybridScoreBlockBoundaryPropagatorTests extends OpenSearchQueryTest
         assertEquals(120, propagator.advanceShallow(0));
     }
 
+    public void testAdvanceShallow_whenSubQueryMinCompetitiveScoreSet_thenSkipNonCompetitiveClauses() throws IOException {
+        Scorer scorer1 = new MockScorer(10, 0.6f);
+        Scorer scorer2 = new MockScorer(40, 1.5f);
+        Scorer scorer3 = new MockScorer(30, 2f);
+        Scorer scorer4 = new MockScorer(120, 4f);
+
+        HybridScoreBlockBoundaryPropagator propagator = new HybridScoreBlockBoundaryPropagator(
+            Arrays.asList(scorer3, null, scorer1, scorer4, scorer2)
+        );
+        assertEquals(10, propagator.advanceShallow(0));
+
+        // threshold below max score of the clause doesn't change boundaries
+        propagator.setMinCompetitiveScore(2, 0.5f);
+        assertEquals(10, propagator.advanceShallow(0));
+
+        propagator.setMinCompetitiveScore(2, 0.7f);
+        assertEquals(30, propagator.advanceShallow(0));
+
+        propagator.setMinCompetitiveScore(0, 2.5f);
+        assertEquals(40, propagator.advanceShallow(0));
+
+        // sub-query without scorer is ignored
+        propagator.setMinCompetitiveScore(1, 10f);
+        assertEquals(40, propagator.advanceShallow(0));
+    }
+
     private static class MockWeight extends Weight {
 
         MockWeight() {
@@ -0,0 +1,144 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.query;
+
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+
+import org.apache.lucene.document.Document;
+import org.apache.lucene.document.Field;
+import org.apache.lucene.document.FloatDocValuesField;
+import org.apache.lucene.document.StringField;
+import org.apache.lucene.index.DirectoryReader;
+import org.apache.lucene.index.IndexWriter;
+import org.apache.lucene.index.Term;
+import org.apache.lucene.queries.function.FunctionScoreQuery;
+import org.apache.lucene.search.DoubleValuesSource;
+import org.apache.lucene.search.IndexSearcher;
+import org.apache.lucene.search.MatchNoDocsQuery;
+import org.apache.lucene.search.Query;
+import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TermQuery;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.join.BitSetProducer;
+import org.apache.lucene.search.join.QueryBitSetProducer;
+import org.apache.lucene.store.Directory;
+import org.apache.lucene.tests.analysis.MockAnalyzer;
+import org.opensearch.test.OpenSearchTestCase;
+
+import lombok.SneakyThrows;
+
+public class NeuralChunkQueryTests extends OpenSearchTestCase {
+
+    private static final String TYPE_FIELD = "type";
+    private static final String ID_FIELD = "id";
+    private static final String SCORE_FIELD = "chunk_score";
+    private static final Query CHUNK_QUERY = new FunctionScoreQuery(
+        new TermQuery(new Term(TYPE_FIELD, "chunk")),
+        DoubleValuesSource.fromFloatField(SCORE_FIELD)
+    );
+    private static final BitSetProducer PARENT_FILTER = new QueryBitSetProducer(new TermQuery(new Term(TYPE_FIELD, "parent")));
+
+    @SneakyThrows
+    public void testSearch_whenMaxMode_thenBestChunkOfTopParents() {
+        try (Directory directory = newDirectory(); DirectoryReader reader = indexDocuments(directory)) {
+            IndexSearcher searcher = newSearcher(reader);
+
+            TopDocs topDocs = searcher.search(new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.MAX, 2), 10);
+
+            assertEquals(List.of("a", "b"), parentIds(reader, topDocs));
+            assertEquals(0.9f, topDocs.scoreDocs[0].score, 1e-6f);
+            assertEquals(0.8f, topDocs.scoreDocs[1].score, 1e-6f);
+        }
+    }
+
+    @SneakyThrows
+    public void testSearch_whenSumMode_thenSumOfChunksOfTopParents() {
+        try (Directory directory = newDirectory(); DirectoryReader reader = indexDocuments(directory)) {
+            IndexSearcher searcher = newSearcher(reader);
+
+            TopDocs topDocs = searcher.search(new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.SUM, 2), 10);
+
+            // parent "c" has a single chunk with the lowest sum
+            assertEquals(List.of("b", "a"), parentIds(reader, topDocs));
+            assertEquals(1.5f, topDocs.scoreDocs[0].score, 1e-6f);
+            assertEquals(1.4f, topDocs.scoreDocs[1].score, 1e-6f);
+        }
+    }
+
+    @SneakyThrows
+    public void testSearch_whenSumModeAndParentWithoutBestChunk_thenParentSelectedBySum() {
+        List<List<Document>> blocks = List.of(createBlock("x", 0.9f), createBlock("y", 0.8f), createBlock("z", 0.5f, 0.5f, 0.5f));
+        try (Directory directory = newDirectory(); DirectoryReader reader = indexDocuments(directory, blocks)) {
+            IndexSearcher searcher = newSearcher(reader);
+
+            TopDocs topDocs = searcher.search(new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.SUM, 2), 10);
+
+            // none of the chunks of "z" is among the best, but their sum is the highest
+            assertEquals(List.of("z", "x"), parentIds(reader, topDocs));
+            assertEquals(1.5f, topDocs.scoreDocs[0].score, 1e-6f);
+            assertEquals(0.9f, topDocs.scoreDocs[1].score, 1e-6f);
+        }
+    }
+
+    @SneakyThrows
+    public void testRewrite_whenNoChunksMatch_thenMatchNoDocs() {
+        try (Directory directory = newDirectory(); DirectoryReader reader = indexDocuments(directory)) {
+            IndexSearcher searcher = newSearcher(reader);
+            Query chunkQuery = new TermQuery(new Term(TYPE_FIELD, "missing"));
+
+            Query rewritten = searcher.rewrite(new NeuralChunkQuery(chunkQuery, PARENT_FILTER, ChunkScoreMode.MAX, 2));
+
+            assertTrue(rewritten instanceof MatchNoDocsQuery);
+        }
+    }
+
+    public void testEqualsAndHashCode() {
+        NeuralChunkQuery query = new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.MAX, 2);
+        assertEquals(query, new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.MAX, 2));
+        assertEquals(query.hashCode(), new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.MAX, 2).hashCode());
+        assertNotEquals(query, new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.SUM, 2));
+        assertNotEquals(query, new NeuralChunkQuery(CHUNK_QUERY, PARENT_FILTER, ChunkScoreMode.MAX, 3));
+    }
+
+    private static DirectoryReader indexDocuments(final Directory directory) throws IOException {
+        return indexDocuments(directory, List.of(createBlock("a", 0.9f, 0.2f, 0.3f), createBlock("b", 0.8f, 0.7f), createBlock("c", 0.5f)));
+    }
+
+    private static DirectoryReader indexDocuments(final Directory directory, final List<List<Document>> blocks) throws IOException {
+        try (IndexWriter writer = new IndexWriter(directory, newIndexWriterConfig(new MockAnalyzer(random())))) {
+            for (List<Document> block : blocks) {
+                writer.addDocuments(block);
+            }
+            writer.commit();
+        }
+        return DirectoryReader.open(directory);
+    }
+
+    // nested documents are indexed in one block followed by their parent, the same way as nested fields in OpenSearch
+    private static List<Document> createBlock(final String parentId, final float... chunkScores) {
+        List<Document> block = new ArrayList<>();
+        for (float chunkScore : chunkScores) {
+            Document chunk = new Document();
+            chunk.add(new StringField(TYPE_FIELD, "chunk", Field.Store.NO));
+            chunk.add(new FloatDocValuesField(SCORE_FIELD, chunkScore));
+            block.add(chunk);
+        }
+        Document parent = new Document();
+        parent.add(new StringField(TYPE_FIELD, "parent", Field.Store.NO));
+        parent.add(new StringField(ID_FIELD, parentId, Field.Store.YES));
+        block.add(parent);
+        return block;
+    }
+
+    private static List<String> parentIds(final DirectoryReader reader, final TopDocs topDocs) throws IOException {
+        List<String> ids = new ArrayList<>();
+        for (ScoreDoc scoreDoc : topDocs.scoreDocs) {
+            ids.add(reader.document(scoreDoc.doc).get(ID_FIELD));
+        }
+        return ids;
+    }
+}
@@ -8,11 +8,14 @@ import static org.mockito.ArgumentMatchers.any;
 import static org.mockito.ArgumentMatchers.anyMap;
 import static org.mockito.Mockito.doAnswer;
 import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.times;
+import static org.mockito.Mockito.verify;
 import static org.opensearch.core.xcontent.ToXContent.EMPTY_PARAMS;
 import static org.opensearch.index.query.AbstractQueryBuilder.BOOST_FIELD;
 import static org.opensearch.index.query.AbstractQueryBuilder.NAME_FIELD;
 import static org.opensearch.knn.index.query.KNNQueryBuilder.FILTER_FIELD;
 import static org.opensearch.neuralsearch.util.TestUtils.xContentBuilderToMap;
+import static org.opensearch.neuralsearch.query.NeuralQueryBuilder.CHUNK_SCORE_MODE_FIELD;
 import static org.opensearch.neuralsearch.query.NeuralQueryBuilder.K_FIELD;
 import static org.opensearch.neuralsearch.query.NeuralQueryBuilder.MAX_DISTANCE_FIELD;
 import static org.opensearch.neuralsearch.query.NeuralQueryBuilder.MIN_SCORE_FIELD;
@@ -30,15 +33,18 @@ import java.util.concurrent.TimeUnit;
 import java.util.function.BiConsumer;
 import java.util.function.Supplier;
 
+import org.apache.lucene.util.RamUsageEstimator;
 import org.opensearch.Version;
 import org.opensearch.client.Client;
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.common.io.stream.BytesStreamOutput;
+import org.opensearch.common.unit.TimeValue;
 import org.opensearch.common.xcontent.XContentFactory;
 import org.opensearch.core.ParseField;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.core.common.ParsingException;
 import org.opensearch.core.common.bytes.BytesReference;
+import org.opensearch.core.common.unit.ByteSizeValue;
 import org.opensearch.core.common.io.stream.FilterStreamInput;
 import org.opensearch.core.common.io.stream.NamedWriteableAwareStreamInput;
 import org.opensearch.core.common.io.stream.NamedWriteableRegistry;
@@ -46,6 +52,7 @@ import org.opensearch.core.xcontent.NamedXContentRegistry;
 import org.opensearch.core.xcontent.ToXContent;
 import org.opensearch.core.xcontent.XContentBuilder;
 import org.opensearch.core.xcontent.XContentParser;
+import org.opensearch.index.query.BoolQueryBuilder;
 import org.opensearch.index.query.MatchAllQueryBuilder;
 import org.opensearch.index.query.MatchNoneQueryBuilder;
 import org.opensearch.index.query.QueryBuilder;
@@ -53,6 +60,7 @@ import org.opensearch.index.query.QueryRewriteContext;
 import org.opensearch.index.query.QueryShardContext;
 import org.opensearch.knn.index.query.KNNQueryBuilder;
 import org.opensearch.neuralsearch.common.VectorUtil;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.util.NeuralSearchClusterTestUtils;
 import org.opensearch.neuralsearch.util.NeuralSearchClusterUtil;
@@ -63,6 +71,7 @@ import lombok.SneakyThrows;
 public class NeuralQueryBuilderTests extends OpenSearchTestCase {
 
     private static final String FIELD_NAME = "testField";
+    private static final String CHUNK_FIELD_NAME = "chunks.testField";
     private static final String QUERY_TEXT = "Hello world!";
     private static final String IMAGE_TEXT = "base641234567890";
     private static final String MODEL_ID = "mfgfgdsfgfdgsde";
@@ -590,6 +599,51 @@ public class NeuralQueryBuilderTests extends OpenSearchTestCase {
         assertArrayEquals(VectorUtil.vectorAsListToArray(expectedVector), queryBuilder.vectorSupplier().get(), 0.0f);
     }
 
+    @SneakyThrows
+    public void testRewrite_whenInferenceCacheEnabled_thenInferenceOnlyOnce() {
+        List<Float> expectedVector = Arrays.asList(1.0f, 2.0f, 3.0f, 4.0f, 5.0f);
+        MLCommonsClientAccessor mlCommonsClientAccessor = mock(MLCommonsClientAccessor.class);
+        doAnswer(invocation -> {
+            ActionListener<List<Float>> listener = invocation.getArgument(2);
+            listener.onResponse(expectedVector);
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSentences(any(), anyMap(), any());
+        NeuralQueryBuilder.initialize(
+            mlCommonsClientAccessor,
+            new InferenceResultCache<float[]>(new ByteSizeValue(1024 * 1024), TimeValue.timeValueMinutes(10), RamUsageEstimator::sizeOf)
+        );
+        try {
+            QueryRewriteContext queryRewriteContext = mock(QueryRewriteContext.class);
+            doAnswer(invocation -> {
+                BiConsumer<Client, ActionListener<?>> biConsumer = invocation.getArgument(0);
+                biConsumer.accept(
+                    null,
+                    ActionListener.wrap(response -> {}, err -> fail("Failed to set vector supplier: " + err.getMessage()))
+                );
+                return null;
+            }).when(queryRewriteContext).registerAsyncAction(any());
+
+            NeuralQueryBuilder firstQueryBuilder = (NeuralQueryBuilder) new NeuralQueryBuilder().fieldName(FIELD_NAME)
+                .queryText(QUERY_TEXT)
+                .modelId(MODEL_ID)
+                .k(K)
+                .doRewrite(queryRewriteContext);
+            NeuralQueryBuilder secondQueryBuilder = (NeuralQueryBuilder) new NeuralQueryBuilder().fieldName(FIELD_NAME)
+                .queryText(QUERY_TEXT)
+                .modelId(MODEL_ID)
+                .k(K)
+                .doRewrite(queryRewriteContext);
+
+            assertArrayEquals(VectorUtil.vectorAsListToArray(expectedVector), firstQueryBuilder.vectorSupplier().get(), 0.0f);
+            assertArrayEquals(VectorUtil.vectorAsListToArray(expectedVector), secondQueryBuilder.vectorSupplier().get(), 0.0f);
+            assertNotSame(firstQueryBuilder.vectorSupplier().get(), secondQueryBuilder.vectorSupplier().get());
+            verify(mlCommonsClientAccessor, times(1)).inferenceSentences(any(), anyMap(), any());
+            verify(queryRewriteContext, times(1)).registerAsyncAction(any());
+        } finally {
+            NeuralQueryBuilder.initialize(mlCommonsClientAccessor);
+        }
+    }
+
     @SneakyThrows
     public void testRewrite_whenVectorSupplierNullAndQueryTextAndImageTextSet_thenSetVectorSupplier() {
         NeuralQueryBuilder neuralQueryBuilder = new NeuralQueryBuilder().fieldName(FIELD_NAME)
@@ -626,6 +680,7 @@ public class NeuralQueryBuilderTests extends OpenSearchTestCase {
         assertArrayEquals(VectorUtil.vectorAsListToArray(expectedVector), queryBuilder.vectorSupplier().get(), 0.0f);
     }
 
+    @SneakyThrows
     public void testRewrite_whenVectorNull_thenReturnCopy() {
         Supplier<float[]> nullSupplier = () -> null;
         NeuralQueryBuilder neuralQueryBuilder = new NeuralQueryBuilder().fieldName(FIELD_NAME)
@@ -638,6 +693,7 @@ public class NeuralQueryBuilderTests extends OpenSearchTestCase {
         assertEquals(neuralQueryBuilder, queryBuilder);
     }
 
+    @SneakyThrows
     public void testRewrite_whenVectorSupplierAndVectorSet_thenReturnKNNQueryBuilder() {
         NeuralQueryBuilder neuralQueryBuilder = new NeuralQueryBuilder().fieldName(FIELD_NAME)
             .queryText(QUERY_TEXT)
@@ -653,6 +709,7 @@ public class NeuralQueryBuilderTests extends OpenSearchTestCase {
         assertArrayEquals(TEST_VECTOR_SUPPLIER.get(), (float[]) knnQueryBuilder.vector(), 0.0f);
     }
 
+    @SneakyThrows
     public void testRewrite_whenFilterSet_thenKNNQueryBuilderFilterSet() {
         NeuralQueryBuilder neuralQueryBuilder = new NeuralQueryBuilder().fieldName(FIELD_NAME)
             .queryText(QUERY_TEXT)
@@ -779,6 +836,170 @@ public class NeuralQueryBuilderTests extends OpenSearchTestCase {
         expectThrows(IllegalArgumentException.class, () -> NeuralQueryBuilder.fromXContent(contentParser));
     }
 
+    @SneakyThrows
+    public void testFromXContent_whenBuiltWithChunkScoreMode_thenBuildSuccessfully() {
+        /*
+          {
+              "chunks.VECTOR_FIELD": {
+                "query_text": "string",
+                "model_id": "string",
+                "k": int,
+                "chunk_score_mode": "sum"
+              }
+          }
+        */
+        setUpClusterService(Version.CURRENT);
+        XContentBuilder xContentBuilder = XContentFactory.jsonBuilder()
+            .startObject()
+            .startObject(CHUNK_FIELD_NAME)
+            .field(QUERY_TEXT_FIELD.getPreferredName(), QUERY_TEXT)
+            .field(MODEL_ID_FIELD.getPreferredName(), MODEL_ID)
+            .field(K_FIELD.getPreferredName(), K)
+            .field(CHUNK_SCORE_MODE_FIELD.getPreferredName(), ChunkScoreMode.SUM.getLabel())
+            .endObject()
+            .endObject();
+
+        XContentParser contentParser = createParser(xContentBuilder);
+        contentParser.nextToken();
+        NeuralQueryBuilder neuralQueryBuilder = NeuralQueryBuilder.fromXContent(contentParser);
+
+        assertEquals(CHUNK_FIELD_NAME, neuralQueryBuilder.fieldName());
+        assertEquals(ChunkScoreMode.SUM, neuralQueryBuilder.chunkScoreMode());
+        Map<String, Object> out = xContentBuilderToMap(neuralQueryBuilder.toXContent(XContentFactory.jsonBuilder(), EMPTY_PARAMS));
+        Map<?, ?> fieldMap = (Map<?, ?>) ((Map<?, ?>) out.get(NAME)).get(CHUNK_FIELD_NAME);
+        assertEquals(ChunkScoreMode.SUM.getLabel(), fieldMap.get(CHUNK_SCORE_MODE_FIELD.getPreferredName()));
+    }
+
+    @SneakyThrows
+    public void testFromXContent_whenBuiltWithInvalidChunkScoreMode_thenFail() {
+        setUpClusterService(Version.CURRENT);
+        XContentBuilder xContentBuilder = XContentFactory.jsonBuilder()
+            .startObject()
+            .startObject(CHUNK_FIELD_NAME)
+            .field(QUERY_TEXT_FIELD.getPreferredName(), QUERY_TEXT)
+            .field(MODEL_ID_FIELD.getPreferredName(), MODEL_ID)
+            .field(K_FIELD.getPreferredName(), K)
+            .field(CHUNK_SCORE_MODE_FIELD.getPreferredName(), "avg")
+            .endObject()
+            .endObject();
+
+        XContentParser contentParser = createParser(xContentBuilder);
+        contentParser.nextToken();
+        IllegalArgumentException exception = expectThrows(
+            IllegalArgumentException.class,
+            () -> NeuralQueryBuilder.fromXContent(contentParser)
+        );
+        assertEquals("unsupported chunk score mode [avg], supported modes are [max, sum]", exception.getMessage());
+    }
+
+    @SneakyThrows
+    public void testFromXContent_whenChunkScoreModeWithoutNestedField_thenFail() {
+        setUpClusterService(Version.CURRENT);
+        XContentBuilder xContentBuilder = XContentFactory.jsonBuilder()
+            .startObject()
+            .startObject(FIELD_NAME)
+            .field(QUERY_TEXT_FIELD.getPreferredName(), QUERY_TEXT)
+            .field(MODEL_ID_FIELD.getPreferredName(), MODEL_ID)
+            .field(K_FIELD.getPreferredName(), K)
+            .field(CHUNK_SCORE_MODE_FIELD.getPreferredName(), ChunkScoreMode.MAX.getLabel())
+            .endObject()
+            .endObject();
+
+        XContentParser contentParser = createParser(xContentBuilder);
+        contentParser.nextToken();
+        expectThrows(IllegalArgumentException.class, () -> NeuralQueryBuilder.fromXContent(contentParser));
+    }
+
+    @SneakyThrows
+    public void testRewrite_whenChunkScoreModeAndVectorSet_thenReturnItself() {
+        setUpClusterService(Version.CURRENT);
+        NeuralQueryBuilder neuralQueryBuilder = new NeuralQueryBuilder().fieldName(CHUNK_FIELD_NAME)
+            .queryText(QUERY_TEXT)
+            .modelId(MODEL_ID)
+            .k(K)
+            .vectorSupplier(TEST_VECTOR_SUPPLIER)
+            .chunkScoreMode(ChunkScoreMode.MAX);
+        QueryBuilder queryBuilder = neuralQueryBuilder.doRewrite(null);
+        assertSame(neuralQueryBuilder, queryBuilder);
+    }
+
+    @SneakyThrows
+    public void testRewrite_whenChunkScoreModeAndFilterNeedsRewrite_thenFilterRewritten() {
+        setUpClusterService(Version.CURRENT);
+        QueryBuilder filter = new BoolQueryBuilder().must(new MatchAllQueryBuilder());
+        NeuralQueryBuilder neuralQueryBuilder = new NeuralQueryBuilder().fieldName(CHUNK_FIELD_NAME)
+            .queryText(QUERY_TEXT)
+            .modelId(MODEL_ID)
+            .k(K)
+            .vectorSupplier(TEST_VECTOR_SUPPLIER)
+            .filter(filter)
+            .chunkScoreMode(ChunkScoreMode.MAX);
+        QueryRewriteContext queryRewriteContext = mock(QueryRewriteContext.class);
+
+        QueryBuilder queryBuilder = neuralQueryBuilder.doRewrite(queryRewriteContext);
+
+        assertTrue(queryBuilder instanceof NeuralQueryBuilder);
+        NeuralQueryBuilder rewrittenQueryBuilder = (NeuralQueryBuilder) queryBuilder;
+        // bool query with a single must clause is rewritten to the clause
+        assertEquals(new MatchAllQueryBuilder(), rewrittenQueryBuilder.filter());
+        assertEquals(ChunkScoreMode.MAX, rewrittenQueryBuilder.chunkScoreMode());
+        assertArrayEquals(TEST_VECTOR_SUPPLIER.get(), rewrittenQueryBuilder.vectorSupplier().get(), 0.0f);
+        assertSame(rewrittenQueryBuilder, rewrittenQueryBuilder.doRewrite(queryRewriteContext));
+    }
+
+    @SneakyThrows
+    public void testFromXContent_whenChunkScoreModeAndClusterBeforeMinVersion_thenFail() {
+        setUpClusterService(Version.V_2_14_0);
+        XContentBuilder xContentBuilder = XContentFactory.jsonBuilder()
+            .startObject()
+            .startObject(CHUNK_FIELD_NAME)
+            .field(QUERY_TEXT_FIELD.getPreferredName(), QUERY_TEXT)
+            .field(MODEL_ID_FIELD.getPreferredName(), MODEL_ID)
+            .field(K_FIELD.getPreferredName(), K)
+            .field(CHUNK_SCORE_MODE_FIELD.getPreferredName(), ChunkScoreMode.MAX.getLabel())
+            .endObject()
+            .endObject();
+
+        XContentParser contentParser = createParser(xContentBuilder);
+        contentParser.nextToken();
+        IllegalArgumentException exception = expectThrows(
+            IllegalArgumentException.class,
+            () -> NeuralQueryBuilder.fromXContent(contentParser)
+        );
+        assertEquals(
+            "[chunk_score_mode] requires all nodes of the cluster to be on version [3.0.0] or later, minimal node version is [2.14.0]",
+            exception.getMessage()
+        );
+
+        NeuralQueryBuilder neuralQueryBuilder = new NeuralQueryBuilder().fieldName(CHUNK_FIELD_NAME)
+            .queryText(QUERY_TEXT)
+            .modelId(MODEL_ID)
+            .k(K)
+            .vectorSupplier(TEST_VECTOR_SUPPLIER)
+            .chunkScoreMode(ChunkScoreMode.MAX);
+        expectThrows(IllegalArgumentException.class, () -> neuralQueryBuilder.doRewrite(null));
+    }
+
+    @SneakyThrows
+    public void testStreams_whenChunkScoreModeAndVectorSet_thenVectorIsSent() {
+        setUpClusterService(Version.CURRENT);
+        float[] vector = new float[] { 1.0f, 2.0f, 3.0f };
+        NeuralQueryBuilder original = new NeuralQueryBuilder().fieldName(CHUNK_FIELD_NAME)
+            .queryText(QUERY_TEXT)
+            .modelId(MODEL_ID)
+            .k(K)
+            .vectorSupplier(() -> vector)
+            .chunkScoreMode(ChunkScoreMode.SUM);
+
+        BytesStreamOutput streamOutput = new BytesStreamOutput();
+        original.writeTo(streamOutput);
+        NeuralQueryBuilder copy = new NeuralQueryBuilder(streamOutput.bytes().streamInput());
+
+        assertEquals(original, copy);
+        assertEquals(ChunkScoreMode.SUM, copy.chunkScoreMode());
+        assertArrayEquals(vector, copy.vectorSupplier().get(), 0.0f);
+    }
+
     private void setUpClusterService(Version version) {
         ClusterService clusterService = NeuralSearchClusterTestUtils.mockClusterService(version);
         NeuralSearchClusterUtil.instance().initialize(clusterService);
@@ -13,11 +13,14 @@ import static org.opensearch.neuralsearch.util.TestUtils.xContentBuilderToMap;
 import static org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder.MAX_TOKEN_SCORE_FIELD;
 import static org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder.MODEL_ID_FIELD;
 import static org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder.NAME;
+import static org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder.MAX_QUERY_TOKEN_WEIGHT;
 import static org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder.QUERY_TEXT_FIELD;
 import static org.opensearch.neuralsearch.query.NeuralSparseQueryBuilder.QUERY_TOKENS_FIELD;
 
 import java.io.IOException;
 import java.util.Collections;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.concurrent.CountDownLatch;
@@ -45,6 +48,7 @@ import org.opensearch.core.xcontent.ToXContent;
 import org.opensearch.core.xcontent.XContentBuilder;
 import org.opensearch.core.xcontent.XContentParser;
 import org.opensearch.index.mapper.MappedFieldType;
+import org.opensearch.index.query.BoolQueryBuilder;
 import org.opensearch.index.query.MatchAllQueryBuilder;
 import org.opensearch.index.query.QueryBuilder;
 import org.opensearch.index.query.QueryRewriteContext;
@@ -399,6 +403,25 @@ public class NeuralSparseQueryBuilderTests extends OpenSearchTestCase {
         testStreamsWithQueryTokensOnly();
     }
 
+    @SneakyThrows
+    public void testStreams_whenSameTokensInDifferentOrder_thenSameBytes() {
+        setUpClusterService(Version.CURRENT);
+        Map<String, Float> queryTokens = new LinkedHashMap<>();
+        queryTokens.put("hello", 1.0f);
+        queryTokens.put("world", 2.0f);
+        Map<String, Float> reorderedQueryTokens = new LinkedHashMap<>();
+        reorderedQueryTokens.put("world", 2.0f);
+        reorderedQueryTokens.put("hello", 1.0f);
+
+        BytesStreamOutput streamOutput = new BytesStreamOutput();
+        new NeuralSparseQueryBuilder().fieldName(FIELD_NAME).queryTokensSupplier(() -> queryTokens).writeTo(streamOutput);
+        BytesStreamOutput reorderedStreamOutput = new BytesStreamOutput();
+        new NeuralSparseQueryBuilder().fieldName(FIELD_NAME).queryTokensSupplier(() -> reorderedQueryTokens).writeTo(reorderedStreamOutput);
+
+        // shard request cache key is built from serialized request, it must not depend on order of tokens
+        assertEquals(streamOutput.bytes(), reorderedStreamOutput.bytes());
+    }
+
     @SneakyThrows
     private void testStreams() {
         NeuralSparseQueryBuilder original = new NeuralSparseQueryBuilder();
@@ -663,6 +686,35 @@ public class NeuralSparseQueryBuilderTests extends OpenSearchTestCase {
         assertSame(queryBuilder, sparseEncodingQueryBuilder);
     }
 
+    @SneakyThrows
+    public void testRewrite_whenInlineTwoPhasePruneRatioSet_thenRewriteToBooleanQuery() {
+        Map<String, Float> queryTokens = Map.of("high", 10.0f, "low", 1.0f);
+        NeuralSparseQueryBuilder sparseEncodingQueryBuilder = new NeuralSparseQueryBuilder().fieldName(FIELD_NAME)
+            .queryText(QUERY_TEXT)
+            .modelId(MODEL_ID)
+            .queryTokensSupplier(() -> queryTokens)
+            .inlineTwoPhasePruneRatio(0.4f)
+            .boost(2.0f);
+        QueryBuilder queryBuilder = sparseEncodingQueryBuilder.doRewrite(null);
+
+        assertTrue(queryBuilder instanceof BoolQueryBuilder);
+        BoolQueryBuilder boolQueryBuilder = (BoolQueryBuilder) queryBuilder;
+        assertEquals(2.0f, boolQueryBuilder.boost(), 0.0f);
+        assertEquals(1, boolQueryBuilder.must().size());
+        assertEquals(1, boolQueryBuilder.should().size());
+        NeuralSparseQueryBuilder highScoreQueryBuilder = (NeuralSparseQueryBuilder) boolQueryBuilder.must().get(0);
+        NeuralSparseQueryBuilder lowScoreQueryBuilder = (NeuralSparseQueryBuilder) boolQueryBuilder.should().get(0);
+        assertEquals(Map.of("high", 10.0f), highScoreQueryBuilder.queryTokensSupplier().get());
+        assertEquals(Map.of("low", 1.0f), lowScoreQueryBuilder.queryTokensSupplier().get());
+        assertEquals(0f, highScoreQueryBuilder.inlineTwoPhasePruneRatio(), 0.0f);
+
+        // all tokens pass the threshold, no need to split
+        sparseEncodingQueryBuilder.inlineTwoPhasePruneRatio(0.05f);
+        queryBuilder = sparseEncodingQueryBuilder.doRewrite(null);
+        assertTrue(queryBuilder instanceof NeuralSparseQueryBuilder);
+        assertEquals(queryTokens, ((NeuralSparseQueryBuilder) queryBuilder).queryTokensSupplier().get());
+    }
+
     private void setUpClusterService(Version version) {
         ClusterService clusterService = NeuralSearchClusterTestUtils.mockClusterService(version);
         NeuralSearchClusterUtil.instance().initialize(clusterService);
@@ -701,4 +753,64 @@ public class NeuralSparseQueryBuilderTests extends OpenSearchTestCase {
         expectThrows(IllegalArgumentException.class, () -> sparseEncodingQueryBuilder.doToQuery(mock(QueryShardContext.class)));
     }
 
+    @SneakyThrows
+    public void testDoToQuery_whenTokensWithoutPositiveWeight_thenSkipped() {
+        Map<String, Float> queryTokens = new HashMap<>();
+        queryTokens.put("hello", 1.f);
+        queryTokens.put("world", 0.f);
+        queryTokens.put("planet", -0.5f);
+        NeuralSparseQueryBuilder sparseEncodingQueryBuilder = new NeuralSparseQueryBuilder().fieldName(FIELD_NAME)
+            .queryText(QUERY_TEXT)
+            .modelId(MODEL_ID)
+            .queryTokensSupplier(() -> queryTokens);
+        QueryShardContext mockedQueryShardContext = mock(QueryShardContext.class);
+        MappedFieldType mockedMappedFieldType = mock(MappedFieldType.class);
+        doAnswer(invocation -> "rank_features").when(mockedMappedFieldType).typeName();
+        doAnswer(invocation -> mockedMappedFieldType).when(mockedQueryShardContext).fieldMapper(any());
+
+        BooleanQuery.Builder targetQueryBuilder = new BooleanQuery.Builder();
+        targetQueryBuilder.add(FeatureField.newLinearQuery(FIELD_NAME, "hello", 1.f), BooleanClause.Occur.SHOULD);
+
+        assertEquals(targetQueryBuilder.build(), sparseEncodingQueryBuilder.doToQuery(mockedQueryShardContext));
+    }
+
+    public void testGetScoringQueryTokens_whenMoreTokensThanLimit_thenKeepTokensWithHighestWeights() {
+        Map<String, Float> queryTokens = Map.of("a", 0.1f, "b", 2.5f, "c", 0.7f, "d", 1.2f);
+
+        List<Map.Entry<String, Float>> scoringQueryTokens = NeuralSparseQueryBuilder.getScoringQueryTokens(queryTokens, 2);
+
+        assertEquals(List.of(Map.entry("b", 2.5f), Map.entry("d", 1.2f)), scoringQueryTokens);
+        assertEquals(4, NeuralSparseQueryBuilder.getScoringQueryTokens(queryTokens, 10).size());
+    }
+
+    public void testGetScoringQueryTokens_whenWeightAboveMaxOrNaN_thenFail() {
+        IllegalArgumentException exception = expectThrows(
+            IllegalArgumentException.class,
+            () -> NeuralSparseQueryBuilder.getScoringQueryTokens(Map.of("a", 1.f, "b", 65.f), 10)
+        );
+        assertEquals("weight of token [b] in [neural_sparse] query is [65.0], it must not be greater than [64.0]", exception.getMessage());
+        expectThrows(IllegalArgumentException.class, () -> NeuralSparseQueryBuilder.getScoringQueryTokens(Map.of("a", Float.NaN), 10));
+        assertEquals(1, NeuralSparseQueryBuilder.getScoringQueryTokens(Map.of("a", MAX_QUERY_TOKEN_WEIGHT), 10).size());
+    }
+
+    @SneakyThrows
+    public void testFromXContent_whenQueryTokenWeightAboveMax_thenFail() {
+        XContentBuilder xContentBuilder = XContentFactory.jsonBuilder()
+            .startObject()
+            .startObject(FIELD_NAME)
+            .field(QUERY_TOKENS_FIELD.getPreferredName(), Map.of("hello", 1.f, "world", 100.f))
+            .endObject()
+            .endObject();
+
+        XContentParser contentParser = createParser(xContentBuilder);
+        contentParser.nextToken();
+        IllegalArgumentException exception = expectThrows(
+            IllegalArgumentException.class,
+            () -> NeuralSparseQueryBuilder.fromXContent(contentParser)
+        );
+        assertEquals(
+            "weight of token [world] in [neural_sparse] query is [100.0], it must not be greater than [64.0]",
+            exception.getMessage()
+        );
+    }
 }
@@ -4,6 +4,7 @@
  */
 package org.opensearch.neuralsearch.search;
 
+import org.apache.lucene.search.CollectionTerminatedException;
 import org.apache.lucene.search.DocIdSetIterator;
 import org.apache.lucene.search.LeafCollector;
 import org.apache.lucene.search.MatchAllDocsQuery;
@@ -13,19 +14,24 @@ import org.apache.lucene.search.ScoreDoc;
 import org.apache.lucene.search.ScoreMode;
 import org.apache.lucene.search.Scorer;
 import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.TotalHits;
 import org.apache.lucene.search.Weight;
 import static org.apache.lucene.search.DocIdSetIterator.NO_MORE_DOCS;
 import static org.mockito.ArgumentMatchers.eq;
 import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.when;
+import static org.opensearch.neuralsearch.util.TestUtils.DELTA_FOR_SCORE_ASSERTION;
 
+import java.io.IOException;
 import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Collection;
+import java.util.Collections;
 import java.util.List;
 import java.util.Objects;
 import java.util.Set;
 import java.util.HashSet;
+import java.util.concurrent.CountDownLatch;
 import java.util.stream.Collectors;
 import java.util.stream.IntStream;
 import java.util.stream.Stream;
@@ -564,4 +570,308 @@ public class HybridTopScoreDocCollectorTests extends OpenSearchQueryTestCase {
         reader.close();
         directory.close();
     }
+
+    @SneakyThrows
+    public void testTopDocs_whenMoreHitsThanQueueSize_thenKeepMostCompetitiveDocs() {
+        final Directory directory = newDirectory();
+        final IndexWriter w = new IndexWriter(directory, newIndexWriterConfig(new MockAnalyzer(random())));
+        FieldType ft = new FieldType(TextField.TYPE_NOT_STORED);
+        ft.setIndexOptions(IndexOptions.DOCS);
+        ft.freeze();
+        w.addDocument(getDocument(TEXT_FIELD_NAME, DOC_ID_1, FIELD_1_VALUE, ft));
+        w.commit();
+        DirectoryReader reader = DirectoryReader.open(w);
+        LeafReaderContext leafReaderContext = reader.getContext().leaves().get(0);
+
+        HybridTopScoreDocCollector hybridTopScoreDocCollector = new HybridTopScoreDocCollector(
+            2,
+            new HitsThresholdChecker(TOTAL_HITS_UP_TO)
+        );
+        Weight weight = mock(Weight.class);
+        hybridTopScoreDocCollector.setWeight(weight);
+        LeafCollector leafCollector = hybridTopScoreDocCollector.getLeafCollector(leafReaderContext);
+
+        // second sub-query has the same score for all docs, docs with lower doc id must win
+        int[] docIds = new int[] { 1, 2, 3, 4, 5 };
+        HybridQueryScorer hybridQueryScorer = new HybridQueryScorer(
+            weight,
+            Arrays.asList(
+                scorer(docIds, new float[] { 0.5f, 0.9f, 0.5f, 0.7f, 0.1f }, fakeWeight(new MatchAllDocsQuery())),
+                scorer(docIds, new float[] { 0.3f, 0.3f, 0.3f, 0.3f, 0.3f }, fakeWeight(new MatchAllDocsQuery()))
+            )
+        );
+        leafCollector.setScorer(hybridQueryScorer);
+        DocIdSetIterator iterator = hybridQueryScorer.iterator();
+        int nextDoc = iterator.nextDoc();
+        while (nextDoc != NO_MORE_DOCS) {
+            leafCollector.collect(nextDoc);
+            nextDoc = iterator.nextDoc();
+        }
+
+        List<TopDocs> topDocs = hybridTopScoreDocCollector.topDocs();
+        assertEquals(2, topDocs.size());
+        assertEquals(5, topDocs.get(0).totalHits.value);
+        ScoreDoc[] scoreDocsQuery1 = topDocs.get(0).scoreDocs;
+        assertEquals(2, scoreDocsQuery1.length);
+        assertEquals(2, scoreDocsQuery1[0].doc);
+        assertEquals(0.9f, scoreDocsQuery1[0].score, DELTA_FOR_SCORE_ASSERTION);
+        assertEquals(4, scoreDocsQuery1[1].doc);
+        assertEquals(0.7f, scoreDocsQuery1[1].score, DELTA_FOR_SCORE_ASSERTION);
+        ScoreDoc[] scoreDocsQuery2 = topDocs.get(1).scoreDocs;
+        assertEquals(2, scoreDocsQuery2.length);
+        assertEquals(1, scoreDocsQuery2[0].doc);
+        assertEquals(2, scoreDocsQuery2[1].doc);
+        assertEquals(0.9f, hybridTopScoreDocCollector.getMaxScore(), DELTA_FOR_SCORE_ASSERTION);
+
+        w.close();
+        reader.close();
+        directory.close();
+    }
+
+    @SneakyThrows
+    public void testMinCompetitiveScore_whenHitsThresholdReached_thenSetPerSubQuery() {
+        final Directory directory = newDirectory();
+        final IndexWriter w = new IndexWriter(directory, newIndexWriterConfig(new MockAnalyzer(random())));
+        FieldType ft = new FieldType(TextField.TYPE_NOT_STORED);
+        ft.setIndexOptions(IndexOptions.DOCS);
+        ft.freeze();
+        w.addDocument(getDocument(TEXT_FIELD_NAME, DOC_ID_1, FIELD_1_VALUE, ft));
+        w.commit();
+        DirectoryReader reader = DirectoryReader.open(w);
+        LeafReaderContext leafReaderContext = reader.getContext().leaves().get(0);
+
+        HybridTopScoreDocCollector hybridTopScoreDocCollector = new HybridTopScoreDocCollector(1, new HitsThresholdChecker(1));
+        Weight weight = mock(Weight.class);
+        hybridTopScoreDocCollector.setWeight(weight);
+        LeafCollector leafCollector = hybridTopScoreDocCollector.getLeafCollector(leafReaderContext);
+
+        MinCompetitiveScoreRecordingScorer subQueryScorer1 = new MinCompetitiveScoreRecordingScorer(
+            scorer(new int[] { 1, 2, 3 }, new float[] { 0.5f, 0.9f, 0.7f }, fakeWeight(new MatchAllDocsQuery()))
+        );
+        MinCompetitiveScoreRecordingScorer subQueryScorer2 = new MinCompetitiveScoreRecordingScorer(
+            scorer(new int[] { 1 }, new float[] { 0.3f }, fakeWeight(new MatchAllDocsQuery()))
+        );
+        HybridQueryScorer hybridQueryScorer = new HybridQueryScorer(weight, Arrays.asList(subQueryScorer1, subQueryScorer2));
+        leafCollector.setScorer(hybridQueryScorer);
+        DocIdSetIterator iterator = hybridQueryScorer.iterator();
+        int nextDoc = iterator.nextDoc();
+        while (nextDoc != NO_MORE_DOCS) {
+            leafCollector.collect(nextDoc);
+            nextDoc = iterator.nextDoc();
+        }
+
+        // each sub-query scorer gets bottom score of its own queue
+        assertEquals(List.of(0.5f, 0.9f), subQueryScorer1.minCompetitiveScores);
+        assertEquals(List.of(0.3f), subQueryScorer2.minCompetitiveScores);
+
+        List<TopDocs> topDocs = hybridTopScoreDocCollector.topDocs();
+        assertEquals(TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO, topDocs.get(0).totalHits.relation);
+        assertEquals(2, topDocs.get(0).scoreDocs[0].doc);
+        assertEquals(1, topDocs.get(1).scoreDocs[0].doc);
+
+        w.close();
+        reader.close();
+        directory.close();
+    }
+
+    @SneakyThrows
+    public void testMinCompetitiveScore_whenHitsThresholdNotReached_thenNotSet() {
+        final Directory directory = newDirectory();
+        final IndexWriter w = new IndexWriter(directory, newIndexWriterConfig(new MockAnalyzer(random())));
+        FieldType ft = new FieldType(TextField.TYPE_NOT_STORED);
+        ft.setIndexOptions(IndexOptions.DOCS);
+        ft.freeze();
+        w.addDocument(getDocument(TEXT_FIELD_NAME, DOC_ID_1, FIELD_1_VALUE, ft));
+        w.commit();
+        DirectoryReader reader = DirectoryReader.open(w);
+        LeafReaderContext leafReaderContext = reader.getContext().leaves().get(0);
+
+        HybridTopScoreDocCollector hybridTopScoreDocCollector = new HybridTopScoreDocCollector(
+            1,
+            new HitsThresholdChecker(TOTAL_HITS_UP_TO)
+        );
+        Weight weight = mock(Weight.class);
+        hybridTopScoreDocCollector.setWeight(weight);
+        LeafCollector leafCollector = hybridTopScoreDocCollector.getLeafCollector(leafReaderContext);
+
+        MinCompetitiveScoreRecordingScorer subQueryScorer = new MinCompetitiveScoreRecordingScorer(
+            scorer(new int[] { 1, 2 }, new float[] { 0.5f, 0.9f }, fakeWeight(new MatchAllDocsQuery()))
+        );
+        HybridQueryScorer hybridQueryScorer = new HybridQueryScorer(weight, Arrays.asList(subQueryScorer));
+        leafCollector.setScorer(hybridQueryScorer);
+        DocIdSetIterator iterator = hybridQueryScorer.iterator();
+        int nextDoc = iterator.nextDoc();
+        while (nextDoc != NO_MORE_DOCS) {
+            leafCollector.collect(nextDoc);
+            nextDoc = iterator.nextDoc();
+        }
+
+        assertTrue(subQueryScorer.minCompetitiveScores.isEmpty());
+        assertEquals(TotalHits.Relation.EQUAL_TO, hybridTopScoreDocCollector.getTotalHitsRelation());
+
+        w.close();
+        reader.close();
+        directory.close();
+    }
+
+    @SneakyThrows
+    public void testEarlyTermination_whenNoCompetitiveDocsLeftInSegment_thenTerminateCollection() {
+        final Directory directory = newDirectory();
+        final IndexWriter w = new IndexWriter(directory, newIndexWriterConfig(new MockAnalyzer(random())));
+        FieldType ft = new FieldType(TextField.TYPE_NOT_STORED);
+        ft.setIndexOptions(IndexOptions.DOCS);
+        ft.freeze();
+        w.addDocument(getDocument(TEXT_FIELD_NAME, DOC_ID_1, FIELD_1_VALUE, ft));
+        w.commit();
+        DirectoryReader reader = DirectoryReader.open(w);
+        LeafReaderContext leafReaderContext = reader.getContext().leaves().get(0);
+
+        HybridTopScoreDocCollector hybridTopScoreDocCollector = new HybridTopScoreDocCollector(1, new HitsThresholdChecker(1));
+        Weight weight = mock(Weight.class);
+        hybridTopScoreDocCollector.setWeight(weight);
+        LeafCollector leafCollector = hybridTopScoreDocCollector.getLeafCollector(leafReaderContext);
+
+        // max score of the scorer is reached by the first doc, none of next docs can be competitive
+        MinCompetitiveScoreRecordingScorer subQueryScorer = new MinCompetitiveScoreRecordingScorer(
+            scorer(new int[] { 1, 2, 3 }, new float[] { 0.9f, 0.5f, 0.7f }, fakeWeight(new MatchAllDocsQuery())),
+            0.9f
+        );
+        // sub-query without matches in the segment doesn't prevent termination
+        HybridQueryScorer hybridQueryScorer = new HybridQueryScorer(weight, Arrays.asList(subQueryScorer, null));
+        leafCollector.setScorer(hybridQueryScorer);
+        DocIdSetIterator iterator = hybridQueryScorer.iterator();
+        int doc = iterator.nextDoc();
+
+        expectThrows(CollectionTerminatedException.class, () -> leafCollector.collect(doc));
+
+        List<TopDocs> topDocs = hybridTopScoreDocCollector.topDocs();
+        assertEquals(TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO, hybridTopScoreDocCollector.getTotalHitsRelation());
+        assertEquals(1, topDocs.get(0).scoreDocs.length);
+        assertEquals(1, topDocs.get(0).scoreDocs[0].doc);
+        assertEquals(0.9f, topDocs.get(0).scoreDocs[0].score, DELTA_FOR_SCORE_ASSERTION);
+
+        w.close();
+        reader.close();
+        directory.close();
+    }
+
+    @SneakyThrows
+    public void testMinCompetitiveScore_whenCollectorsOfConcurrentSlicesShareThresholdChecker_thenAllHitsCounted() {
+        final Directory directory = newDirectory();
+        final IndexWriter w = new IndexWriter(directory, newIndexWriterConfig(new MockAnalyzer(random())));
+        FieldType ft = new FieldType(TextField.TYPE_NOT_STORED);
+        ft.setIndexOptions(IndexOptions.DOCS);
+        ft.freeze();
+        w.addDocument(getDocument(TEXT_FIELD_NAME, DOC_ID_1, FIELD_1_VALUE, ft));
+        w.commit();
+        DirectoryReader reader = DirectoryReader.open(w);
+        LeafReaderContext leafReaderContext = reader.getContext().leaves().get(0);
+
+        int numOfSlices = 4;
+        int numOfDocsPerSlice = 10_000;
+        int[] docIds = IntStream.range(0, numOfDocsPerSlice).toArray();
+        float[] scores = new float[numOfDocsPerSlice];
+        for (int i = 0; i < numOfDocsPerSlice; i++) {
+            scores[i] = (i + 1.0f) / numOfDocsPerSlice;
+        }
+        // threshold is reached only if hits of all slices are counted, by the last collected doc
+        HitsThresholdChecker hitsThresholdChecker = new HitsThresholdChecker(numOfSlices * numOfDocsPerSlice);
+        List<HybridTopScoreDocCollector> collectors = new ArrayList<>();
+        List<MinCompetitiveScoreRecordingScorer> subQueryScorers = new ArrayList<>();
+        List<Thread> threads = new ArrayList<>();
+        CountDownLatch startLatch = new CountDownLatch(1);
+        List<Throwable> failures = Collections.synchronizedList(new ArrayList<>());
+        for (int slice = 0; slice < numOfSlices; slice++) {
+            HybridTopScoreDocCollector collector = new HybridTopScoreDocCollector(1, hitsThresholdChecker);
+            Weight weight = mock(Weight.class);
+            collector.setWeight(weight);
+            LeafCollector leafCollector = collector.getLeafCollector(leafReaderContext);
+            MinCompetitiveScoreRecordingScorer subQueryScorer = new MinCompetitiveScoreRecordingScorer(
+                scorer(docIds, scores, fakeWeight(new MatchAllDocsQuery()))
+            );
+            HybridQueryScorer hybridQueryScorer = new HybridQueryScorer(weight, List.of(subQueryScorer));
+            leafCollector.setScorer(hybridQueryScorer);
+            collectors.add(collector);
+            subQueryScorers.add(subQueryScorer);
+            threads.add(new Thread(() -> {
+                try {
+                    startLatch.await();
+                    DocIdSetIterator iterator = hybridQueryScorer.iterator();
+                    for (int doc = iterator.nextDoc(); doc != NO_MORE_DOCS; doc = iterator.nextDoc()) {
+                        leafCollector.collect(doc);
+                    }
+                } catch (Throwable e) {
+                    failures.add(e);
+                }
+            }));
+        }
+        threads.forEach(Thread::start);
+        startLatch.countDown();
+        for (Thread thread : threads) {
+            thread.join();
+        }
+
+        assertTrue(failures.isEmpty());
+        // collectors that see the last counted hits enable min competitive score, their hit counts are lower bounds
+        long numOfCollectorsWithMinCompetitiveScore = subQueryScorers.stream()
+            .filter(subQueryScorer -> !subQueryScorer.minCompetitiveScores.isEmpty())
+            .count();
+        assertTrue(numOfCollectorsWithMinCompetitiveScore >= 1);
+        for (int slice = 0; slice < numOfSlices; slice++) {
+            HybridTopScoreDocCollector collector = collectors.get(slice);
+            TotalHits.Relation expectedRelation = subQueryScorers.get(slice).minCompetitiveScores.isEmpty()
+                ? TotalHits.Relation.EQUAL_TO
+                : TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO;
+            assertEquals(expectedRelation, collector.getTotalHitsRelation());
+            List<TopDocs> topDocs = collector.topDocs();
+            assertEquals(numOfDocsPerSlice, topDocs.get(0).totalHits.value);
+            assertEquals(numOfDocsPerSlice - 1, topDocs.get(0).scoreDocs[0].doc);
+            assertEquals(1.0f, topDocs.get(0).scoreDocs[0].score, DELTA_FOR_SCORE_ASSERTION);
+        }
+
+        w.close();
+        reader.close();
+        directory.close();
+    }
+
+    private static class MinCompetitiveScoreRecordingScorer extends Scorer {
+        private final Scorer delegate;
+        private final Float maxScore;
+        private final List<Float> minCompetitiveScores = new ArrayList<>();
+
+        MinCompetitiveScoreRecordingScorer(final Scorer delegate) {
+            this(delegate, null);
+        }
+
+        MinCompetitiveScoreRecordingScorer(final Scorer delegate, final Float maxScore) {
+            super(delegate.getWeight());
+            this.delegate = delegate;
+            this.maxScore = maxScore;
+        }
+
+        @Override
+        public int docID() {
+            return delegate.docID();
+        }
+
+        @Override
+        public DocIdSetIterator iterator() {
+            return delegate.iterator();
+        }
+
+        @Override
+        public float score() throws IOException {
+            return delegate.score();
+        }
+
+        @Override
+        public float getMaxScore(int upTo) throws IOException {
+            return maxScore == null ? delegate.getMaxScore(upTo) : maxScore;
+        }
+
+        @Override
+        public void setMinCompetitiveScore(float minScore) {
+            minCompetitiveScores.add(minScore);
+        }
+    }
 }
@@ -25,8 +25,12 @@ import org.apache.lucene.search.Weight;
 import org.apache.lucene.search.Query;
 import org.apache.lucene.store.Directory;
 import org.apache.lucene.tests.analysis.MockAnalyzer;
+import org.opensearch.Version;
+import org.opensearch.cluster.metadata.IndexMetadata;
 import org.opensearch.common.lucene.search.FilteredCollector;
 import org.opensearch.common.lucene.search.TopDocsAndMaxScore;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.index.IndexSettings;
 import org.opensearch.index.mapper.TextFieldMapper;
 import org.opensearch.index.query.BoostingQueryBuilder;
 import org.opensearch.index.query.QueryBuilders;
@@ -34,6 +38,7 @@ import org.opensearch.index.query.QueryShardContext;
 import org.opensearch.index.query.TermQueryBuilder;
 import org.opensearch.index.query.QueryBuilder;
 import org.opensearch.index.query.ParsedQuery;
+import org.opensearch.index.shard.IndexShard;
 import org.opensearch.neuralsearch.query.HybridQuery;
 import org.opensearch.neuralsearch.query.HybridQueryWeight;
 import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
@@ -52,6 +57,8 @@ import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.when;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.MAGIC_NUMBER_DELIMITER;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.MAGIC_NUMBER_START_STOP;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_SEARCH_SHARD_WINDOW_ENABLED;
+import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.HYBRID_SEARCH_SHARD_WINDOW_FACTOR;
 
 public class HybridCollectorManagerTests extends OpenSearchQueryTestCase {
 
@@ -436,4 +443,43 @@ public class HybridCollectorManagerTests extends OpenSearchQueryTestCase {
         reader2.close();
         directory2.close();
     }
+
+    public void testShardWindowSize_whenAdaptiveWindowEnabledOrDisabled_thenWindowSizeMatchesSettings() {
+        Settings disabledSettings = Settings.builder().put(HYBRID_SEARCH_SHARD_WINDOW_ENABLED.getKey(), false).build();
+        assertEquals(10, HybridCollectorManager.getShardWindowSize(mockSearchContextForShardWindow(disabledSettings, 5)));
+
+        Settings enabledSettings = Settings.builder()
+            .put(HYBRID_SEARCH_SHARD_WINDOW_ENABLED.getKey(), true)
+            .put(HYBRID_SEARCH_SHARD_WINDOW_FACTOR.getKey(), 1.5)
+            .build();
+        // ceil(1.5 * 10 / 5)
+        assertEquals(3, HybridCollectorManager.getShardWindowSize(mockSearchContextForShardWindow(enabledSettings, 5)));
+        // single shard must return all top hits
+        assertEquals(10, HybridCollectorManager.getShardWindowSize(mockSearchContextForShardWindow(enabledSettings, 1)));
+
+        Settings largeFactorSettings = Settings.builder()
+            .put(HYBRID_SEARCH_SHARD_WINDOW_ENABLED.getKey(), true)
+            .put(HYBRID_SEARCH_SHARD_WINDOW_FACTOR.getKey(), 3.0)
+            .build();
+        // share of the window is never larger than the window itself
+        assertEquals(10, HybridCollectorManager.getShardWindowSize(mockSearchContextForShardWindow(largeFactorSettings, 2)));
+    }
+
+    private SearchContext mockSearchContextForShardWindow(final Settings neuralSettings, final int numberOfShards) {
+        Settings settings = Settings.builder()
+            .put(IndexMetadata.SETTING_VERSION_CREATED, Version.CURRENT)
+            .put(IndexMetadata.SETTING_NUMBER_OF_SHARDS, numberOfShards)
+            .put(IndexMetadata.SETTING_NUMBER_OF_REPLICAS, 0)
+            .put(neuralSettings)
+            .build();
+        IndexMetadata indexMetadata = IndexMetadata.builder("test").settings(settings).build();
+        IndexShard indexShard = mock(IndexShard.class);
+        when(indexShard.indexSettings()).thenReturn(new IndexSettings(indexMetadata, Settings.EMPTY));
+        SearchContext searchContext = mock(SearchContext.class);
+        when(searchContext.from()).thenReturn(4);
+        when(searchContext.size()).thenReturn(6);
+        when(searchContext.numberOfShards()).thenReturn(numberOfShards);
+        when(searchContext.indexShard()).thenReturn(indexShard);
+        return searchContext;
+    }
 }
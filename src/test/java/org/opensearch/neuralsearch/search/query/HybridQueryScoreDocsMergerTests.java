@@ -7,6 +7,9 @@ package org.opensearch.neuralsearch.search.query;
 import org.apache.lucene.search.ScoreDoc;
 import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
 
+import java.util.Arrays;
+import java.util.List;
+
 import static org.opensearch.neuralsearch.search.query.TopDocsMerger.SCORE_DOC_BY_SCORE_COMPARATOR;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createStartStopElementForHybridSearchResults;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createDelimiterElementForHybridSearchResults;
@@ -151,4 +154,33 @@ public class HybridQueryScoreDocsMergerTests extends OpenSearchQueryTestCase {
         assertEquals(expectedDocId, scoreDoc.doc);
         assertEquals(expectedScore, scoreDoc.score, DELTA_FOR_ASSERTION);
     }
+
+    public void testMergeSorted_whenMultipleSortedArrays_thenTopHitsMergedInOrder() {
+        HybridQueryScoreDocsMerger<ScoreDoc> scoreDocsMerger = new HybridQueryScoreDocsMerger<>();
+
+        List<ScoreDoc[]> sortedScoreDocs = Arrays.asList(
+            new ScoreDoc[] { new ScoreDoc(4, 0.9f), new ScoreDoc(1, 0.4f) },
+            null,
+            new ScoreDoc[] { new ScoreDoc(10, 0.7f), new ScoreDoc(3, 0.4f), new ScoreDoc(12, 0.1f) },
+            new ScoreDoc[0],
+            new ScoreDoc[] { new ScoreDoc(20, 0.8f) }
+        );
+
+        ScoreDoc[] mergedScoreDocs = scoreDocsMerger.mergeSorted(sortedScoreDocs, 5, SCORE_DOC_BY_SCORE_COMPARATOR);
+
+        assertEquals(5, mergedScoreDocs.length);
+        // hits with equal scores are ordered by doc id
+        int[] expectedDocIds = new int[] { 4, 20, 10, 1, 3 };
+        float[] expectedScores = new float[] { 0.9f, 0.8f, 0.7f, 0.4f, 0.4f };
+        for (int i = 0; i < mergedScoreDocs.length; i++) {
+            assertEquals(expectedDocIds[i], mergedScoreDocs[i].doc);
+            assertEquals(expectedScores[i], mergedScoreDocs[i].score, DELTA_FOR_ASSERTION);
+        }
+
+        ScoreDoc[] allScoreDocs = scoreDocsMerger.mergeSorted(sortedScoreDocs, 100, SCORE_DOC_BY_SCORE_COMPARATOR);
+        assertEquals(6, allScoreDocs.length);
+        assertEquals(12, allScoreDocs[5].doc);
+
+        assertEquals(0, scoreDocsMerger.mergeSorted(Arrays.asList(null, new ScoreDoc[0]), 5, SCORE_DOC_BY_SCORE_COMPARATOR).length);
+    }
 }
@@ -0,0 +1,79 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.search.query;
+
+import static org.mockito.ArgumentMatchers.anyInt;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createDelimiterElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createStartStopElementForHybridSearchResults;
+
+import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.TotalHits;
+import org.opensearch.common.lucene.search.TopDocsAndMaxScore;
+import org.opensearch.search.DocValueFormat;
+import org.opensearch.search.internal.SearchContext;
+import org.opensearch.search.query.QuerySearchResult;
+import org.opensearch.test.OpenSearchTestCase;
+
+public class HybridQuerySearchOperationListenerTests extends OpenSearchTestCase {
+
+    public void testOnQueryPhase_whenOneShardAndHybridResults_thenSizeCoversAllElements() {
+        SearchContext searchContext = mockSearchContext(
+            1,
+            new ScoreDoc[] {
+                createStartStopElementForHybridSearchResults(0),
+                createDelimiterElementForHybridSearchResults(0),
+                new ScoreDoc(0, 0.5f),
+                new ScoreDoc(2, 0.3f),
+                createDelimiterElementForHybridSearchResults(0),
+                new ScoreDoc(4, 0.25f),
+                createStartStopElementForHybridSearchResults(0) }
+        );
+
+        new HybridQuerySearchOperationListener().onQueryPhase(searchContext, 0L);
+
+        verify(searchContext).size(7);
+    }
+
+    public void testOnQueryPhase_whenMultipleShards_thenSizeNotChanged() {
+        SearchContext searchContext = mockSearchContext(
+            3,
+            new ScoreDoc[] {
+                createStartStopElementForHybridSearchResults(0),
+                createDelimiterElementForHybridSearchResults(0),
+                new ScoreDoc(0, 0.5f),
+                createStartStopElementForHybridSearchResults(0) }
+        );
+
+        new HybridQuerySearchOperationListener().onQueryPhase(searchContext, 0L);
+
+        verify(searchContext, never()).size(anyInt());
+    }
+
+    public void testOnQueryPhase_whenNotHybridResults_thenSizeNotChanged() {
+        SearchContext searchContext = mockSearchContext(1, new ScoreDoc[] { new ScoreDoc(0, 0.5f), new ScoreDoc(2, 0.3f) });
+
+        new HybridQuerySearchOperationListener().onQueryPhase(searchContext, 0L);
+
+        verify(searchContext, never()).size(anyInt());
+    }
+
+    private SearchContext mockSearchContext(final int numberOfShards, final ScoreDoc[] scoreDocs) {
+        QuerySearchResult querySearchResult = new QuerySearchResult();
+        querySearchResult.topDocs(
+            new TopDocsAndMaxScore(new TopDocs(new TotalHits(scoreDocs.length, TotalHits.Relation.EQUAL_TO), scoreDocs), 0.5f),
+            new DocValueFormat[0]
+        );
+        SearchContext searchContext = mock(SearchContext.class);
+        when(searchContext.numberOfShards()).thenReturn(numberOfShards);
+        when(searchContext.queryResult()).thenReturn(querySearchResult);
+        when(searchContext.size()).thenReturn(10);
+        return searchContext;
+    }
+}
@@ -11,6 +11,8 @@ import org.apache.lucene.search.TotalHits;
 import org.opensearch.common.lucene.search.TopDocsAndMaxScore;
 import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
 
+import java.util.List;
+
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createStartStopElementForHybridSearchResults;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createDelimiterElementForHybridSearchResults;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.MAGIC_NUMBER_START_STOP;
@@ -248,6 +250,43 @@ public class TopDocsMergerTests extends OpenSearchQueryTestCase {
         assertEquals(MAGIC_NUMBER_START_STOP, scoreDocs[12].score, 0);
     }
 
+    public void testMergeSubQueryTopDocs_whenMultipleCollectors_thenHitsPerSubQueryMergedAndLimited() {
+        TopDocsMerger topDocsMerger = new TopDocsMerger(new HybridQueryScoreDocsMerger<>());
+
+        List<TopDocs> topDocsCollector1 = List.of(
+            new TopDocs(new TotalHits(2, TotalHits.Relation.EQUAL_TO), new ScoreDoc[] { new ScoreDoc(0, 0.5f), new ScoreDoc(2, 0.3f) }),
+            new TopDocs(new TotalHits(0, TotalHits.Relation.EQUAL_TO), new ScoreDoc[0])
+        );
+        List<TopDocs> topDocsCollector2 = List.of(
+            new TopDocs(
+                new TotalHits(3, TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO),
+                new ScoreDoc[] { new ScoreDoc(7, 0.7f), new ScoreDoc(9, 0.4f), new ScoreDoc(8, 0.05f) }
+            ),
+            new TopDocs(new TotalHits(1, TotalHits.Relation.EQUAL_TO), new ScoreDoc[] { new ScoreDoc(9, 0.6f) })
+        );
+        // collector of a slice that didn't collect any segment has no top docs
+        List<TopDocs> topDocsCollector3 = List.of();
+
+        List<TopDocs> mergedTopDocs = topDocsMerger.mergeSubQueryTopDocs(
+            List.of(topDocsCollector1, topDocsCollector2, topDocsCollector3),
+            3
+        );
+
+        assertEquals(2, mergedTopDocs.size());
+        TopDocs subQuery1TopDocs = mergedTopDocs.get(0);
+        assertEquals(5, subQuery1TopDocs.totalHits.value);
+        assertEquals(TotalHits.Relation.GREATER_THAN_OR_EQUAL_TO, subQuery1TopDocs.totalHits.relation);
+        assertEquals(3, subQuery1TopDocs.scoreDocs.length);
+        assertScoreDoc(subQuery1TopDocs.scoreDocs[0], 7, 0.7f);
+        assertScoreDoc(subQuery1TopDocs.scoreDocs[1], 0, 0.5f);
+        assertScoreDoc(subQuery1TopDocs.scoreDocs[2], 9, 0.4f);
+        TopDocs subQuery2TopDocs = mergedTopDocs.get(1);
+        assertEquals(1, subQuery2TopDocs.totalHits.value);
+        assertEquals(TotalHits.Relation.EQUAL_TO, subQuery2TopDocs.totalHits.relation);
+        assertEquals(1, subQuery2TopDocs.scoreDocs.length);
+        assertScoreDoc(subQuery2TopDocs.scoreDocs[0], 9, 0.6f);
+    }
+
     private void assertScoreDoc(ScoreDoc scoreDoc, int expectedDocId, float expectedScore) {
         assertEquals(expectedDocId, scoreDoc.doc);
         assertEquals(expectedScore, scoreDoc.score, DELTA_FOR_ASSERTION);
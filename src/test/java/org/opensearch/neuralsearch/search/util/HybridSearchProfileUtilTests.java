@@ -0,0 +1,77 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.search.util;
+
+import static org.opensearch.neuralsearch.search.util.HybridSearchProfileUtil.NORMALIZATION_PROFILE_TYPE;
+import static org.opensearch.neuralsearch.search.util.HybridSearchProfileUtil.SLOWEST_SUB_QUERY_FIELD;
+import static org.opensearch.neuralsearch.search.util.HybridSearchProfileUtil.SUB_QUERY_TIMES_FIELD;
+
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
+import org.opensearch.search.profile.NetworkTime;
+import org.opensearch.search.profile.ProfileResult;
+import org.opensearch.search.profile.ProfileShardResult;
+import org.opensearch.search.profile.aggregation.AggregationProfileShardResult;
+import org.opensearch.search.profile.query.CollectorResult;
+import org.opensearch.search.profile.query.QueryProfileShardResult;
+import org.opensearch.search.query.QuerySearchResult;
+
+public class HybridSearchProfileUtilTests extends OpenSearchQueryTestCase {
+
+    public void testAddHybridProfileBreakdown_whenSearchIsProfiled_thenSubQueryTimesAndNormalizationAdded() {
+        ProfileResult termQueryProfile = profileResult("TermQuery", 100L, List.of());
+        ProfileResult knnQueryProfile = profileResult("KNNQuery", 300L, List.of());
+        ProfileResult hybridQueryProfile = profileResult("HybridQuery", 450L, List.of(termQueryProfile, knnQueryProfile));
+        QuerySearchResult profiledResult = new QuerySearchResult();
+        CollectorResult collectorResult = new CollectorResult("HybridTopScoreDocCollector", "search_top_hits", 50L, List.of());
+        profiledResult.profileResults(
+            new ProfileShardResult(
+                List.of(new QueryProfileShardResult(List.of(hybridQueryProfile), 20L, collectorResult)),
+                new AggregationProfileShardResult(List.of()),
+                new NetworkTime(0, 0)
+            )
+        );
+        QuerySearchResult notProfiledResult = new QuerySearchResult();
+        List<QuerySearchResult> querySearchResults = List.of(profiledResult, notProfiledResult);
+        Map<String, Long> stageTimesInNanos = new LinkedHashMap<>();
+        stageTimesInNanos.put("normalize", 10L);
+        stageTimesInNanos.put("combine", 5L);
+
+        assertTrue(HybridSearchProfileUtil.isProfiled(querySearchResults));
+        HybridSearchProfileUtil.addHybridProfileBreakdown(querySearchResults, stageTimesInNanos);
+
+        assertFalse(notProfiledResult.hasProfileResults());
+        QueryProfileShardResult queryProfile = profiledResult.consumeProfileResult().getQueryProfileResults().get(0);
+        assertEquals(20L, queryProfile.getRewriteTime());
+        assertSame(collectorResult, queryProfile.getCollectorResult());
+        ProfileResult updatedHybridProfile = queryProfile.getQueryResults().get(0);
+        assertEquals(450L, updatedHybridProfile.getTime());
+        assertEquals(List.of(100L, 300L), updatedHybridProfile.getDebugInfo().get(SUB_QUERY_TIMES_FIELD));
+        assertEquals(1, updatedHybridProfile.getDebugInfo().get(SLOWEST_SUB_QUERY_FIELD));
+
+        List<ProfileResult> children = updatedHybridProfile.getProfiledChildren();
+        assertEquals(3, children.size());
+        assertSame(termQueryProfile, children.get(0));
+        assertSame(knnQueryProfile, children.get(1));
+        ProfileResult normalizationProfile = children.get(2);
+        assertEquals(NORMALIZATION_PROFILE_TYPE, normalizationProfile.getQueryName());
+        assertEquals(15L, normalizationProfile.getTime());
+        assertEquals(
+            Map.of("normalize", 10L, "normalize_count", 1L, "combine", 5L, "combine_count", 1L),
+            normalizationProfile.getTimeBreakdown()
+        );
+    }
+
+    public void testIsProfiled_whenNoProfileResults_thenFalse() {
+        assertFalse(HybridSearchProfileUtil.isProfiled(List.of(new QuerySearchResult(), new QuerySearchResult())));
+    }
+
+    private static ProfileResult profileResult(final String type, final long time, final List<ProfileResult> children) {
+        return new ProfileResult(type, type + " description", Map.of("score", time), Map.of(), time, children);
+    }
+}
@@ -7,13 +7,20 @@ package org.opensearch.neuralsearch.search.util;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.MAGIC_NUMBER_DELIMITER;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.MAGIC_NUMBER_START_STOP;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createDelimiterElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createHybridSearchResultScoreDocs;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createStartStopElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.getSubQueryTopDocs;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQueryDelimiterElement;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQueryStartStopElement;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQueryScoreDocElement;
 import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.isHybridQuerySpecialElement;
 
+import java.util.Arrays;
+import java.util.List;
+
 import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.TotalHits;
 import org.opensearch.common.Randomness;
 import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
 
@@ -74,4 +81,42 @@ public class HybridSearchResultFormatUtilTests extends OpenSearchQueryTestCase {
         assertFalse(isHybridQuerySpecialElement(startStopElement));
         assertTrue(isHybridQueryScoreDocElement(startStopElement));
     }
+
+    public void testCreateAndParseScoreDocs_whenSubQueriesWithAndWithoutResults_thenSameTopDocsParsed() {
+        ScoreDoc[] firstSubQueryScoreDocs = new ScoreDoc[] { new ScoreDoc(3, 0.9f, 1), new ScoreDoc(5, 0.4f, 1) };
+        ScoreDoc[] thirdSubQueryScoreDocs = new ScoreDoc[] { new ScoreDoc(5, 7.5f, 1) };
+        List<TopDocs> topDocsPerSubQuery = Arrays.asList(
+            new TopDocs(new TotalHits(2, TotalHits.Relation.EQUAL_TO), firstSubQueryScoreDocs),
+            null,
+            new TopDocs(new TotalHits(1, TotalHits.Relation.EQUAL_TO), thirdSubQueryScoreDocs)
+        );
+
+        ScoreDoc[] scoreDocs = createHybridSearchResultScoreDocs(3, topDocsPerSubQuery);
+
+        assertEquals(8, scoreDocs.length);
+        assertTrue(isHybridQueryStartStopElement(scoreDocs[0]));
+        assertTrue(isHybridQueryDelimiterElement(scoreDocs[1]));
+        assertTrue(isHybridQueryDelimiterElement(scoreDocs[4]));
+        assertTrue(isHybridQueryDelimiterElement(scoreDocs[5]));
+        assertTrue(isHybridQueryStartStopElement(scoreDocs[7]));
+        // score docs are copied
+        assertNotSame(firstSubQueryScoreDocs[0], scoreDocs[2]);
+
+        List<TopDocs> parsedTopDocs = getSubQueryTopDocs(scoreDocs);
+        assertEquals(3, parsedTopDocs.size());
+        assertScoreDocs(firstSubQueryScoreDocs, parsedTopDocs.get(0));
+        assertScoreDocs(new ScoreDoc[0], parsedTopDocs.get(1));
+        assertScoreDocs(thirdSubQueryScoreDocs, parsedTopDocs.get(2));
+    }
+
+    private void assertScoreDocs(final ScoreDoc[] expected, final TopDocs actual) {
+        assertEquals(expected.length, actual.totalHits.value);
+        assertEquals(TotalHits.Relation.EQUAL_TO, actual.totalHits.relation);
+        assertEquals(expected.length, actual.scoreDocs.length);
+        for (int i = 0; i < expected.length; i++) {
+            assertEquals(expected[i].doc, actual.scoreDocs[i].doc);
+            assertEquals(expected[i].score, actual.scoreDocs[i].score, 0.0f);
+            assertEquals(expected[i].shardIndex, actual.scoreDocs[i].shardIndex);
+        }
+    }
 }
@@ -0,0 +1,90 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.stats;
+
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicBoolean;
+
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.test.OpenSearchTestCase;
+
+public class NeuralStatsTests extends OpenSearchTestCase {
+
+    private static final String STAT_NAME = "stage.time_micros";
+
+    public void testRecord_whenDisabled_thenNothingRecorded() {
+        NeuralStats neuralStats = new NeuralStats();
+
+        long startNanos = neuralStats.startTimer();
+        neuralStats.recordTime(STAT_NAME, startNanos);
+        neuralStats.recordSize(STAT_NAME, 10);
+        ActionListener<String> listener = ActionListener.wrap(result -> {}, e -> fail(e.getMessage()));
+
+        assertEquals(NeuralStats.DISABLED_TIMER, startNanos);
+        assertNull(neuralStats.getHistogram(STAT_NAME));
+        assertSame(listener, neuralStats.timedListener(STAT_NAME, listener));
+        assertEquals(Map.of(), neuralStats.toMap().get("stages"));
+    }
+
+    public void testRecord_whenEnabled_thenHistogramUpdated() {
+        NeuralStats neuralStats = new NeuralStats();
+        neuralStats.setEnabled(true);
+
+        neuralStats.recordTime(STAT_NAME, neuralStats.startTimer());
+        AtomicBoolean completed = new AtomicBoolean();
+        neuralStats.timedListener(STAT_NAME, ActionListener.wrap(result -> completed.set(true), e -> fail(e.getMessage())))
+            .onResponse("result");
+
+        assertTrue(completed.get());
+        assertEquals(2, neuralStats.getHistogram(STAT_NAME).getCount());
+
+        // values recorded before the switch are kept
+        neuralStats.setEnabled(false);
+        neuralStats.recordTime(STAT_NAME, neuralStats.startTimer());
+        assertEquals(2, neuralStats.getHistogram(STAT_NAME).getCount());
+    }
+
+    public void testHistogram_whenValuesRecorded_thenBucketsAndPercentiles() {
+        StatHistogram histogram = new StatHistogram(StatHistogram.SIZE_BOUNDS);
+        for (int i = 0; i < 98; i++) {
+            histogram.record(3);
+        }
+        histogram.record(-1);
+        histogram.record(5_000);
+
+        assertEquals(100, histogram.getCount());
+        assertEquals(98 * 3 + 5_000, histogram.getSum());
+        assertEquals(5_000, histogram.getMax());
+        assertEquals(5, histogram.getPercentile(50));
+        assertEquals(5, histogram.getPercentile(99));
+        assertEquals(5_000, histogram.getPercentile(100));
+
+        Map<String, Object> stats = histogram.toMap();
+        Map<?, ?> buckets = (Map<?, ?>) stats.get("buckets");
+        assertEquals(1L, buckets.get("1"));
+        assertEquals(98L, buckets.get("5"));
+        assertEquals(1L, buckets.get("inf"));
+        assertEquals(52.94, (double) stats.get("avg"), 0.001);
+    }
+
+    public void testToMap_whenSupplierRegistered_thenStatsReported() {
+        NeuralStats neuralStats = new NeuralStats();
+        neuralStats.setEnabled(true);
+        neuralStats.recordSize(STAT_NAME, 1);
+        neuralStats.registerStatsSupplier("component", () -> Map.of("counter", 1L));
+        neuralStats.registerStatsSupplier("failing_component", () -> { throw new IllegalStateException("not initialized"); });
+
+        Map<String, Object> stats = neuralStats.toMap();
+
+        assertEquals(true, stats.get("enabled"));
+        assertEquals(Map.of("counter", 1L), stats.get("component"));
+        assertFalse(stats.containsKey("failing_component"));
+        assertEquals(List.of(STAT_NAME), List.copyOf(((Map<?, ?>) stats.get("stages")).keySet()));
+
+        neuralStats.reset();
+        assertEquals(Map.of(), neuralStats.toMap().get("stages"));
+    }
+}
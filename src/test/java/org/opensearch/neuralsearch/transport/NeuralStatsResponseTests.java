@@ -0,0 +1,49 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import java.util.List;
+import java.util.Map;
+
+import org.opensearch.Version;
+import org.opensearch.cluster.ClusterName;
+import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.common.io.stream.BytesStreamOutput;
+import org.opensearch.common.xcontent.XContentFactory;
+import org.opensearch.common.xcontent.XContentHelper;
+import org.opensearch.core.common.bytes.BytesReference;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.transport.TransportAddress;
+import org.opensearch.core.xcontent.ToXContent;
+import org.opensearch.core.xcontent.XContentBuilder;
+import org.opensearch.test.OpenSearchTestCase;
+
+public class NeuralStatsResponseTests extends OpenSearchTestCase {
+
+    public void testSerialization_whenNodeResponsesGiven_thenStatsArePreserved() throws Exception {
+        DiscoveryNode node = new DiscoveryNode("node_1", new TransportAddress(TransportAddress.META_ADDRESS, 9300), Version.CURRENT);
+        Map<String, Object> stats = Map.of("enabled", true, "stages", Map.of("rerank.time_micros", Map.of("count", 2L)));
+        NeuralStatsResponse response = new NeuralStatsResponse(
+            new ClusterName("test_cluster"),
+            List.of(new NeuralStatsNodeResponse(node, stats)),
+            List.of()
+        );
+
+        BytesStreamOutput output = new BytesStreamOutput();
+        response.writeTo(output);
+        StreamInput input = output.bytes().streamInput();
+        NeuralStatsResponse deserialized = new NeuralStatsResponse(input);
+
+        assertEquals(1, deserialized.getNodes().size());
+        assertEquals(stats, deserialized.getNodes().get(0).getStats());
+
+        XContentBuilder builder = XContentFactory.jsonBuilder().startObject();
+        deserialized.toXContent(builder, ToXContent.EMPTY_PARAMS);
+        builder.endObject();
+        Map<String, Object> content = XContentHelper.convertToMap(BytesReference.bytes(builder), false, builder.contentType()).v2();
+        Map<String, Object> nodeContent = Map.of("enabled", true, "stages", Map.of("rerank.time_micros", Map.of("count", 2)));
+        assertEquals(Map.of("nodes", Map.of("node_1", nodeContent)), content);
+    }
+}
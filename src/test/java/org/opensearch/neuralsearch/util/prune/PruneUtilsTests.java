@@ -0,0 +1,55 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.util.prune;
+
+import java.util.Map;
+
+import org.opensearch.test.OpenSearchTestCase;
+
+public class PruneUtilsTests extends OpenSearchTestCase {
+
+    private static final Map<String, Float> SPARSE_VECTOR = Map.of("a", 0.1f, "b", 2.0f, "c", 1.0f, "d", 0.4f, "e", 0.5f);
+
+    public void testPruneSparseVector_whenTopK_thenKeepTokensWithHighestWeights() {
+        assertEquals(Map.of("b", 2.0f, "c", 1.0f), PruneUtils.pruneSparseVector(PruneType.TOP_K, 2, SPARSE_VECTOR));
+        assertEquals(SPARSE_VECTOR, PruneUtils.pruneSparseVector(PruneType.TOP_K, 10, SPARSE_VECTOR));
+    }
+
+    public void testPruneSparseVector_whenMaxRatio_thenKeepTokensAboveRatioOfMaxWeight() {
+        assertEquals(Map.of("b", 2.0f, "c", 1.0f, "e", 0.5f), PruneUtils.pruneSparseVector(PruneType.MAX_RATIO, 0.25f, SPARSE_VECTOR));
+    }
+
+    public void testPruneSparseVector_whenAlphaMass_thenKeepTokensWithShareOfTotalWeight() {
+        // total weight is 4.0, 2.0 + 1.0 is 75% of it
+        assertEquals(Map.of("b", 2.0f, "c", 1.0f), PruneUtils.pruneSparseVector(PruneType.ALPHA_MASS, 0.75f, SPARSE_VECTOR));
+        assertEquals(SPARSE_VECTOR, PruneUtils.pruneSparseVector(PruneType.ALPHA_MASS, 1.0f, SPARSE_VECTOR));
+    }
+
+    public void testPruneSparseVector_whenNone_thenSameVector() {
+        assertSame(SPARSE_VECTOR, PruneUtils.pruneSparseVector(PruneType.NONE, 0f, SPARSE_VECTOR));
+    }
+
+    public void testQuantizeSparseVector_whenStepSet_thenWeightsRoundedAndZerosRemoved() {
+        assertEquals(
+            Map.of("b", 2.0f, "c", 1.0f, "d", 0.5f, "e", 0.5f),
+            PruneUtils.quantizeSparseVector(0.25f, Map.of("a", 0.1f, "b", 2.0f, "c", 1.05f, "d", 0.4f, "e", 0.5f))
+        );
+        assertSame(SPARSE_VECTOR, PruneUtils.quantizeSparseVector(0f, SPARSE_VECTOR));
+    }
+
+    public void testValidatePruneRatio_whenRatioOutOfRange_thenFail() {
+        expectThrows(IllegalArgumentException.class, () -> PruneUtils.validatePruneRatio(PruneType.TOP_K, 0.5f));
+        expectThrows(IllegalArgumentException.class, () -> PruneUtils.validatePruneRatio(PruneType.MAX_RATIO, 1.0f));
+        expectThrows(IllegalArgumentException.class, () -> PruneUtils.validatePruneRatio(PruneType.ALPHA_MASS, 0f));
+        PruneUtils.validatePruneRatio(PruneType.TOP_K, 3f);
+        PruneUtils.validatePruneRatio(PruneType.NONE, 0f);
+    }
+
+    public void testGetPruneType_whenUnknownValue_thenFail() {
+        assertEquals(PruneType.NONE, PruneType.getPruneType(null));
+        assertEquals(PruneType.ALPHA_MASS, PruneType.getPruneType("alpha_mass"));
+        expectThrows(IllegalArgumentException.class, () -> PruneType.getPruneType("abs_value"));
+    }
+}